@@ -0,0 +1,132 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "geometry/delaunay.hpp"
+#include "geometry/point_cloud.hpp"
+#include "geometry/voronoi_diagram.hpp"
+
+namespace {
+using zozibush::geometry::Delaunay;
+using zozibush::geometry::PointCloud;
+using zozibush::geometry::VoronoiDiagram;
+
+constexpr std::size_t kDefaultCount{std::size_t{1} << 20U};
+constexpr std::size_t kRepetitions{3};
+constexpr std::size_t kClusterCount{64};
+constexpr int kUsageError{2};
+
+// Shortest of a few runs, in seconds.
+template <typename Function>
+auto MeasureSeconds(const Function& run) -> double {
+  auto best{std::chrono::duration<double>::max()};
+  for (std::size_t i = 0; i < kRepetitions; ++i) {
+    const auto kStart{std::chrono::steady_clock::now()};
+    run();
+    best = std::min(best, std::chrono::duration<double>(
+                              std::chrono::steady_clock::now() - kStart));
+  }
+  return best.count();
+}
+
+auto Benchmark(const char* input, const PointCloud<2, double>& points)
+    -> void {
+  std::size_t triangle_count{0};
+  const auto kDelaunaySeconds{MeasureSeconds([&] {
+    const Delaunay kDelaunay(points);
+    triangle_count = kDelaunay.GetTriangleCount();
+  })};
+  const Delaunay kDelaunay(points);
+  std::size_t cell_count{0};
+  const auto kVoronoiSeconds{MeasureSeconds([&] {
+    const VoronoiDiagram kVoronoi(kDelaunay);
+    cell_count = kVoronoi.GetCellCount();
+  })};
+
+  const auto kCount{static_cast<double>(points.Size())};
+  std::printf("%-10s %10zu %12zu %10.3f %12.2f %10.3f %12.2f\n", input,
+              points.Size(), triangle_count, kDelaunaySeconds,
+              kCount / kDelaunaySeconds * 1.0e-6, kVoronoiSeconds,
+              static_cast<double>(cell_count) / kVoronoiSeconds * 1.0e-6);
+}
+
+auto MakeUniform(std::mt19937_64& engine, std::size_t count)
+    -> PointCloud<2, double> {
+  std::uniform_real_distribution<double> coordinate(-1.0, 1.0);
+  PointCloud<2, double> points;
+  points.Resize(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    points.Data(0)[i] = coordinate(engine);
+    points.Data(1)[i] = coordinate(engine);
+  }
+  return points;
+}
+
+// Shuffled integer lattice, full of collinear and cocircular points.
+auto MakeGrid(std::mt19937_64& engine, std::size_t count)
+    -> PointCloud<2, double> {
+  const auto kSide{static_cast<std::size_t>(
+      std::ceil(std::sqrt(static_cast<double>(count))))};
+  PointCloud<2, double> points;
+  points.Resize(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    points.Data(0)[i] = static_cast<double>(i % kSide);
+    points.Data(1)[i] = static_cast<double>(i / kSide);
+  }
+  for (std::size_t i = count; i > 1; --i) {
+    std::uniform_int_distribution<std::size_t> pick(0, i - 1);
+    const auto kOther{pick(engine)};
+    std::swap(points.Data(0)[i - 1], points.Data(0)[kOther]);
+    std::swap(points.Data(1)[i - 1], points.Data(1)[kOther]);
+  }
+  return points;
+}
+
+// Gaussian clusters of very different density.
+auto MakeClustered(std::mt19937_64& engine, std::size_t count)
+    -> PointCloud<2, double> {
+  std::uniform_real_distribution<double> center(-1.0, 1.0);
+  std::uniform_real_distribution<double> spread(-5.0, -1.0);
+  std::uniform_int_distribution<std::size_t> pick(0, kClusterCount - 1);
+  double centers[kClusterCount][3];
+  for (auto& cluster : centers) {
+    cluster[0] = center(engine);
+    cluster[1] = center(engine);
+    cluster[2] = std::pow(10.0, spread(engine));
+  }
+  std::normal_distribution<double> offset(0.0, 1.0);
+  PointCloud<2, double> points;
+  points.Resize(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto& kCluster{centers[pick(engine)]};
+    points.Data(0)[i] = kCluster[0] + kCluster[2] * offset(engine);
+    points.Data(1)[i] = kCluster[1] + kCluster[2] * offset(engine);
+  }
+  return points;
+}
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+  const std::size_t kCount{
+      (argc == 2) ? std::strtoul(argv[1], nullptr, 10) : kDefaultCount};
+  if (argc > 2 || kCount < 3) {
+    std::fprintf(stderr, "usage: delaunay_benchmark [point count >= 3]\n");
+    return kUsageError;
+  }
+
+  std::mt19937_64 engine(11U);
+  std::printf("%-10s %10s %12s %10s %12s %10s %12s\n", "input", "points",
+              "triangles", "delaunay s", "Mpoints/s", "voronoi s",
+              "Mcells/s");
+  Benchmark("uniform", MakeUniform(engine, kCount));
+  Benchmark("grid", MakeGrid(engine, kCount));
+  Benchmark("clustered", MakeClustered(engine, kCount));
+  return 0;
+}
@@ -0,0 +1,256 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "jobs.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "geometry/batch_distance.hpp"
+#include "geometry/convex_hull.hpp"
+#include "geometry/distance.hpp"
+#include "geometry/grid_index.hpp"
+#include "geometry/parallel.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud.hpp"
+#include "geometry/point_deduplicator.hpp"
+#include "geometry/point_n.hpp"
+#include "geometry/polyline_simplifier.hpp"
+#include "geometry/tuning.hpp"
+#include "point_io.hpp"
+
+namespace {
+using zozibush::geometry::PointCloud;
+using zozibush::geometry::application::AppendNumber;
+using zozibush::geometry::application::Options;
+using zozibush::geometry::application::ResultWriter;
+using zozibush::geometry::application::StageReport;
+
+constexpr std::size_t kQueriesPerBlock{4096};
+
+auto Load(const std::string& path, const Options& options,
+          const std::string& stage, StageReport& report)
+    -> PointCloud<2, double> {
+  PointCloud<2, double> points;
+  report.Begin(stage);
+  const auto kBytes{zozibush::geometry::application::ReadPoints(
+      path, options.input_format, points)};
+  report.End(points.Size(), kBytes);
+  return points;
+}
+
+auto Write(ResultWriter& writer, std::size_t count,
+           const std::function<void(std::size_t, std::string&)>& format,
+           const Options& options, StageReport& report) -> void {
+  const auto kBytes{writer.GetByteCount()};
+  report.Begin("write");
+  writer.WriteLines(count, format, options.thread_count);
+  report.End(count, writer.GetByteCount() - kBytes);
+}
+
+auto RunDistance(const Options& options, const PointCloud<2, double>& points,
+                 ResultWriter& writer, StageReport& report) -> void {
+  std::vector<double> distances(points.Size());
+  if (options.has_query_point) {
+    report.Begin("distance");
+    zozibush::geometry::CalculateDistances(
+        points, zozibush::geometry::PointN<2>(options.query_x, options.query_y),
+        distances.data());
+    report.End(points.Size());
+  } else {
+    const auto kQueries{Load(options.query_path, options, "queries", report)};
+    report.Begin("distance");
+    zozibush::geometry::CalculatePairwiseDistances(points, kQueries,
+                                                   distances.data());
+    report.End(points.Size());
+  }
+  Write(
+      writer, distances.size(),
+      [&](std::size_t i, std::string& line) {
+        AppendNumber(static_cast<uint64_t>(i), line);
+        line.push_back(' ');
+        AppendNumber(distances[i], line);
+      },
+      options, report);
+}
+
+auto RunNearest(const Options& options, const PointCloud<2, double>& points,
+                ResultWriter& writer, StageReport& report) -> void {
+  if (points.Empty()) {
+    throw std::invalid_argument("nearest needs at least one input point");
+  }
+  const auto kQueries{Load(options.query_path, options, "queries", report)};
+  report.Begin("index");
+  const zozibush::geometry::GridIndex kGrid(
+      points, zozibush::geometry::GridIndex::EstimateCellSize(points),
+      options.thread_count);
+  report.End(points.Size());
+
+  const auto kCount{kQueries.Size()};
+  std::vector<std::size_t> nearest(kCount);
+  std::vector<double> distances(kCount);
+  report.Begin("nearest");
+  zozibush::geometry::ParallelFor(
+      kCount, zozibush::geometry::GetTuningParameters().query_grain,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          const zozibush::geometry::Point2D kQuery(kQueries.Data(0)[i],
+                                                   kQueries.Data(1)[i]);
+          nearest[i] = kGrid.FindNearest(kQuery);
+          distances[i] = kQuery.CalculateDistance(
+              {points.Data(0)[nearest[i]], points.Data(1)[nearest[i]]});
+        }
+      },
+      options.thread_count);
+  report.End(kCount);
+
+  Write(
+      writer, kCount,
+      [&](std::size_t i, std::string& line) {
+        AppendNumber(static_cast<uint64_t>(i), line);
+        line.push_back(' ');
+        AppendNumber(static_cast<uint64_t>(nearest[i]), line);
+        line.push_back(' ');
+        AppendNumber(distances[i], line);
+      },
+      options, report);
+}
+
+auto RunRadius(const Options& options, const PointCloud<2, double>& points,
+               ResultWriter& writer, StageReport& report) -> void {
+  const auto kQueries{Load(options.query_path, options, "queries", report)};
+  report.Begin("index");
+  const zozibush::geometry::GridIndex kGrid(points, options.radius,
+                                            options.thread_count);
+  report.End(points.Size());
+
+  // Every block of queries keeps its neighbours back to back, with the end
+  // of each query's run in ends.
+  const auto kCount{kQueries.Size()};
+  const auto kBlocks{(kCount + kQueriesPerBlock - 1) / kQueriesPerBlock};
+  std::vector<std::vector<std::size_t>> neighbours(kBlocks);
+  std::vector<std::size_t> ends(kCount);
+  report.Begin("radius");
+  zozibush::geometry::ParallelFor(
+      kBlocks, 1,
+      [&](std::size_t first_block, std::size_t last_block) {
+        std::vector<std::size_t> found;
+        for (auto block = first_block; block < last_block; ++block) {
+          const auto kEnd{std::min(kCount, (block + 1) * kQueriesPerBlock)};
+          for (auto i = block * kQueriesPerBlock; i < kEnd; ++i) {
+            kGrid.SearchRadius({kQueries.Data(0)[i], kQueries.Data(1)[i]},
+                               options.radius, found);
+            neighbours[block].insert(neighbours[block].end(), found.begin(),
+                                     found.end());
+            ends[i] = neighbours[block].size();
+          }
+        }
+      },
+      options.thread_count);
+  report.End(kCount);
+
+  Write(
+      writer, kCount,
+      [&](std::size_t i, std::string& line) {
+        const auto& kNeighbours{neighbours[i / kQueriesPerBlock]};
+        const auto kBegin{(i % kQueriesPerBlock == 0) ? 0 : ends[i - 1]};
+        AppendNumber(static_cast<uint64_t>(i), line);
+        line.push_back(' ');
+        AppendNumber(static_cast<uint64_t>(ends[i] - kBegin), line);
+        for (auto j = kBegin; j < ends[i]; ++j) {
+          line.push_back(' ');
+          AppendNumber(static_cast<uint64_t>(kNeighbours[j]), line);
+        }
+      },
+      options, report);
+}
+
+auto RunHull(const Options& options, const PointCloud<2, double>& points,
+             ResultWriter& writer, StageReport& report) -> void {
+  std::vector<std::size_t> hull;
+  report.Begin("hull");
+  zozibush::geometry::FindConvexHull(points, hull, options.thread_count);
+  report.End(points.Size());
+
+  Write(
+      writer, hull.size(),
+      [&](std::size_t i, std::string& line) {
+        AppendNumber(static_cast<uint64_t>(hull[i]), line);
+        line.push_back(' ');
+        AppendNumber(points.Data(0)[hull[i]], line);
+        line.push_back(' ');
+        AppendNumber(points.Data(1)[hull[i]], line);
+      },
+      options, report);
+}
+
+auto RunSimplify(const Options& options, const PointCloud<2, double>& points,
+                 ResultWriter& writer, StageReport& report) -> void {
+  std::vector<zozibush::geometry::Point2D> polyline(points.Size());
+  for (std::size_t i = 0; i < points.Size(); ++i) {
+    polyline[i] = {points.Data(0)[i], points.Data(1)[i]};
+  }
+  std::vector<zozibush::geometry::Point2D> simplified(polyline.size());
+  report.Begin("simplify");
+  zozibush::geometry::PolylineSimplifier simplifier(
+      zozibush::geometry::Distance(options.tolerance, options.unit),
+      options.unit);
+  simplified.resize(simplifier.Simplify(options.method, polyline.data(),
+                                        polyline.size(),
+                                        simplified.data()));
+  report.End(polyline.size());
+
+  Write(
+      writer, simplified.size(),
+      [&](std::size_t i, std::string& line) {
+        AppendNumber(simplified[i].GetX(), line);
+        line.push_back(' ');
+        AppendNumber(simplified[i].GetY(), line);
+      },
+      options, report);
+}
+
+auto RunDedup(const Options& options, const PointCloud<2, double>& points,
+              ResultWriter& writer, StageReport& report) -> void {
+  std::vector<std::size_t> kept;
+  report.Begin("dedup");
+  zozibush::geometry::PointDeduplicator(
+      zozibush::geometry::Distance(options.tolerance, options.unit),
+      options.unit)
+      .Deduplicate(points, kept, nullptr, options.thread_count);
+  report.End(points.Size());
+
+  Write(
+      writer, kept.size(),
+      [&](std::size_t i, std::string& line) {
+        AppendNumber(static_cast<uint64_t>(kept[i]), line);
+      },
+      options, report);
+}
+}  // namespace
+
+namespace zozibush::geometry::application {
+auto RunJob(const Options& options, StageReport& report) -> void {
+  // Open the output first, so that a bad path fails before the work.
+  ResultWriter writer(options.output_path);
+  const auto kPoints{Load(options.input_path, options, "load", report)};
+  if (options.job == "distance") {
+    RunDistance(options, kPoints, writer, report);
+  } else if (options.job == "nearest") {
+    RunNearest(options, kPoints, writer, report);
+  } else if (options.job == "radius") {
+    RunRadius(options, kPoints, writer, report);
+  } else if (options.job == "hull") {
+    RunHull(options, kPoints, writer, report);
+  } else if (options.job == "simplify") {
+    RunSimplify(options, kPoints, writer, report);
+  } else {
+    RunDedup(options, kPoints, writer, report);
+  }
+}
+}  // namespace zozibush::geometry::application
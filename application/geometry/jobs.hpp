@@ -0,0 +1,37 @@
+/**
+ * @file jobs.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Jobs of the geometry tool
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_APPLICATION_JOBS_HPP_
+#define ZOZIBUSH__GEOMETRY_APPLICATION_JOBS_HPP_
+
+#include "options.hpp"
+#include "stage_report.hpp"
+
+namespace zozibush::geometry::application {
+
+/**
+ * @brief Load the inputs, run the job and write its results
+ *
+ * Every job times its stages into report: load, then index for jobs that
+ * build a GridIndex, then the job itself, then write. Query points are
+ * loaded in a stage of their own named queries.
+ *
+ * @param options Parsed options
+ * @param report Stage report
+ * @throw std::invalid_argument If the inputs do not suit the job
+ * @throw std::runtime_error If reading or writing fails
+ */
+auto RunJob(const Options& options, StageReport& report) -> void;
+
+}  // namespace zozibush::geometry::application
+
+#endif  // ZOZIBUSH__GEOMETRY_APPLICATION_JOBS_HPP_
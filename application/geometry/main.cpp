@@ -0,0 +1,44 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include <cstdio>
+#include <exception>
+#include <stdexcept>
+
+#include "jobs.hpp"
+#include "options.hpp"
+#include "stage_report.hpp"
+
+namespace {
+constexpr int kUsageError{2};
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+  using zozibush::geometry::application::GetUsage;
+  using zozibush::geometry::application::Options;
+
+  Options options;
+  try {
+    options = zozibush::geometry::application::ParseOptions(argc, argv);
+  } catch (const std::invalid_argument& error) {
+    std::fprintf(stderr, "geometry: %s\n\n%s", error.what(),
+                 GetUsage().c_str());
+    return kUsageError;
+  }
+  if (options.help) {
+    std::fputs(GetUsage().c_str(), stdout);
+    return 0;
+  }
+
+  zozibush::geometry::application::StageReport report;
+  try {
+    zozibush::geometry::application::RunJob(options, report);
+  } catch (const std::exception& error) {
+    std::fprintf(stderr, "geometry: %s\n", error.what());
+    return 1;
+  }
+  if (!options.quiet) {
+    report.Print(stderr);
+  }
+  return 0;
+}
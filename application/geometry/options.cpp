@@ -0,0 +1,234 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "options.hpp"
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <utility>
+
+namespace {
+using zozibush::geometry::Distance;
+
+constexpr std::array<std::pair<std::string_view, Distance::Type>, 6> kUnits{{
+    {"km", Distance::Type::kKilometer},
+    {"m", Distance::Type::kMeter},
+    {"cm", Distance::Type::kCentimeter},
+    {"mm", Distance::Type::kMillimeter},
+    {"um", Distance::Type::kMicrometer},
+    {"nm", Distance::Type::kNanometer},
+}};
+constexpr std::array<std::string_view, 6> kJobs{
+    "distance", "nearest", "radius", "hull", "simplify", "dedup"};
+
+auto ParseUnit(std::string_view text) -> Distance::Type {
+  for (const auto& [kName, kType] : kUnits) {
+    if (text == kName) {
+      return kType;
+    }
+  }
+  throw std::invalid_argument("unknown unit '" + std::string(text) + "'");
+}
+
+// Parses a whole value; from_chars reports how much of text it used.
+auto ParseDouble(std::string_view text, std::string_view option) -> double {
+  double value{0.0};
+  const auto* end{text.data() + text.size()};
+  const auto [kLast, kError] = std::from_chars(text.data(), end, value);
+  if (kError != std::errc() || kLast != end || !std::isfinite(value)) {
+    throw std::invalid_argument("malformed value '" + std::string(text) +
+                                "' of " + std::string(option));
+  }
+  return value;
+}
+
+auto ParseCount(std::string_view text, std::string_view option)
+    -> std::size_t {
+  std::size_t value{0};
+  const auto* end{text.data() + text.size()};
+  const auto [kLast, kError] = std::from_chars(text.data(), end, value);
+  if (kError != std::errc() || kLast != end) {
+    throw std::invalid_argument("malformed value '" + std::string(text) +
+                                "' of " + std::string(option));
+  }
+  return value;
+}
+
+// A length with an optional unit suffix, in the coordinate unit.
+auto ParseLength(std::string_view text, std::string_view option,
+                 Distance::Type unit) -> double {
+  const auto kSuffix{text.find_first_not_of("0123456789.+-eE")};
+  if (kSuffix == std::string_view::npos) {
+    return ParseDouble(text, option);
+  }
+  const auto kValue{ParseDouble(text.substr(0, kSuffix), option)};
+  if (kValue < 0.0) {
+    throw std::invalid_argument(std::string(option) + " is negative");
+  }
+  return Distance(kValue, ParseUnit(text.substr(kSuffix))).GetValue(unit);
+}
+
+auto ParsePoint(std::string_view text, std::string_view option)
+    -> std::pair<double, double> {
+  const auto kComma{text.find(',')};
+  if (kComma == std::string_view::npos) {
+    throw std::invalid_argument(std::string(option) + " is not x,y");
+  }
+  return {ParseDouble(text.substr(0, kComma), option),
+          ParseDouble(text.substr(kComma + 1), option)};
+}
+}  // namespace
+
+namespace zozibush::geometry::application {
+auto ParseOptions(int argc, const char* const* argv) -> Options {
+  Options options;
+  // Lengths are converted once the coordinate unit is known.
+  std::string radius;
+  std::string tolerance;
+  for (int i = 1; i < argc; ++i) {
+    std::string_view argument{argv[i]};
+    if (argument == "-h" || argument == "--help") {
+      options.help = true;
+      return options;
+    }
+    if (argument == "--quiet") {
+      options.quiet = true;
+      continue;
+    }
+    if (argument.substr(0, 2) != "--") {
+      if (!options.job.empty()) {
+        throw std::invalid_argument("unexpected argument '" +
+                                    std::string(argument) + "'");
+      }
+      options.job = argument;
+      continue;
+    }
+
+    std::string_view value;
+    const auto kEqual{argument.find('=')};
+    if (kEqual != std::string_view::npos) {
+      value = argument.substr(kEqual + 1);
+      argument = argument.substr(0, kEqual);
+    } else if (i + 1 < argc) {
+      value = argv[++i];
+    } else {
+      throw std::invalid_argument(std::string(argument) + " needs a value");
+    }
+
+    if (argument == "--input") {
+      options.input_path = value;
+    } else if (argument == "--queries") {
+      options.query_path = value;
+    } else if (argument == "--output") {
+      options.output_path = value;
+    } else if (argument == "--format") {
+      if (value == "text") {
+        options.input_format = PointFormat::kText;
+      } else if (value == "binary") {
+        options.input_format = PointFormat::kBinary;
+      } else {
+        throw std::invalid_argument("unknown format '" + std::string(value) +
+                                    "'");
+      }
+    } else if (argument == "--unit") {
+      options.unit = ParseUnit(value);
+    } else if (argument == "--query") {
+      std::tie(options.query_x, options.query_y) = ParsePoint(value, argument);
+      options.has_query_point = true;
+    } else if (argument == "--radius") {
+      radius = value;
+    } else if (argument == "--tolerance") {
+      tolerance = value;
+    } else if (argument == "--method") {
+      if (value == "dp") {
+        options.method = PolylineSimplifier::Method::kDouglasPeucker;
+      } else if (value == "vw") {
+        options.method = PolylineSimplifier::Method::kVisvalingamWhyatt;
+      } else {
+        throw std::invalid_argument("unknown method '" + std::string(value) +
+                                    "'");
+      }
+    } else if (argument == "--threads") {
+      options.thread_count = ParseCount(value, argument);
+    } else {
+      throw std::invalid_argument("unknown option '" + std::string(argument) +
+                                  "'");
+    }
+  }
+
+  if (options.job.empty()) {
+    throw std::invalid_argument("no job given");
+  }
+  bool known{false};
+  for (const auto kJob : kJobs) {
+    known = known || options.job == kJob;
+  }
+  if (!known) {
+    throw std::invalid_argument("unknown job '" + options.job + "'");
+  }
+  if (options.input_path.empty()) {
+    throw std::invalid_argument("--input is required");
+  }
+  if (!radius.empty()) {
+    options.radius = ParseLength(radius, "--radius", options.unit);
+  }
+  if (!tolerance.empty()) {
+    options.tolerance = ParseLength(tolerance, "--tolerance", options.unit);
+  }
+  if (options.job == "distance" && options.has_query_point ==
+                                       !options.query_path.empty()) {
+    throw std::invalid_argument("distance needs one of --query, --queries");
+  }
+  if ((options.job == "nearest" || options.job == "radius") &&
+      options.query_path.empty()) {
+    throw std::invalid_argument(options.job + " needs --queries");
+  }
+  if (options.job == "radius" && !(options.radius > 0.0)) {
+    throw std::invalid_argument("radius needs a positive --radius");
+  }
+  if (options.tolerance < 0.0 || options.radius < 0.0) {
+    throw std::invalid_argument("lengths must not be negative");
+  }
+  return options;
+}
+
+auto GetUsage() -> std::string {
+  return R"(Usage: geometry <job> --input <file> [options]
+
+Jobs, one result line per item:
+  distance  --query x,y: "index distance" to every input point
+            --queries f: "index distance" between points of equal index
+  nearest   --queries f: "query index distance" of the nearest input point
+  radius    --queries f --radius r: "query count index..." of the input
+            points within r, indices ascending
+  hull      "index x y" of the convex hull, counter-clockwise
+  simplify  --tolerance t [--method dp|vw]: "x y" of the input simplified
+            as one polyline
+  dedup     --tolerance t: "index" of the first input point of every
+            tolerance-sized grid cell, 0 for exact duplicates
+
+Options:
+  --input f       Input points, - for stdin
+  --queries f     Query points, same format as the input
+  --format fmt    text (one "x y" or "x,y" per line, # comments) or binary
+                  (interleaved x, y doubles); default binary for .bin files
+  --output f      Result file, - for stdout (default)
+  --unit u        Coordinate unit: km, m (default), cm, mm, um or nm
+  --radius r      Length in the coordinate unit, or with a unit suffix
+  --tolerance t   Length in the coordinate unit, or with a unit suffix
+  --threads n     Worker threads, 0 for all hardware threads (default)
+  --quiet         Do not print the stage report
+  -h, --help      Print this text
+
+The stage report goes to stderr: seconds, items, items/s, MB and MB/s of
+every stage.
+)";
+}
+}  // namespace zozibush::geometry::application
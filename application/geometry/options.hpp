@@ -0,0 +1,69 @@
+/**
+ * @file options.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Command-line options of the geometry tool
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_APPLICATION_OPTIONS_HPP_
+#define ZOZIBUSH__GEOMETRY_APPLICATION_OPTIONS_HPP_
+
+#include <cstddef>
+#include <string>
+
+#include "geometry/distance.hpp"
+#include "geometry/polyline_simplifier.hpp"
+#include "point_io.hpp"
+
+namespace zozibush::geometry::application {
+
+/**
+ * @brief Parsed command line
+ *
+ * Lengths given on the command line may carry a unit suffix (km, m, cm,
+ * mm, um, nm) and are stored converted to the coordinate unit.
+ */
+struct Options {
+  std::string job;                 ///< Job name
+  std::string input_path;          ///< Input points, "-" for stdin
+  std::string query_path;          ///< Query points, empty if not given
+  std::string output_path{"-"};    ///< Results, "-" for stdout
+  PointFormat input_format{PointFormat::kAuto};  ///< Format of both inputs
+  Distance::Type unit{Distance::Type::kMeter};   ///< Coordinate unit
+  bool has_query_point{false};     ///< Whether --query was given
+  double query_x{0.0};             ///< x of --query
+  double query_y{0.0};             ///< y of --query
+  double radius{0.0};              ///< Radius in coordinate unit
+  double tolerance{0.0};           ///< Tolerance in coordinate unit
+  PolylineSimplifier::Method method{
+      PolylineSimplifier::Method::kDouglasPeucker};  ///< Simplification
+  std::size_t thread_count{0};     ///< Threads, 0 for all hardware threads
+  bool quiet{false};               ///< Whether to skip the stage report
+  bool help{false};                ///< Whether to print the usage only
+};
+
+/**
+ * @brief Parse the command line
+ * @param argc Number of arguments
+ * @param argv Arguments, argv[0] is the program name
+ * @return Options Parsed options
+ * @throw std::invalid_argument If an option is unknown, misses its value or
+ * has a malformed value, or a job misses a required option
+ */
+[[nodiscard]] auto ParseOptions(int argc, const char* const* argv)
+    -> Options;
+
+/**
+ * @brief Get the usage text
+ * @return std::string Usage text, ending with a newline
+ */
+[[nodiscard]] auto GetUsage() -> std::string;
+
+}  // namespace zozibush::geometry::application
+
+#endif  // ZOZIBUSH__GEOMETRY_APPLICATION_OPTIONS_HPP_
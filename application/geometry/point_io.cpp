@@ -0,0 +1,214 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "point_io.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "geometry/parallel.hpp"
+
+namespace {
+constexpr std::size_t kReadSize{std::size_t{1} << 20U};
+constexpr std::size_t kLinesPerBlock{4096};
+constexpr std::size_t kBlocksPerChunk{64};
+
+auto ReadFile(const std::string& path) -> std::string {
+  auto* file{(path == "-") ? stdin : std::fopen(path.c_str(), "rb")};
+  if (file == nullptr) {
+    throw std::runtime_error("cannot open " + path);
+  }
+  std::string content;
+  std::size_t size{0};
+  do {
+    content.resize(size + kReadSize);
+    size += std::fread(&content[size], 1, kReadSize, file);
+  } while (size == content.size());
+  content.resize(size);
+  const auto kFailed{std::ferror(file) != 0};
+  if (file != stdin) {
+    std::fclose(file);
+  }
+  if (kFailed) {
+    throw std::runtime_error("cannot read " + path);
+  }
+  return content;
+}
+
+auto IsSpace(char character) -> bool {
+  return character == ' ' || character == '\t' || character == '\r';
+}
+
+// Lines hold "x y" or "x,y" with optional blanks around either number;
+// everything from # to the end of the line is a comment.
+auto ParseText(const std::string& content, const std::string& path,
+               zozibush::geometry::PointCloud<2, double>& points) -> void {
+  const auto* cursor{content.data()};
+  const auto* const kEnd{content.data() + content.size()};
+  std::size_t line{0};
+  std::vector<double> x_values;
+  std::vector<double> y_values;
+  while (cursor < kEnd) {
+    ++line;
+    const auto* line_end{static_cast<const char*>(
+        std::memchr(cursor, '\n', static_cast<std::size_t>(kEnd - cursor)))};
+    if (line_end == nullptr) {
+      line_end = kEnd;
+    }
+    const auto* comment{static_cast<const char*>(std::memchr(
+        cursor, '#', static_cast<std::size_t>(line_end - cursor)))};
+    const auto* const kContentEnd{(comment != nullptr) ? comment : line_end};
+
+    while (cursor < kContentEnd && IsSpace(*cursor)) {
+      ++cursor;
+    }
+    if (cursor != kContentEnd) {
+      double values[2]{0.0, 0.0};
+      for (auto& value : values) {
+        const auto [kLast, kError] =
+            std::from_chars(cursor, kContentEnd, value);
+        if (kError != std::errc()) {
+          throw std::runtime_error(path + ":" + std::to_string(line) +
+                                   ": malformed point");
+        }
+        cursor = kLast;
+        while (cursor < kContentEnd && IsSpace(*cursor)) {
+          ++cursor;
+        }
+        if (cursor < kContentEnd && *cursor == ',' && &value == values) {
+          ++cursor;
+          while (cursor < kContentEnd && IsSpace(*cursor)) {
+            ++cursor;
+          }
+        }
+      }
+      if (cursor != kContentEnd) {
+        throw std::runtime_error(path + ":" + std::to_string(line) +
+                                 ": trailing characters");
+      }
+      x_values.push_back(values[0]);
+      y_values.push_back(values[1]);
+    }
+    cursor = line_end + 1;
+  }
+
+  points.Resize(x_values.size());
+  std::copy(x_values.begin(), x_values.end(), points.Data(0));
+  std::copy(y_values.begin(), y_values.end(), points.Data(1));
+}
+
+auto ParseBinary(const std::string& content, const std::string& path,
+                 zozibush::geometry::PointCloud<2, double>& points) -> void {
+  constexpr std::size_t kPointSize{2 * sizeof(double)};
+  if (content.size() % kPointSize != 0) {
+    throw std::runtime_error(path + ": size is not a multiple of " +
+                             std::to_string(kPointSize) + " bytes");
+  }
+  const auto kCount{content.size() / kPointSize};
+  points.Resize(kCount);
+  auto* x_values{points.Data(0)};
+  auto* y_values{points.Data(1)};
+  for (std::size_t i = 0; i < kCount; ++i) {
+    std::memcpy(&x_values[i], &content[i * kPointSize], sizeof(double));
+    std::memcpy(&y_values[i], &content[i * kPointSize + sizeof(double)],
+                sizeof(double));
+  }
+}
+}  // namespace
+
+namespace zozibush::geometry::application {
+auto ReadPoints(const std::string& path, PointFormat format,
+                PointCloud<2, double>& points) -> std::size_t {
+  if (format == PointFormat::kAuto) {
+    const auto kBinary{path.size() > 4 &&
+                       path.compare(path.size() - 4, 4, ".bin") == 0};
+    format = kBinary ? PointFormat::kBinary : PointFormat::kText;
+  }
+  const auto kContent{ReadFile(path)};
+  points.Clear();
+  if (format == PointFormat::kBinary) {
+    ParseBinary(kContent, path, points);
+  } else {
+    ParseText(kContent, path, points);
+  }
+  return kContent.size();
+}
+
+auto AppendNumber(double value, std::string& line) -> void {
+  char buffer[32];
+  const auto kResult{std::to_chars(buffer, buffer + sizeof(buffer), value)};
+  line.append(buffer, kResult.ptr);
+}
+auto AppendNumber(uint64_t value, std::string& line) -> void {
+  char buffer[24];
+  const auto kResult{std::to_chars(buffer, buffer + sizeof(buffer), value)};
+  line.append(buffer, kResult.ptr);
+}
+
+ResultWriter::ResultWriter(const std::string& path) {
+  if (path == "-") {
+    file_ = stdout;
+  } else {
+    file_ = std::fopen(path.c_str(), "wb");
+    owned_ = true;
+  }
+  if (file_ == nullptr) {
+    throw std::runtime_error("cannot open " + path);
+  }
+}
+ResultWriter::~ResultWriter() {
+  if (owned_) {
+    std::fclose(file_);
+  } else {
+    std::fflush(file_);
+  }
+}
+
+auto ResultWriter::WriteLines(
+    std::size_t count,
+    const std::function<void(std::size_t, std::string&)>& format,
+    std::size_t thread_count) -> void {
+  std::vector<std::string> blocks(kBlocksPerChunk);
+  for (std::size_t chunk = 0; chunk < count;
+       chunk += kLinesPerBlock * kBlocksPerChunk) {
+    const auto kChunkEnd{
+        std::min(count, chunk + kLinesPerBlock * kBlocksPerChunk)};
+    const auto kBlockCount{(kChunkEnd - chunk + kLinesPerBlock - 1) /
+                           kLinesPerBlock};
+    ParallelFor(
+        kBlockCount, 1,
+        [&](std::size_t first_block, std::size_t last_block) {
+          for (auto block = first_block; block < last_block; ++block) {
+            auto& text{blocks[block]};
+            text.clear();
+            const auto kBegin{chunk + block * kLinesPerBlock};
+            const auto kEnd{std::min(kChunkEnd, kBegin + kLinesPerBlock)};
+            for (auto i = kBegin; i < kEnd; ++i) {
+              format(i, text);
+              text.push_back('\n');
+            }
+          }
+        },
+        thread_count);
+    for (std::size_t block = 0; block < kBlockCount; ++block) {
+      const auto& text{blocks[block]};
+      if (std::fwrite(text.data(), 1, text.size(), file_) != text.size()) {
+        throw std::runtime_error("cannot write results");
+      }
+      byte_count_ += text.size();
+    }
+  }
+  if (std::fflush(file_) != 0) {
+    throw std::runtime_error("cannot write results");
+  }
+}
+auto ResultWriter::GetByteCount() const -> std::size_t { return byte_count_; }
+}  // namespace zozibush::geometry::application
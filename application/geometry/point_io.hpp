@@ -0,0 +1,114 @@
+/**
+ * @file point_io.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Point file reading and buffered result writing
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_APPLICATION_POINT_IO_HPP_
+#define ZOZIBUSH__GEOMETRY_APPLICATION_POINT_IO_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+
+#include "geometry/point_cloud.hpp"
+
+namespace zozibush::geometry::application {
+
+/**
+ * @brief The enum class for point file format.
+ */
+enum class PointFormat {
+  kAuto = 0,    ///< Binary for a .bin file, text otherwise
+  kText = 1,    ///< One "x y" or "x,y" pair per line, # starts a comment
+  kBinary = 2,  ///< Interleaved x, y doubles in native byte order
+};
+
+/**
+ * @brief Read a point file
+ * @param path File path, "-" for stdin
+ * @param format File format
+ * @param points Cleared, then filled with the points
+ * @return std::size_t Number of bytes read
+ * @throw std::runtime_error If the file cannot be read or is malformed
+ */
+auto ReadPoints(const std::string& path, PointFormat format,
+                PointCloud<2, double>& points) -> std::size_t;
+
+/**
+ * @brief Append the shortest round-trip text of a value
+ * @param value Value
+ * @param line Line being built
+ */
+auto AppendNumber(double value, std::string& line) -> void;
+/**
+ * @brief Append the text of an integer
+ * @param value Value
+ * @param line Line being built
+ */
+auto AppendNumber(uint64_t value, std::string& line) -> void;
+
+/**
+ * @brief Result file fed with numbered lines
+ *
+ * Lines are formatted in parallel into per-block buffers and written in
+ * order, one bounded chunk at a time, so formatting scales with threads and
+ * memory stays independent of the number of lines.
+ */
+class ResultWriter {
+ public:
+  /**
+   * @brief Open a result file
+   * @param path File path, "-" for stdout
+   * @throw std::runtime_error If the file cannot be opened
+   */
+  explicit ResultWriter(const std::string& path);
+  /**
+   * @brief Copy constructor, deleted
+   */
+  ResultWriter(const ResultWriter&) = delete;
+  /**
+   * @brief Copy assignment operator, deleted
+   * @return ResultWriter& Reference of ResultWriter object
+   */
+  auto operator=(const ResultWriter&) -> ResultWriter& = delete;
+  /**
+   * @brief Close the file unless it is stdout
+   */
+  ~ResultWriter();
+
+  /**
+   * @brief Format and write lines
+   * @param count Number of lines
+   * @param format Called as format(index, line) to append line index
+   * without its newline
+   * @param thread_count Number of threads, 0 for all hardware threads
+   * @throw std::runtime_error If writing fails
+   */
+  auto WriteLines(std::size_t count,
+                  const std::function<void(std::size_t, std::string&)>& format,
+                  std::size_t thread_count) -> void;
+  /**
+   * @brief Get the number of bytes written so far
+   * @return std::size_t Number of bytes
+   */
+  [[nodiscard]] auto GetByteCount() const -> std::size_t;
+
+ protected:
+ private:
+  std::FILE* file_{nullptr};   ///< Output stream
+  bool owned_{false};          ///< Whether file_ is closed on destruction
+  std::size_t byte_count_{0};  ///< Bytes written
+};
+
+}  // namespace zozibush::geometry::application
+
+#endif  // ZOZIBUSH__GEOMETRY_APPLICATION_POINT_IO_HPP_
@@ -0,0 +1,52 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "stage_report.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+namespace {
+constexpr double kBytesPerMegabyte{1.0e+6};
+
+auto PrintRow(std::FILE* stream, const std::string& name, double seconds,
+              std::size_t items, std::size_t bytes) -> void {
+  const auto kPerSecond{[&](double value) {
+    return (seconds > 0.0) ? value / seconds : 0.0;
+  }};
+  const auto kMegabytes{static_cast<double>(bytes) / kBytesPerMegabyte};
+  std::fprintf(stream, "%-10s %10.4f %12zu %12.4g %10.2f %10.2f\n",
+               name.c_str(), seconds, items,
+               kPerSecond(static_cast<double>(items)), kMegabytes,
+               kPerSecond(kMegabytes));
+}
+}  // namespace
+
+namespace zozibush::geometry::application {
+auto StageReport::Begin(const std::string& name) -> void {
+  current_ = name;
+  start_ = std::chrono::steady_clock::now();
+}
+auto StageReport::End(std::size_t items, std::size_t bytes) -> void {
+  const std::chrono::duration<double> kElapsed{
+      std::chrono::steady_clock::now() - start_};
+  stages_.push_back({current_, kElapsed.count(), items, bytes});
+}
+
+auto StageReport::Print(std::FILE* stream) const -> void {
+  std::fprintf(stream, "%-10s %10s %12s %12s %10s %10s\n", "stage", "seconds",
+               "items", "items/s", "MB", "MB/s");
+  double seconds{0.0};
+  std::size_t bytes{0};
+  for (const auto& stage : stages_) {
+    PrintRow(stream, stage.name, stage.seconds, stage.items, stage.bytes);
+    seconds += stage.seconds;
+    bytes += stage.bytes;
+  }
+  // Items of different stages do not add up; the total counts the first.
+  PrintRow(stream, "total", seconds,
+           stages_.empty() ? 0 : stages_.front().items, bytes);
+}
+}  // namespace zozibush::geometry::application
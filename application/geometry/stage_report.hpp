@@ -0,0 +1,65 @@
+/**
+ * @file stage_report.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Per-stage timing and throughput report
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_APPLICATION_STAGE_REPORT_HPP_
+#define ZOZIBUSH__GEOMETRY_APPLICATION_STAGE_REPORT_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace zozibush::geometry::application {
+
+/**
+ * @brief Wall-clock time, item and byte counts of the stages of a job
+ */
+class StageReport {
+ public:
+  /**
+   * @brief Start timing a stage
+   * @param name Stage name
+   */
+  auto Begin(const std::string& name) -> void;
+  /**
+   * @brief Stop timing the current stage
+   * @param items Number of points, queries or lines processed
+   * @param bytes Number of bytes read or written, 0 if none
+   */
+  auto End(std::size_t items, std::size_t bytes = 0) -> void;
+  /**
+   * @brief Print one row per stage and a total row
+   *
+   * Columns are seconds, items, items/s, MB and MB/s, with MB = 10^6 bytes.
+   *
+   * @param stream Output stream
+   */
+  auto Print(std::FILE* stream) const -> void;
+
+ protected:
+ private:
+  struct Stage {
+    std::string name;       ///< Stage name
+    double seconds{0.0};    ///< Wall-clock time
+    std::size_t items{0};   ///< Items processed
+    std::size_t bytes{0};   ///< Bytes read or written
+  };
+
+  std::vector<Stage> stages_;  ///< Finished stages
+  std::string current_;        ///< Name of the running stage
+  std::chrono::steady_clock::time_point start_;  ///< Start of the stage
+};
+
+}  // namespace zozibush::geometry::application
+
+#endif  // ZOZIBUSH__GEOMETRY_APPLICATION_STAGE_REPORT_HPP_
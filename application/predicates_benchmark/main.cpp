@@ -0,0 +1,256 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "geometry/point_cloud.hpp"
+#include "geometry/predicates.hpp"
+
+namespace {
+using zozibush::geometry::Point2D;
+using zozibush::geometry::PointCloud;
+
+constexpr std::size_t kDefaultCount{std::size_t{1} << 20U};
+constexpr std::size_t kRepetitions{3};
+constexpr double kTwoPi{6.283185307179586};
+constexpr int kUsageError{2};
+
+// Shortest of a few runs, in nanoseconds per point.
+auto MeasureNs(const std::function<void()>& run, std::size_t count)
+    -> double {
+  auto best{std::chrono::nanoseconds::max()};
+  for (std::size_t i = 0; i < kRepetitions; ++i) {
+    const auto kStart{std::chrono::steady_clock::now()};
+    run();
+    best = std::min(best, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now() - kStart));
+  }
+  return static_cast<double>(best.count()) / static_cast<double>(count);
+}
+
+auto ToSign(double value) -> int8_t {
+  return static_cast<int8_t>((value > 0.0) - (value < 0.0));
+}
+
+auto CountMismatches(const std::vector<int8_t>& lhs,
+                     const std::vector<int8_t>& rhs) -> std::size_t {
+  std::size_t count{0};
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    count += (lhs[i] != rhs[i]) ? 1 : 0;
+  }
+  return count;
+}
+
+auto PrintRow(const char* predicate, const char* input, const char* method,
+              double ns, double baseline_ns, std::size_t wrong) -> void {
+  std::printf("%-10s %-12s %-10s %10.2f %9.2fx %12zu\n", predicate, input,
+              method, ns, ns / baseline_ns, wrong);
+}
+
+auto NaiveOrient2D(double ax, double ay, double bx, double by, double cx,
+                   double cy) -> double {
+  return (ax - cx) * (by - cy) - (ay - cy) * (bx - cx);
+}
+
+auto NaiveInCircle(double ax, double ay, double bx, double by, double cx,
+                   double cy, double dx, double dy) -> double {
+  const auto kAdx{ax - dx};
+  const auto kAdy{ay - dy};
+  const auto kBdx{bx - dx};
+  const auto kBdy{by - dy};
+  const auto kCdx{cx - dx};
+  const auto kCdy{cy - dy};
+  return (kAdx * kAdx + kAdy * kAdy) * (kBdx * kCdy - kCdx * kBdy) +
+         (kBdx * kBdx + kBdy * kBdy) * (kCdx * kAdy - kAdx * kCdy) +
+         (kCdx * kCdx + kCdy * kCdy) * (kAdx * kBdy - kBdx * kAdy);
+}
+
+auto BenchmarkOrient2D(const char* input, const Point2D& a, const Point2D& b,
+                       const PointCloud<2, double>& points) -> void {
+  const auto kCount{points.Size()};
+  const auto* x_values{points.Data(0)};
+  const auto* y_values{points.Data(1)};
+  const auto kAx{a.GetX()};
+  const auto kAy{a.GetY()};
+  const auto kBx{b.GetX()};
+  const auto kBy{b.GetY()};
+  std::vector<int8_t> robust(kCount);
+  std::vector<int8_t> signs(kCount);
+
+  const auto kNaiveNs{MeasureNs(
+      [&] {
+        for (std::size_t i = 0; i < kCount; ++i) {
+          signs[i] = ToSign(
+              NaiveOrient2D(kAx, kAy, kBx, kBy, x_values[i], y_values[i]));
+        }
+      },
+      kCount)};
+  const auto kRobustNs{MeasureNs(
+      [&] {
+        for (std::size_t i = 0; i < kCount; ++i) {
+          robust[i] = ToSign(zozibush::geometry::Orient2D(
+              kAx, kAy, kBx, kBy, x_values[i], y_values[i]));
+        }
+      },
+      kCount)};
+  PrintRow("orient2d", input, "naive", kNaiveNs, kNaiveNs,
+           CountMismatches(robust, signs));
+  PrintRow("orient2d", input, "filtered", kRobustNs, kNaiveNs, 0);
+
+  const auto kBatchNs{MeasureNs(
+      [&] { zozibush::geometry::Orient2D(a, b, points, signs.data(), 1); },
+      kCount)};
+  PrintRow("orient2d", input, "batch", kBatchNs, kNaiveNs,
+           CountMismatches(robust, signs));
+  const auto kExactNs{MeasureNs(
+      [&] {
+        for (std::size_t i = 0; i < kCount; ++i) {
+          signs[i] = ToSign(zozibush::geometry::internal::Orient2DExact(
+              kAx, kAy, kBx, kBy, x_values[i], y_values[i]));
+        }
+      },
+      kCount)};
+  PrintRow("orient2d", input, "exact", kExactNs, kNaiveNs,
+           CountMismatches(robust, signs));
+
+  std::size_t filtered{0};
+  for (std::size_t i = 0; i < kCount; ++i) {
+    const auto kLeft{(kAx - x_values[i]) * (kBy - y_values[i])};
+    const auto kRight{(kAy - y_values[i]) * (kBx - x_values[i])};
+    const auto kBound{zozibush::geometry::internal::kOrientErrorBound *
+                      (std::abs(kLeft) + std::abs(kRight))};
+    filtered += (std::abs(kLeft - kRight) >= kBound) ? 1 : 0;
+  }
+  std::printf("%-10s %-12s decided by the filter: %.2f%%\n\n", "orient2d",
+              input,
+              100.0 * static_cast<double>(filtered) /
+                  static_cast<double>(kCount));
+}
+
+auto BenchmarkInCircle(const char* input, const Point2D& a, const Point2D& b,
+                       const Point2D& c, const PointCloud<2, double>& points)
+    -> void {
+  const auto kCount{points.Size()};
+  const auto* x_values{points.Data(0)};
+  const auto* y_values{points.Data(1)};
+  const double kValues[] = {a.GetX(), a.GetY(), b.GetX(),
+                            b.GetY(), c.GetX(), c.GetY()};
+  std::vector<int8_t> robust(kCount);
+  std::vector<int8_t> signs(kCount);
+
+  const auto kNaiveNs{MeasureNs(
+      [&] {
+        for (std::size_t i = 0; i < kCount; ++i) {
+          signs[i] = ToSign(NaiveInCircle(kValues[0], kValues[1], kValues[2],
+                                          kValues[3], kValues[4], kValues[5],
+                                          x_values[i], y_values[i]));
+        }
+      },
+      kCount)};
+  const auto kRobustNs{MeasureNs(
+      [&] {
+        for (std::size_t i = 0; i < kCount; ++i) {
+          robust[i] = ToSign(zozibush::geometry::InCircle(
+              kValues[0], kValues[1], kValues[2], kValues[3], kValues[4],
+              kValues[5], x_values[i], y_values[i]));
+        }
+      },
+      kCount)};
+  PrintRow("incircle", input, "naive", kNaiveNs, kNaiveNs,
+           CountMismatches(robust, signs));
+  PrintRow("incircle", input, "filtered", kRobustNs, kNaiveNs, 0);
+
+  const auto kBatchNs{MeasureNs(
+      [&] {
+        zozibush::geometry::InCircle(a, b, c, points, signs.data(), 1);
+      },
+      kCount)};
+  PrintRow("incircle", input, "batch", kBatchNs, kNaiveNs,
+           CountMismatches(robust, signs));
+  const auto kExactNs{MeasureNs(
+      [&] {
+        for (std::size_t i = 0; i < kCount; ++i) {
+          signs[i] = ToSign(zozibush::geometry::internal::InCircleExact(
+              kValues[0], kValues[1], kValues[2], kValues[3], kValues[4],
+              kValues[5], x_values[i], y_values[i]));
+        }
+      },
+      kCount)};
+  PrintRow("incircle", input, "exact", kExactNs, kNaiveNs,
+           CountMismatches(robust, signs));
+  std::printf("\n");
+}
+
+auto MakeUniform(std::mt19937_64& engine, std::size_t count)
+    -> PointCloud<2, double> {
+  std::uniform_real_distribution<double> coordinate(-1.0, 1.0);
+  PointCloud<2, double> points;
+  points.Resize(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    points.Data(0)[i] = coordinate(engine);
+    points.Data(1)[i] = coordinate(engine);
+  }
+  return points;
+}
+
+// Points rounded onto the line ab.
+auto MakeNearLine(std::mt19937_64& engine, const Point2D& a, const Point2D& b,
+                  std::size_t count) -> PointCloud<2, double> {
+  std::uniform_real_distribution<double> parameter(-0.5, 1.5);
+  PointCloud<2, double> points;
+  points.Resize(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto kT{parameter(engine)};
+    points.Data(0)[i] = a.GetX() + kT * (b.GetX() - a.GetX());
+    points.Data(1)[i] = a.GetY() + kT * (b.GetY() - a.GetY());
+  }
+  return points;
+}
+
+// Points rounded onto the unit circle.
+auto MakeNearCircle(std::mt19937_64& engine, std::size_t count)
+    -> PointCloud<2, double> {
+  std::uniform_real_distribution<double> angle(0.0, kTwoPi);
+  PointCloud<2, double> points;
+  points.Resize(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto kAngle{angle(engine)};
+    points.Data(0)[i] = std::cos(kAngle);
+    points.Data(1)[i] = std::sin(kAngle);
+  }
+  return points;
+}
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+  const std::size_t kCount{
+      (argc == 2) ? std::strtoul(argv[1], nullptr, 10) : kDefaultCount};
+  if (argc > 2 || kCount == 0) {
+    std::fprintf(stderr, "usage: predicates_benchmark [point count]\n");
+    return kUsageError;
+  }
+
+  std::mt19937_64 engine(7U);
+  const Point2D kA(0.1, 0.3);
+  const Point2D kB(0.7, -0.9);
+  std::printf("%-10s %-12s %-10s %10s %10s %12s\n", "predicate", "input",
+              "method", "ns/call", "vs naive", "wrong signs");
+  BenchmarkOrient2D("uniform", kA, kB, MakeUniform(engine, kCount));
+  BenchmarkOrient2D("near line", kA, kB, MakeNearLine(engine, kA, kB, kCount));
+
+  const Point2D kP(std::cos(0.3), std::sin(0.3));
+  const Point2D kQ(std::cos(2.1), std::sin(2.1));
+  const Point2D kR(std::cos(4.4), std::sin(4.4));
+  BenchmarkInCircle("uniform", kP, kQ, kR, MakeUniform(engine, kCount));
+  BenchmarkInCircle("near circle", kP, kQ, kR, MakeNearCircle(engine, kCount));
+  return 0;
+}
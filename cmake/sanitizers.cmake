@@ -0,0 +1,33 @@
+# ! Sanitizer builds, e.g. cmake -S . -B build_asan -DGEOMETRY_SANITIZER=address
+set(GEOMETRY_SANITIZER "" CACHE STRING
+  "Sanitizer to build everything with: address, thread or undefined")
+set_property(CACHE GEOMETRY_SANITIZER PROPERTY STRINGS
+  "" address thread undefined)
+
+if(GEOMETRY_SANITIZER)
+  if(NOT GEOMETRY_SANITIZER MATCHES "^(address|thread|undefined)$")
+    message(FATAL_ERROR
+      "GEOMETRY_SANITIZER must be address, thread or undefined, "
+      "not ${GEOMETRY_SANITIZER}")
+  endif()
+
+  if(CMAKE_CXX_COMPILER_ID STREQUAL "MSVC")
+    if(NOT GEOMETRY_SANITIZER STREQUAL "address")
+      message(FATAL_ERROR "MSVC only supports GEOMETRY_SANITIZER=address")
+    endif()
+    set(SANITIZER_FLAGS "/fsanitize=address")
+  else()
+    set(SANITIZER_FLAGS
+      "-fsanitize=${GEOMETRY_SANITIZER} -fno-omit-frame-pointer -g")
+    # Make every report fail the test instead of printing and going on.
+    if(GEOMETRY_SANITIZER STREQUAL "undefined")
+      string(APPEND SANITIZER_FLAGS " -fno-sanitize-recover=undefined")
+    endif()
+  endif()
+
+  string(APPEND CMAKE_CXX_FLAGS " ${SANITIZER_FLAGS}")
+  string(APPEND CMAKE_EXE_LINKER_FLAGS " ${SANITIZER_FLAGS}")
+  string(APPEND CMAKE_SHARED_LINKER_FLAGS " ${SANITIZER_FLAGS}")
+  message(STATUS "Sanitizer: ${GEOMETRY_SANITIZER}")
+  message(STATUS "")
+endif()
@@ -0,0 +1,24 @@
+# ! Test executables of test/unit and test/differential
+# add_test_executable(NAME SOURCE [EXTRA_SOURCES...]) builds NAME from
+# SOURCE.cpp, the extra sources and the shared gtest main, and adds it as a
+# test.
+function(add_test_executable EXECUTABLE_NAME SOURCE_FILES)
+  add_executable(${EXECUTABLE_NAME}
+    ${SOURCE_FILES}.cpp
+    ${ARGN}
+    ${${PROJECT_NAME}_TEST_PATH}/unit/main.cpp
+  )
+  target_link_libraries(${EXECUTABLE_NAME} PRIVATE
+    ${GTest_LIBRARIES}
+    ${PROJECT_NAME}
+  )
+
+  add_test(NAME ${EXECUTABLE_NAME} COMMAND
+    ${CMAKE_CURRENT_BINARY_DIR}/${EXECUTABLE_NAME}
+    --gtest_color=yes
+  )
+  # An empty cache path keeps the tuning cache out of HOME.
+  set_tests_properties(${EXECUTABLE_NAME} PROPERTIES
+    ENVIRONMENT "GEOMETRY_TUNING_CACHE="
+  )
+endfunction()
@@ -0,0 +1,248 @@
+/**
+ * @file geometry/atomic_distance.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Lock-free distance accumulators declaration
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_ATOMIC_DISTANCE_HPP_
+#define ZOZIBUSH__GEOMETRY_ATOMIC_DISTANCE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "geometry/distance.hpp"
+
+namespace zozibush::geometry {
+
+/**
+ * @brief Distance that can be updated from several threads without a lock.
+ *
+ * The value is kept as std::atomic<int64_t> nanometers, so additions are exact
+ * and never go through double. Arithmetic wraps on int64_t overflow.
+ */
+class AtomicDistance {
+ public:
+  /**
+   * @brief Construct a new AtomicDistance object with zero distance.
+   */
+  AtomicDistance() = default;
+  /**
+   * @brief Construct with initial distance.
+   * @param initial The initial distance.
+   */
+  explicit AtomicDistance(const Distance& initial);
+
+  AtomicDistance(const AtomicDistance& other) = delete;
+  AtomicDistance(AtomicDistance&& other) = delete;
+  auto operator=(const AtomicDistance& other) -> AtomicDistance& = delete;
+  auto operator=(AtomicDistance&& other) -> AtomicDistance& = delete;
+
+  /**
+   * @brief Destroy the AtomicDistance object.
+   */
+  ~AtomicDistance() = default;
+
+  /**
+   * @brief Check whether the underlying atomic is lock-free on this platform.
+   * @return true If lock-free.
+   * @return false If the platform emulates the atomic with a lock.
+   */
+  [[nodiscard]] auto IsLockFree() const -> bool;
+
+  /**
+   * @brief Read the current distance.
+   * @param order The memory order.
+   * @return Distance The current distance.
+   */
+  [[nodiscard]] auto Load(
+      std::memory_order order = std::memory_order_seq_cst) const -> Distance;
+  /**
+   * @brief Replace the current distance.
+   * @param desired The new distance.
+   * @param order The memory order.
+   */
+  auto Store(const Distance& desired,
+             std::memory_order order = std::memory_order_seq_cst) -> void;
+  /**
+   * @brief Replace the current distance and return the previous one.
+   * @param desired The new distance.
+   * @param order The memory order.
+   * @return Distance The previous distance.
+   */
+  auto Exchange(const Distance& desired,
+                std::memory_order order = std::memory_order_seq_cst)
+      -> Distance;
+
+  /**
+   * @brief Add a distance atomically.
+   * @param other The distance to add.
+   * @param order The memory order.
+   * @return Distance The distance before the addition.
+   */
+  auto FetchAdd(const Distance& other,
+                std::memory_order order = std::memory_order_seq_cst)
+      -> Distance;
+  /**
+   * @brief Subtract a distance atomically.
+   * @param other The distance to subtract.
+   * @param order The memory order.
+   * @return Distance The distance before the subtraction.
+   */
+  auto FetchSub(const Distance& other,
+                std::memory_order order = std::memory_order_seq_cst)
+      -> Distance;
+
+  /**
+   * @brief Replace the distance with desired if it still equals expected.
+   * @param expected The expected distance, updated to the current distance on
+   * failure.
+   * @param desired The new distance.
+   * @param order The memory order.
+   * @return true If replaced.
+   * @return false If the current distance differs from expected.
+   */
+  auto CompareExchange(Distance& expected, const Distance& desired,
+                       std::memory_order order = std::memory_order_seq_cst)
+      -> bool;
+
+  /**
+   * @brief Lower the distance to other if other is smaller.
+   * @param other The candidate distance.
+   * @param order The memory order of a successful update.
+   * @return Distance The distance before the update.
+   */
+  auto FetchMin(const Distance& other,
+                std::memory_order order = std::memory_order_seq_cst)
+      -> Distance;
+  /**
+   * @brief Raise the distance to other if other is bigger.
+   * @param other The candidate distance.
+   * @param order The memory order of a successful update.
+   * @return Distance The distance before the update.
+   */
+  auto FetchMax(const Distance& other,
+                std::memory_order order = std::memory_order_seq_cst)
+      -> Distance;
+
+  /**
+   * @brief Add and accumulate other distance object.
+   * @param other The other distance object.
+   */
+  auto operator+=(const Distance& other) -> void;
+  /**
+   * @brief Subtract and accumulate other distance object.
+   * @param other The other distance object.
+   */
+  auto operator-=(const Distance& other) -> void;
+
+ protected:
+ private:
+  std::atomic<int64_t> nanometer_{0};  ///< Nanometer
+};
+
+/**
+ * @brief Distance accumulator split into cache-line padded shards.
+ *
+ * Each thread adds into its own shard, so heavily contended totals do not
+ * bounce one cache line between cores. Reading combines all shards and is
+ * therefore more expensive than an update; use it for counters that are
+ * written much more often than read.
+ */
+class ShardedAtomicDistance {
+ public:
+  /**
+   * @brief Size of the padding of each shard.
+   */
+  static constexpr std::size_t kCacheLineSize{64};
+
+  /**
+   * @brief Construct with one shard per hardware thread.
+   */
+  ShardedAtomicDistance();
+  /**
+   * @brief Construct with shard count.
+   * @param shard_count The number of shards.
+   * @throw std::invalid_argument If shard_count is 0.
+   */
+  explicit ShardedAtomicDistance(std::size_t shard_count);
+
+  ShardedAtomicDistance(const ShardedAtomicDistance& other) = delete;
+  ShardedAtomicDistance(ShardedAtomicDistance&& other) = delete;
+  auto operator=(const ShardedAtomicDistance& other)
+      -> ShardedAtomicDistance& = delete;
+  auto operator=(ShardedAtomicDistance&& other)
+      -> ShardedAtomicDistance& = delete;
+
+  /**
+   * @brief Destroy the ShardedAtomicDistance object.
+   */
+  ~ShardedAtomicDistance() = default;
+
+  /**
+   * @brief Get the number of shards.
+   * @return std::size_t The number of shards.
+   */
+  [[nodiscard]] auto GetShardCount() const -> std::size_t;
+
+  /**
+   * @brief Add a distance into the shard of the calling thread.
+   * @param other The distance to add.
+   */
+  auto Add(const Distance& other) -> void;
+  /**
+   * @brief Subtract a distance from the shard of the calling thread.
+   * @param other The distance to subtract.
+   */
+  auto Subtract(const Distance& other) -> void;
+
+  /**
+   * @brief Combine all shards.
+   *
+   * Updates racing with the read may or may not be included.
+   *
+   * @return Distance The total distance.
+   */
+  [[nodiscard]] auto Load() const -> Distance;
+  /**
+   * @brief Combine all shards and reset them to zero.
+   * @return Distance The total distance before the reset.
+   */
+  auto Drain() -> Distance;
+
+  /**
+   * @brief Add and accumulate other distance object.
+   * @param other The other distance object.
+   */
+  auto operator+=(const Distance& other) -> void;
+  /**
+   * @brief Subtract and accumulate other distance object.
+   * @param other The other distance object.
+   */
+  auto operator-=(const Distance& other) -> void;
+
+ protected:
+ private:
+  /**
+   * @brief One counter per cache line.
+   */
+  struct alignas(kCacheLineSize) Shard {
+    std::atomic<int64_t> nanometer{0};  ///< Nanometer
+  };
+
+  [[nodiscard]] auto GetLocalShard() -> Shard&;
+
+  std::size_t shard_count_{1};      ///< Number of shards
+  std::unique_ptr<Shard[]> shards_;  ///< Shards
+};
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_ATOMIC_DISTANCE_HPP_
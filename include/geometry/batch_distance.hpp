@@ -0,0 +1,69 @@
+/**
+ * @file geometry/batch_distance.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Batch distance kernels over point clouds
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_BATCH_DISTANCE_HPP_
+#define ZOZIBUSH__GEOMETRY_BATCH_DISTANCE_HPP_
+
+#include <cstddef>
+
+#include "geometry/point_cloud.hpp"
+#include "geometry/point_n.hpp"
+
+namespace zozibush::geometry {
+
+/**
+ * @brief Calculate squared distances from one point to every cloud point
+ *
+ * The kernels walk the per-axis arrays of the cloud in lockstep with no
+ * branches, so the compiler vectorizes them across points. Instantiated for
+ * the same D and T as PointCloud.
+ *
+ * @tparam D Number of dimensions
+ * @tparam T Coordinate value type
+ * @param cloud Point cloud
+ * @param query Query point
+ * @param distances Output buffer, at least cloud.Size() elements
+ */
+template <std::size_t D, typename T>
+auto CalculateSquaredDistances(const PointCloud<D, T>& cloud,
+                               const PointN<D, T>& query, T* distances)
+    -> void;
+
+/**
+ * @brief Calculate distances from one point to every cloud point
+ * @tparam D Number of dimensions
+ * @tparam T Coordinate value type
+ * @param cloud Point cloud
+ * @param query Query point
+ * @param distances Output buffer, at least cloud.Size() elements
+ */
+template <std::size_t D, typename T>
+auto CalculateDistances(const PointCloud<D, T>& cloud,
+                        const PointN<D, T>& query, T* distances) -> void;
+
+/**
+ * @brief Calculate distances between points with the same index
+ * @tparam D Number of dimensions
+ * @tparam T Coordinate value type
+ * @param lhs left hand side point cloud
+ * @param rhs right hand side point cloud
+ * @param distances Output buffer, at least lhs.Size() elements
+ * @throw std::invalid_argument If the clouds differ in size
+ */
+template <std::size_t D, typename T>
+auto CalculatePairwiseDistances(const PointCloud<D, T>& lhs,
+                                const PointCloud<D, T>& rhs, T* distances)
+    -> void;
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_BATCH_DISTANCE_HPP_
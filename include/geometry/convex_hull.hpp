@@ -0,0 +1,45 @@
+/**
+ * @file geometry/convex_hull.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Convex hull declaration for 2-dimension points
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_CONVEX_HULL_HPP_
+#define ZOZIBUSH__GEOMETRY_CONVEX_HULL_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "geometry/point_cloud.hpp"
+
+namespace zozibush::geometry {
+
+/**
+ * @brief Find the convex hull of a point cloud
+ *
+ * Andrew's monotone chain with the exact Orient2D. The cloud is split into
+ * blocks whose hulls are found in parallel, then the hull of their vertices
+ * is the hull of the cloud. Vertices are listed counter-clockwise from the
+ * lowest (x, y) point; points on hull edges are left out, and of duplicate
+ * points the lowest index is used. Collinear input gives its two extreme
+ * points and a single distinct point gives one.
+ *
+ * @param points Point cloud
+ * @param indices Cleared, then filled with hull point indices
+ * @param thread_count Number of threads, 0 for all hardware threads
+ * @return std::size_t Number of hull points
+ * @throw std::out_of_range If a coordinate is nan or inf
+ */
+auto FindConvexHull(const PointCloud<2, double>& points,
+                    std::vector<std::size_t>& indices,
+                    std::size_t thread_count = 0) -> std::size_t;
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_CONVEX_HULL_HPP_
@@ -0,0 +1,76 @@
+/**
+ * @file geometry/dbscan.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief DBSCAN clustering declaration
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_DBSCAN_HPP_
+#define ZOZIBUSH__GEOMETRY_DBSCAN_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "geometry/distance.hpp"
+#include "geometry/point_cloud.hpp"
+
+namespace zozibush::geometry {
+
+/**
+ * @brief Density-based clustering of 2-dimension points
+ *
+ * Neighbourhoods come from a GridIndex with eps sized cells. Core points are
+ * found in parallel, then core points within eps of each other are merged in
+ * parallel with a lock-free union-find. The result does not depend on the
+ * thread count: clusters are numbered in order of their lowest core point
+ * index, and a border point joins the cluster of its lowest index core
+ * neighbour.
+ */
+class Dbscan {
+ public:
+  /**
+   * @brief Label of points that belong to no cluster
+   */
+  static constexpr int64_t kNoise{-1};
+
+  /**
+   * @brief Construct a new Dbscan object
+   * @param eps The neighbourhood radius, inclusive
+   * @param min_points Minimum neighbourhood size of a core point, counting
+   * the point itself
+   * @param unit The unit of the coordinates
+   * @throw std::invalid_argument If eps is not positive or min_points is 0
+   */
+  Dbscan(const Distance& eps, std::size_t min_points,
+         Distance::Type unit = Distance::Type::kMeter);
+
+  /**
+   * @brief Cluster points
+   *
+   * Working memory is a few arrays of points.Size() elements allocated once
+   * per call; nothing is allocated per point.
+   *
+   * @param points Point cloud
+   * @param labels Output buffer, at least points.Size() elements, receives a
+   * cluster number from 0 or kNoise per point
+   * @param thread_count Number of threads, 0 for all hardware threads
+   * @return std::size_t Number of clusters
+   * @throw std::out_of_range If a coordinate is nan or inf
+   */
+  auto Cluster(const PointCloud<2, double>& points, int64_t* labels,
+               std::size_t thread_count = 0) const -> std::size_t;
+
+ protected:
+ private:
+  double eps_{0.0};             ///< Radius in coordinate unit
+  std::size_t min_points_{1};  ///< Minimum neighbourhood size
+};
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_DBSCAN_HPP_
@@ -0,0 +1,139 @@
+/**
+ * @file geometry/delaunay.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Delaunay triangulation declaration
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_DELAUNAY_HPP_
+#define ZOZIBUSH__GEOMETRY_DELAUNAY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud.hpp"
+
+namespace zozibush::geometry {
+
+/**
+ * @brief Delaunay triangulation of 2-dimension points
+ *
+ * Built with a radial sweep: points are inserted in order of distance from
+ * the circumcenter of a seed triangle, each one outside the current convex
+ * hull, which is found in O(1) expected time through an angular hash of the
+ * hull vertices. New triangles are legalized by edge flips. Orientation and
+ * in-circle tests use the exact predicates of geometry/predicates.hpp.
+ *
+ * The mesh is stored as index arrays: triangle t has the half-edges 3t, 3t+1
+ * and 3t+2, half-edge e starts at point GetTriangles()[e] and runs to the
+ * start of NextHalfEdge(e), and GetHalfEdges()[e] is the opposite half-edge
+ * in the neighbouring triangle or kInvalid on the hull. Triangles are
+ * counter-clockwise. Duplicate points are left out of the mesh. When all
+ * points are collinear there is no triangle and the hull lists the points
+ * along the line.
+ */
+class Delaunay {
+ public:
+  /**
+   * @brief Index marking a missing half-edge or point
+   */
+  static constexpr uint32_t kInvalid{std::numeric_limits<uint32_t>::max()};
+
+  /**
+   * @brief Construct a new Delaunay object and triangulate points
+   * @param points Point cloud, copied
+   * @throw std::out_of_range If a coordinate is nan or inf
+   * @throw std::length_error If half-edge indices would not fit in uint32_t
+   */
+  explicit Delaunay(const PointCloud<2, double>& points);
+
+  /**
+   * @brief Get the number of input points
+   * @return std::size_t Number of points
+   */
+  [[nodiscard]] auto GetPointCount() const -> std::size_t;
+  /**
+   * @brief Get an input point
+   * @param index Point index
+   * @return Point2D Point
+   */
+  [[nodiscard]] auto GetPoint(uint32_t index) const -> Point2D;
+  /**
+   * @brief Get the number of triangles
+   * @return std::size_t Number of triangles
+   */
+  [[nodiscard]] auto GetTriangleCount() const -> std::size_t;
+  /**
+   * @brief Get the start point of every half-edge, 3 per triangle
+   * @return const std::vector<uint32_t>& Point indices
+   */
+  [[nodiscard]] auto GetTriangles() const -> const std::vector<uint32_t>&;
+  /**
+   * @brief Get the opposite of every half-edge
+   * @return const std::vector<uint32_t>& Half-edge indices or kInvalid
+   */
+  [[nodiscard]] auto GetHalfEdges() const -> const std::vector<uint32_t>&;
+  /**
+   * @brief Get the convex hull
+   * @return const std::vector<uint32_t>& Point indices, counter-clockwise
+   */
+  [[nodiscard]] auto GetHull() const -> const std::vector<uint32_t>&;
+
+  /**
+   * @brief Get the next half-edge in the same triangle
+   * @param edge Half-edge index
+   * @return uint32_t Half-edge index
+   */
+  [[nodiscard]] static constexpr auto NextHalfEdge(uint32_t edge)
+      -> uint32_t {
+    return (edge % 3 == 2) ? edge - 2 : edge + 1;
+  }
+  /**
+   * @brief Get the previous half-edge in the same triangle
+   * @param edge Half-edge index
+   * @return uint32_t Half-edge index
+   */
+  [[nodiscard]] static constexpr auto PreviousHalfEdge(uint32_t edge)
+      -> uint32_t {
+    return (edge % 3 == 0) ? edge + 2 : edge - 1;
+  }
+
+ protected:
+ private:
+  auto Triangulate() -> void;
+  auto AddTriangle(uint32_t first, uint32_t second, uint32_t third,
+                   uint32_t first_opposite, uint32_t second_opposite,
+                   uint32_t third_opposite) -> uint32_t;
+  auto Link(uint32_t edge, uint32_t opposite) -> void;
+  auto Legalize(uint32_t edge) -> uint32_t;
+  [[nodiscard]] auto GetHashKey(double input_x, double input_y) const
+      -> std::size_t;
+
+  std::vector<double> x_values_;      ///< x of each point
+  std::vector<double> y_values_;      ///< y of each point
+  std::vector<uint32_t> triangles_;   ///< Start point of each half-edge
+  std::vector<uint32_t> half_edges_;  ///< Opposite of each half-edge
+  std::vector<uint32_t> hull_;        ///< Convex hull, counter-clockwise
+
+  // Sweep state, released after construction.
+  double center_x_{0.0};                 ///< x of the sweep center
+  double center_y_{0.0};                 ///< y of the sweep center
+  uint32_t hull_start_{0};               ///< Some vertex of the sweep hull
+  std::vector<uint32_t> hull_next_;      ///< Next hull vertex, self if gone
+  std::vector<uint32_t> hull_previous_;  ///< Previous hull vertex
+  std::vector<uint32_t> hull_edges_;     ///< Half-edge from vertex to next
+  std::vector<uint32_t> hull_hash_;      ///< Hull vertex per angle bucket
+  std::vector<uint32_t> edge_stack_;     ///< Pending edges of Legalize
+};
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_DELAUNAY_HPP_
@@ -13,7 +13,9 @@
 #ifndef ZOZIBUSH__GEOMETRY_DISTANCE_HPP_
 #define ZOZIBUSH__GEOMETRY_DISTANCE_HPP_
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 
 namespace zozibush::geometry {
 /**
@@ -57,8 +59,10 @@ class Distance {
 
   /**
    * @brief Destroy the Distance object.
+   * @note Not virtual, so that Distance stays trivially copyable and arrays of
+   * it can be moved around as raw nanometer integers.
    */
-  virtual ~Distance() = default;
+  ~Distance() = default;
 
   /**
    * @brief The copy assignment operator.
@@ -80,6 +84,19 @@ class Distance {
    */
   [[nodiscard]] auto GetValue(const Type& input_type) const -> double;
 
+  /**
+   * @brief Get the distance value as integer nanometers without rounding.
+   * @return int64_t The stored nanometer value.
+   */
+  [[nodiscard]] auto GetNanometer() const -> int64_t;
+
+  /**
+   * @brief Construct a distance object from integer nanometers.
+   * @param nanometer The nanometer value.
+   * @return Distance The distance object.
+   */
+  [[nodiscard]] static auto FromNanometer(int64_t nanometer) -> Distance;
+
   /**
    * @brief Set the distance value for distance type.
    * @param input_value The distance value
@@ -184,4 +201,20 @@ class Distance {
 
 }  // namespace zozibush::geometry
 
+namespace std {
+/**
+ * @brief Hash of Distance, the mixed nanometer value
+ */
+template <>
+struct hash<zozibush::geometry::Distance> {
+  /**
+   * @brief Calculate the hash of a distance
+   * @param distance Distance object
+   * @return std::size_t Hash value
+   */
+  auto operator()(const zozibush::geometry::Distance& distance) const noexcept
+      -> std::size_t;
+};
+}  // namespace std
+
 #endif  // ZOZIBUSH__GEOMETRY_DISTANCE_HPP_
\ No newline at end of file
@@ -0,0 +1,96 @@
+/**
+ * @file geometry/distance_array.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Bulk unit conversion and binary serialization for distance arrays
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_DISTANCE_ARRAY_HPP_
+#define ZOZIBUSH__GEOMETRY_DISTANCE_ARRAY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/distance.hpp"
+
+namespace zozibush::geometry {
+
+/**
+ * @brief Convert an array of values in one unit into integer nanometers.
+ *
+ * Values are scaled and rounded to the nearest nanometer, half to even, in a
+ * branch-free pass; only magnitudes from 2^51 nm up, nan and infinities take
+ * a second, scalar pass. Unlike the Distance constructor, which truncates,
+ * this keeps e.g. 0.3 m at exactly 300000000 nm.
+ *
+ * @param values The input values in @p input_type unit.
+ * @param count The number of values.
+ * @param input_type The unit of the input values.
+ * @param nanometers The output buffer, at least @p count elements.
+ * @throw std::out_of_range If a value is nan or does not fit in int64_t
+ * nanometers. Offending elements are written as 0, the others are converted.
+ */
+auto ConvertToNanometers(const double* values, std::size_t count,
+                         Distance::Type input_type, int64_t* nanometers)
+    -> void;
+
+/**
+ * @brief Convert an array of integer nanometers into values in one unit.
+ * @param nanometers The input nanometer values.
+ * @param count The number of values.
+ * @param output_type The unit of the output values.
+ * @param values The output buffer, at least @p count elements.
+ */
+auto ConvertFromNanometers(const int64_t* nanometers, std::size_t count,
+                           Distance::Type output_type, double* values) -> void;
+
+/**
+ * @brief Convert an array of values in one unit into distance objects.
+ * @param values The input values in @p input_type unit.
+ * @param count The number of values.
+ * @param input_type The unit of the input values.
+ * @param distances The output buffer, at least @p count elements.
+ * @throw std::out_of_range Same as ConvertToNanometers. The contents of
+ * @p distances are unspecified after the throw.
+ */
+auto ConvertToDistances(const double* values, std::size_t count,
+                        Distance::Type input_type, Distance* distances)
+    -> void;
+
+/**
+ * @brief Convert an array of distance objects into values in one unit.
+ * @param distances The input distance objects.
+ * @param count The number of distances.
+ * @param output_type The unit of the output values.
+ * @param values The output buffer, at least @p count elements.
+ */
+auto ConvertFromDistances(const Distance* distances, std::size_t count,
+                          Distance::Type output_type, double* values) -> void;
+
+/**
+ * @brief Dump distance objects as packed little-endian int64 nanometers.
+ * @param distances The distance objects.
+ * @return std::vector<uint8_t> The packed bytes, 8 bytes per distance.
+ */
+[[nodiscard]] auto DumpDistances(const std::vector<Distance>& distances)
+    -> std::vector<uint8_t>;
+
+/**
+ * @brief Load distance objects from packed little-endian int64 nanometers.
+ * @param bytes The packed bytes written by DumpDistances.
+ * @param size The number of bytes.
+ * @return std::vector<Distance> The distance objects.
+ * @throw std::invalid_argument If size is not a multiple of 8 bytes.
+ */
+[[nodiscard]] auto LoadDistances(const uint8_t* bytes, std::size_t size)
+    -> std::vector<Distance>;
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_DISTANCE_ARRAY_HPP_
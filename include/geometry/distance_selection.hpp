@@ -0,0 +1,93 @@
+/**
+ * @file geometry/distance_selection.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Top-k selection and sorting of points by distance
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_DISTANCE_SELECTION_HPP_
+#define ZOZIBUSH__GEOMETRY_DISTANCE_SELECTION_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud.hpp"
+
+namespace zozibush::geometry {
+
+/**
+ * @brief Select the k cloud points nearest to a query point
+ *
+ * Points are ranked by squared distance, whose bit pattern is an unsigned
+ * integer key with the same order, so no square root is taken. Every thread
+ * keeps the k best of its range in a bounded heap, and only the merged k
+ * candidates are sorted; the rest of the order is never built. Ties go to
+ * the lower index and nan distances rank last, so the result does not depend
+ * on the thread count.
+ *
+ * @param cloud Point cloud
+ * @param query Query point
+ * @param k Number of points, clamped to cloud.Size()
+ * @param thread_count Number of threads, 0 for all hardware threads
+ * @return std::vector<std::size_t> Indices of the k nearest points, nearest
+ * first
+ */
+[[nodiscard]] auto SelectNearest(const PointCloud<2, double>& cloud,
+                                 const Point2D& query, std::size_t k,
+                                 std::size_t thread_count = 0)
+    -> std::vector<std::size_t>;
+/**
+ * @brief Sort all cloud points by distance from a query point
+ *
+ * Keys are computed in parallel and sorted with a stable LSD radix sort,
+ * which skips the digits every key shares. Order as in SelectNearest().
+ *
+ * @param cloud Point cloud
+ * @param query Query point
+ * @param thread_count Number of threads, 0 for all hardware threads
+ * @return std::vector<std::size_t> Indices of all points, nearest first
+ */
+[[nodiscard]] auto SortByDistance(const PointCloud<2, double>& cloud,
+                                  const Point2D& query,
+                                  std::size_t thread_count = 0)
+    -> std::vector<std::size_t>;
+
+/**
+ * @brief Select the k smallest of precomputed distances
+ *
+ * Ranked by their nanometer integers, otherwise like the point cloud
+ * overload.
+ *
+ * @param distances Distances
+ * @param count Number of distances
+ * @param k Number of distances, clamped to count
+ * @param thread_count Number of threads, 0 for all hardware threads
+ * @return std::vector<std::size_t> Indices of the k smallest, smallest first
+ */
+[[nodiscard]] auto SelectSmallest(const Distance* distances,
+                                  std::size_t count, std::size_t k,
+                                  std::size_t thread_count = 0)
+    -> std::vector<std::size_t>;
+/**
+ * @brief Sort precomputed distances
+ * @param distances Distances
+ * @param count Number of distances
+ * @param thread_count Number of threads, 0 for all hardware threads
+ * @return std::vector<std::size_t> Indices of all distances, smallest first,
+ * ties by index
+ */
+[[nodiscard]] auto SortByDistance(const Distance* distances,
+                                  std::size_t count,
+                                  std::size_t thread_count = 0)
+    -> std::vector<std::size_t>;
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_DISTANCE_SELECTION_HPP_
@@ -0,0 +1,140 @@
+/**
+ * @file geometry/geodesic.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Geodesic distance declaration for longitude/latitude points
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_GEODESIC_HPP_
+#define ZOZIBUSH__GEOMETRY_GEODESIC_HPP_
+
+#include "geometry/distance.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud.hpp"
+
+namespace zozibush::geometry {
+
+/**
+ * @brief Geodesic distance calculation
+ *
+ * Points are Point2D(longitude, latitude) in degrees. Spherical methods use
+ * the mean earth radius, Vincenty uses the WGS84 ellipsoid.
+ */
+class Geodesic {
+ public:
+  /**
+   * @brief The enum class for geodesic method.
+   */
+  enum class Method {
+    /**
+     * Flat earth around the mean latitude, using the fast cosine. Cheapest;
+     * the error against haversine grows with distance and is below 0.1 % up
+     * to about 100 km outside polar regions.
+     */
+    kEquirectangular = 0,
+    /**
+     * Haversine with polynomial sin/cos/atan2 that vectorize. Absolute error
+     * against kHaversine stays below 1 mm for any pair of points.
+     */
+    kFastHaversine = 1,
+    /**
+     * Haversine with the standard library math functions.
+     */
+    kHaversine = 2,
+    /**
+     * Vincenty inverse formula on WGS84, accurate to about 0.1 mm but
+     * iterative and not vectorized.
+     */
+    kVincenty = 3,
+  };
+
+  /**
+   * @brief Mean earth radius in meter
+   */
+  static constexpr double kEarthRadius{6371008.8};
+
+  /**
+   * @brief Calculate the great-circle distance with haversine
+   * @param lhs left hand side point
+   * @param rhs right hand side point
+   * @return Distance Distance along the sphere
+   */
+  [[nodiscard]] static auto CalculateHaversineDistance(const Point2D& lhs,
+                                                       const Point2D& rhs)
+      -> Distance;
+  /**
+   * @brief Calculate the ellipsoidal distance with Vincenty
+   * @param lhs left hand side point
+   * @param rhs right hand side point
+   * @return Distance Distance along the WGS84 ellipsoid
+   * @throw std::domain_error If the iteration does not converge, which only
+   * happens for nearly antipodal points
+   * @throw std::out_of_range If a coordinate is nan or inf
+   */
+  [[nodiscard]] static auto CalculateVincentyDistance(const Point2D& lhs,
+                                                      const Point2D& rhs)
+      -> Distance;
+  /**
+   * @brief Calculate the equirectangular approximation of the distance
+   * @param lhs left hand side point
+   * @param rhs right hand side point
+   * @return Distance Approximate distance, see Method::kEquirectangular
+   */
+  [[nodiscard]] static auto CalculateEquirectangularDistance(
+      const Point2D& lhs, const Point2D& rhs) -> Distance;
+  /**
+   * @brief Calculate the distance with a method
+   * @param lhs left hand side point
+   * @param rhs right hand side point
+   * @param method The geodesic method
+   * @return Distance Distance
+   * @throw std::domain_error If Method::kVincenty does not converge
+   * @throw std::out_of_range If a coordinate is nan or inf
+   */
+  [[nodiscard]] static auto CalculateDistance(const Point2D& lhs,
+                                              const Point2D& rhs,
+                                              Method method) -> Distance;
+
+  /**
+   * @brief Calculate distances from one point to every cloud point
+   * @param points Longitude/latitude point cloud
+   * @param origin Longitude/latitude origin
+   * @param distances Output buffer, at least points.Size() elements
+   * @param method The geodesic method
+   * @throw std::out_of_range If a coordinate is nan or inf
+   * @throw std::domain_error If Method::kVincenty does not converge for a
+   * point, and no coordinate is nan or inf
+   * @note Either exception is thrown after the whole batch is computed:
+   * offending distances are written as 0, the others are valid.
+   */
+  static auto CalculateDistances(const PointCloud<2, double>& points,
+                                 const Point2D& origin, Distance* distances,
+                                 Method method = Method::kFastHaversine)
+      -> void;
+  /**
+   * @brief Calculate distances between points with the same index
+   * @param lhs left hand side longitude/latitude point cloud
+   * @param rhs right hand side longitude/latitude point cloud
+   * @param distances Output buffer, at least lhs.Size() elements
+   * @param method The geodesic method
+   * @throw std::invalid_argument If the clouds differ in size, before
+   * writing anything
+   * @throw std::out_of_range If a coordinate is nan or inf
+   * @throw std::domain_error If Method::kVincenty does not converge for a
+   * pair, and no coordinate is nan or inf
+   * @note Range and convergence errors are thrown after the whole batch is
+   * computed: offending distances are written as 0, the others are valid.
+   */
+  static auto CalculatePairwiseDistances(
+      const PointCloud<2, double>& lhs, const PointCloud<2, double>& rhs,
+      Distance* distances, Method method = Method::kFastHaversine) -> void;
+};
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_GEODESIC_HPP_
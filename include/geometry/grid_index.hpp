@@ -0,0 +1,186 @@
+/**
+ * @file geometry/grid_index.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Uniform cell grid index declaration for 2-dimension points
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_GRID_INDEX_HPP_
+#define ZOZIBUSH__GEOMETRY_GRID_INDEX_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud.hpp"
+
+namespace zozibush::geometry {
+
+/**
+ * @brief Static uniform cell grid over a point cloud
+ *
+ * Points are sorted by cell with a counting sort and their coordinates are
+ * copied in that order, so the points of a row of cells are one contiguous
+ * range. A radius query with a radius close to the cell size touches a 3x3
+ * block of cells. The grid is capped at a few cells per point; for very
+ * sparse inputs the cell size is enlarged, which keeps queries correct and
+ * the memory linear in the number of points.
+ *
+ * Float and double point clouds can be indexed. The copied coordinates and
+ * every query are double either way; float coordinates widen exactly, so
+ * results match indexing a converted cloud.
+ */
+class GridIndex {
+ public:
+  /**
+   * @brief Construct a new GridIndex object
+   * @param points Point cloud, only read during construction
+   * @param cell_size Requested cell size in coordinate unit
+   * @param thread_count Number of threads, 0 for all hardware threads
+   * @throw std::invalid_argument If cell_size is not a positive finite value
+   * @throw std::out_of_range If a coordinate is nan or inf
+   */
+  GridIndex(const PointCloud<2, double>& points, double cell_size,
+            std::size_t thread_count = 0);
+  /**
+   * @brief Construct a new GridIndex object over float points
+   * @param points Point cloud, only read during construction
+   * @param cell_size Requested cell size in coordinate unit
+   * @param thread_count Number of threads, 0 for all hardware threads
+   * @throw std::invalid_argument If cell_size is not a positive finite value
+   * @throw std::out_of_range If a coordinate is nan or inf
+   */
+  GridIndex(const PointCloud<2, float>& points, double cell_size,
+            std::size_t thread_count = 0);
+
+  /**
+   * @brief Estimate a cell size giving about one point per cell
+   *
+   * Spreads the points evenly over their bounding box, or along its longer
+   * side if it is flat. The grid enlarges the cells by itself if the
+   * estimate would give too many.
+   *
+   * @param points Point cloud
+   * @return double Positive finite cell size, 1 if the points do not span
+   * a box
+   */
+  [[nodiscard]] static auto EstimateCellSize(
+      const PointCloud<2, double>& points) -> double;
+
+  /**
+   * @brief Get the number of indexed points
+   * @return std::size_t Number of points
+   */
+  [[nodiscard]] auto Size() const -> std::size_t;
+  /**
+   * @brief Get the cell size actually used
+   * @return double Cell size, at least the requested one
+   */
+  [[nodiscard]] auto GetCellSize() const -> double;
+
+  /**
+   * @brief Call function for every point within radius of center
+   *
+   * Points are visited cell row by cell row, not in index order.
+   *
+   * @tparam Function Callable as bool(std::size_t index), false stops
+   * @param center_x x coordinate of the center
+   * @param center_y y coordinate of the center
+   * @param radius Inclusive radius
+   * @param function Function object
+   * @return true If every point was visited
+   * @return false If function stopped the visit
+   */
+  template <typename Function>
+  auto VisitRadius(double center_x, double center_y, double radius,
+                   Function&& function) const -> bool {
+    const auto kFirstColumn{GetColumn(center_x - radius)};
+    const auto kLastColumn{GetColumn(center_x + radius)};
+    const auto kFirstRow{GetRow(center_y - radius)};
+    const auto kLastRow{GetRow(center_y + radius)};
+    const auto kSquaredRadius{radius * radius};
+    for (auto row = kFirstRow; row <= kLastRow; ++row) {
+      const auto kBegin{cell_offsets_[row * column_count_ + kFirstColumn]};
+      const auto kEnd{cell_offsets_[row * column_count_ + kLastColumn + 1]};
+      for (auto i = kBegin; i < kEnd; ++i) {
+        const auto kDeltaX{x_values_[i] - center_x};
+        const auto kDeltaY{y_values_[i] - center_y};
+        if (kDeltaX * kDeltaX + kDeltaY * kDeltaY <= kSquaredRadius &&
+            !function(indices_[i])) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Count points within radius of center
+   * @param center Center point
+   * @param radius Inclusive radius
+   * @param limit Stop counting at this many points
+   * @return std::size_t Number of points, at most limit
+   */
+  [[nodiscard]] auto CountRadius(const Point2D& center, double radius,
+                                 std::size_t limit) const -> std::size_t;
+  /**
+   * @brief Find points within radius of center
+   * @param center Center point
+   * @param radius Inclusive radius
+   * @param indices Cleared, then filled with point indices in ascending order
+   * @return std::size_t Number of points found
+   */
+  auto SearchRadius(const Point2D& center, double radius,
+                    std::vector<std::size_t>& indices) const -> std::size_t;
+  /**
+   * @brief Find the nearest point
+   *
+   * Searches rings of cells around the query cell until no unvisited cell
+   * can hold a closer point. Ties go to the lower index.
+   *
+   * @param query Query point
+   * @return std::size_t Index of the nearest point
+   * @throw std::out_of_range If the index is empty
+   */
+  [[nodiscard]] auto FindNearest(const Point2D& query) const -> std::size_t;
+
+ protected:
+ private:
+  template <typename T>
+  auto Build(const PointCloud<2, T>& points, std::size_t thread_count)
+      -> void;
+
+  // Clamped to the grid; nan maps to cell 0 and then matches no point.
+  [[nodiscard]] auto GetColumn(double input_x) const -> std::size_t {
+    const auto kColumn{std::floor((input_x - min_x_) / cell_size_)};
+    const auto kLast{static_cast<double>(column_count_ - 1)};
+    return (kColumn > 0.0) ? static_cast<std::size_t>(std::min(kColumn, kLast))
+                           : 0;
+  }
+  [[nodiscard]] auto GetRow(double input_y) const -> std::size_t {
+    const auto kRow{std::floor((input_y - min_y_) / cell_size_)};
+    const auto kLast{static_cast<double>(row_count_ - 1)};
+    return (kRow > 0.0) ? static_cast<std::size_t>(std::min(kRow, kLast)) : 0;
+  }
+
+  double cell_size_{0.0};        ///< Cell size
+  double min_x_{0.0};            ///< Minimum x of points
+  double min_y_{0.0};            ///< Minimum y of points
+  std::size_t column_count_{1};  ///< Number of cells along x
+  std::size_t row_count_{1};     ///< Number of cells along y
+  std::vector<std::size_t> cell_offsets_;  ///< Start of each cell, row major
+  std::vector<std::size_t> indices_;       ///< Point indices in cell order
+  std::vector<double> x_values_;           ///< x coordinates in cell order
+  std::vector<double> y_values_;           ///< y coordinates in cell order
+};
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_GRID_INDEX_HPP_
@@ -0,0 +1,49 @@
+/**
+ * @file geometry/hash.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Hash mixing functions shared by the std::hash specializations
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_HASH_HPP_
+#define ZOZIBUSH__GEOMETRY_HASH_HPP_
+
+#include <cstdint>
+
+namespace zozibush::geometry::internal {
+/**
+ * @brief Scramble a 64-bit value, the splitmix64 finalizer
+ *
+ * A bijection in which every input bit flips each output bit with a
+ * probability close to one half, so both the low bits used as tags and
+ * the high bits used as table indices are well distributed.
+ *
+ * @param value Input value
+ * @return uint64_t Mixed value
+ */
+[[nodiscard]] constexpr auto MixHash(uint64_t value) -> uint64_t {
+  value ^= value >> 30U;
+  value *= 0xbf58476d1ce4e5b9ULL;
+  value ^= value >> 27U;
+  value *= 0x94d049bb133111ebULL;
+  return value ^ (value >> 31U);
+}
+
+/**
+ * @brief Combine the hash of a sequence with the next value
+ * @param seed Hash of the values so far
+ * @param value Next value
+ * @return uint64_t Hash of the sequence
+ */
+[[nodiscard]] constexpr auto HashCombine(uint64_t seed, uint64_t value)
+    -> uint64_t {
+  return MixHash(seed ^ (value + 0x9e3779b97f4a7c15ULL));
+}
+}  // namespace zozibush::geometry::internal
+
+#endif  // ZOZIBUSH__GEOMETRY_HASH_HPP_
@@ -0,0 +1,150 @@
+/**
+ * @file geometry/kmeans.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief k-means clustering declaration
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_KMEANS_HPP_
+#define ZOZIBUSH__GEOMETRY_KMEANS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud.hpp"
+
+namespace zozibush::geometry {
+
+/**
+ * @brief k-means clustering of 2-dimension points
+ *
+ * The nearest-centroid search runs over blocks of points with the centroids
+ * as the outer loop, so the inner loop is a branch-free squared-distance
+ * kernel the compiler vectorizes. Points are split into chunks whose size
+ * only depends on the number of points; each chunk keeps its own partial
+ * sums, which are combined in chunk order. Results are therefore the same
+ * for every thread count.
+ */
+class KMeans {
+ public:
+  /**
+   * @brief The enum class for the full-batch iteration method.
+   */
+  enum class Method {
+    kLloyd = 0,    ///< Compare every point with every centroid
+    kHamerly = 1,  ///< Skip points whose distance bounds prove no change
+  };
+
+  /**
+   * @brief Construct a new KMeans object without centroids
+   * @param cluster_count Number of clusters
+   * @param seed Random seed of k-means++ seeding
+   * @throw std::invalid_argument If cluster_count is 0 or exceeds UINT32_MAX
+   */
+  explicit KMeans(std::size_t cluster_count, uint64_t seed = 0);
+
+  /**
+   * @brief Get the number of clusters
+   * @return std::size_t Number of clusters
+   */
+  [[nodiscard]] auto GetClusterCount() const -> std::size_t;
+  /**
+   * @brief Get the centroids
+   * @return std::vector<Point2D> Centroids, empty before seeding
+   */
+  [[nodiscard]] auto GetCentroids() const -> std::vector<Point2D>;
+  /**
+   * @brief Replace the centroids, e.g. to resume from a previous run
+   * @param centroids Exactly GetClusterCount() centroids
+   * @throw std::invalid_argument If the number of centroids differs
+   */
+  auto SetCentroids(const std::vector<Point2D>& centroids) -> void;
+
+  /**
+   * @brief Choose initial centroids with k-means++
+   *
+   * Each centroid is drawn with probability proportional to the squared
+   * distance to the nearest centroid chosen so far.
+   *
+   * @param points Point cloud
+   * @param thread_count Number of threads, 0 for all hardware threads
+   * @throw std::invalid_argument If there are fewer points than clusters
+   */
+  auto Seed(const PointCloud<2, double>& points, std::size_t thread_count = 0)
+      -> void;
+  /**
+   * @brief Run full-batch iterations until no label changes
+   *
+   * Seeds with k-means++ first when there are no centroids. A cluster that
+   * loses all its points keeps its previous centroid.
+   *
+   * @param points Point cloud
+   * @param labels Output buffer, at least points.Size() elements
+   * @param max_iteration Maximum number of iterations
+   * @param method The iteration method, kHamerly keeps two distance bounds
+   * per point and usually skips most distance computations after the first
+   * few iterations
+   * @param thread_count Number of threads, 0 for all hardware threads
+   * @return std::size_t Number of iterations run
+   * @throw std::invalid_argument If max_iteration is 0 or there are fewer
+   * points than clusters
+   */
+  auto Fit(const PointCloud<2, double>& points, uint32_t* labels,
+           std::size_t max_iteration = 100, Method method = Method::kHamerly,
+           std::size_t thread_count = 0) -> std::size_t;
+  /**
+   * @brief Update the centroids with one mini-batch
+   *
+   * Assigns the batch to the current centroids and moves every centroid to
+   * the running mean of all points ever assigned to it, so streaming batches
+   * that do not fit in memory together converges like a single pass. Seeds
+   * from the first batch when there are no centroids.
+   *
+   * @param batch Batch of points
+   * @param thread_count Number of threads, 0 for all hardware threads
+   * @throw std::invalid_argument If the first batch has fewer points than
+   * clusters
+   */
+  auto PartialFit(const PointCloud<2, double>& batch,
+                  std::size_t thread_count = 0) -> void;
+
+  /**
+   * @brief Assign points to the nearest centroid
+   * @param points Point cloud
+   * @param labels Output buffer, at least points.Size() elements
+   * @param thread_count Number of threads, 0 for all hardware threads
+   * @throw std::logic_error If there are no centroids
+   */
+  auto Assign(const PointCloud<2, double>& points, uint32_t* labels,
+              std::size_t thread_count = 0) const -> void;
+  /**
+   * @brief Calculate the sum of squared distances to the assigned centroids
+   * @param points Point cloud
+   * @param labels Labels of points
+   * @return double Inertia in squared coordinate unit
+   * @throw std::logic_error If there are no centroids
+   */
+  [[nodiscard]] auto CalculateInertia(const PointCloud<2, double>& points,
+                                      const uint32_t* labels) const -> double;
+
+ protected:
+ private:
+  auto UpdateCentroids(const std::vector<double>& sums) -> void;
+
+  std::size_t cluster_count_{0};   ///< Number of clusters
+  uint64_t seed_{0};               ///< Random seed
+  std::vector<double> centroid_x_;  ///< x of each centroid
+  std::vector<double> centroid_y_;  ///< y of each centroid
+  std::vector<double> weights_;     ///< Points seen per centroid, mini-batch
+};
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_KMEANS_HPP_
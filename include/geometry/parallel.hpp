@@ -0,0 +1,86 @@
+/**
+ * @file geometry/parallel.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Minimal fork-join helper for batch algorithms
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_PARALLEL_HPP_
+#define ZOZIBUSH__GEOMETRY_PARALLEL_HPP_
+
+#include <cstddef>
+#include <type_traits>
+
+namespace zozibush::geometry {
+
+/**
+ * @brief Non-owning reference to a function called as body(begin, end)
+ *
+ * Unlike std::function it never allocates, so handing a lambda with many
+ * captures to ParallelFor costs nothing on the calling thread. The function
+ * must outlive the reference, which holds for a ParallelFor argument.
+ */
+class RangeFunction {
+ public:
+  /**
+   * @brief Construct a new RangeFunction object
+   * @tparam Function Callable as function(begin, end) through a const
+   * reference
+   * @param function Function to refer to
+   */
+  template <typename Function,
+            typename = std::enable_if_t<
+                !std::is_same_v<std::decay_t<Function>, RangeFunction>>>
+  RangeFunction(  // NOLINT(google-explicit-constructor)
+      const Function& function)
+      : function_(static_cast<const void*>(&function)),
+        call_([](const void* stored, std::size_t begin, std::size_t end) {
+          (*static_cast<const Function*>(stored))(begin, end);
+        }) {}
+
+  /**
+   * @brief Call the function
+   * @param begin First index of the range
+   * @param end One past the last index of the range
+   */
+  auto operator()(std::size_t begin, std::size_t end) const -> void {
+    call_(function_, begin, end);
+  }
+
+ protected:
+ private:
+  const void* function_;                                  ///< Function
+  void (*call_)(const void*, std::size_t, std::size_t);  ///< Caller
+};
+
+/**
+ * @brief Get the number of threads used when a thread count of 0 is given
+ * @return std::size_t Hardware concurrency, at least 1
+ */
+[[nodiscard]] auto GetDefaultThreadCount() -> std::size_t;
+
+/**
+ * @brief Run body over [0, count) split into contiguous ranges
+ *
+ * Every range except the last is a multiple of grain elements, so callers
+ * writing packed outputs (e.g. 64-point bitmask words) can pick a grain that
+ * keeps threads off each other's words. The calling thread takes the first
+ * range; no thread is started when one range covers everything. The first
+ * exception thrown by body is rethrown after all ranges finish.
+ *
+ * @param count Number of elements
+ * @param grain Minimum range size, 0 is treated as 1
+ * @param body Function called as body(begin, end)
+ * @param thread_count Number of threads, 0 for GetDefaultThreadCount()
+ */
+auto ParallelFor(std::size_t count, std::size_t grain, RangeFunction body,
+                 std::size_t thread_count = 0) -> void;
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_PARALLEL_HPP_
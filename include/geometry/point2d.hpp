@@ -1,7 +1,7 @@
 /**
  * @file geometry/point2d.hpp
  * @author zozibush (zozibush88@gmail.com)
- * @brief Point class declaration with 2-dimesion
+ * @brief Point class template declaration with 2-dimesion
  * @version 1.0.0
  * @date 2023-12-20
  * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
@@ -13,151 +13,354 @@
 #ifndef ZOZIBUSH__GEOMETRY_POINT_2D_HPP_
 #define ZOZIBUSH__GEOMETRY_POINT_2D_HPP_
 
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
 namespace zozibush::geometry {
 
 /**
  * @brief Point class with 2-dimension
+ *
+ * Instantiated for double, float and int32_t only; Point2D, Point2F and
+ * Point2I name them. Point2D keeps the original double interface, Point2F
+ * halves the memory traffic of large point arrays where float precision is
+ * enough and Point2I is meant for pixel and tile coordinates.
+ *
+ * Point2I arithmetic is range checked instead of overflowing, and scaling it
+ * by a floating point scalar does not compile; convert to Point2D first.
+ *
+ * @tparam T Coordinate value type
  */
-class Point2D {
+template <typename T>
+class Point2 {
  public:
+  static_assert(std::is_arithmetic_v<T>, "T must be an arithmetic type");
+
+  /**
+   * @brief Coordinate value type
+   */
+  using ValueType = T;
+  /**
+   * @brief Type of calculated distances, double for integer coordinates
+   */
+  using DistanceType =
+      std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
   /**
-   * @brief Construct a new Point2D object
+   * @brief Construct a new Point2 object
    */
-  Point2D() = default;
+  Point2() = default;
+  /**
+   * @brief Construct a new Point2 object with x, y, value
+   * @param x T type x coordinate value
+   * @param y T type y coordinate value
+   */
+  Point2(T input_x, T input_y);
+
   /**
-   * @brief Construct a new Point2D object with x, y, value
-   * @param x Double type x coordinate value
-   * @param y Double type y coordinate value
+   * @brief Checked conversion from a point with other coordinate type
+   *
+   * Floating point values converted to an integer type are rounded to the
+   * nearest integer.
+   *
+   * @tparam U Other coordinate value type
+   * @param other Point2 object with other coordinate type
+   * @throw std::out_of_range If a coordinate is not representable in T, e.g.
+   * a nan or inf converted to int32_t or a finite double overflowing float
    */
-  Point2D(double input_x, double input_y);
+  template <typename U>
+  explicit Point2(const Point2<U>& other);
 
   /**
-   * @brief Copy construct a new Point2D object with other Point2D object
-   * @param other Point2D object
+   * @brief Copy construct a new Point2 object with other Point2 object
+   * @param other Point2 object
    */
-  Point2D(const Point2D& other) = default;
+  Point2(const Point2& other) = default;
   /**
-   * @brief Move construct a new Point2D object with other Point2D object
-   * @param other Point2D object
+   * @brief Move construct a new Point2 object with other Point2 object
+   * @param other Point2 object
    */
-  Point2D(Point2D&& other) noexcept = default;
+  Point2(Point2&& other) noexcept = default;
 
   /**
-   * @brief Destroy the Point2D object
+   * @brief Destroy the Point2 object
+   * @note Not virtual, so that Point2 stays trivially copyable and has no
+   * per-point vtable pointer in large arrays.
    */
-  virtual ~Point2D() = default;
+  ~Point2() = default;
 
   /**
    * @brief Copy assignment operator
-   * @param other Point2D object
-   * @return Point2D& Reference of Point2D object
+   * @param other Point2 object
+   * @return Point2& Reference of Point2 object
    */
-  auto operator=(const Point2D& other) -> Point2D& = default;
+  auto operator=(const Point2& other) -> Point2& = default;
   /**
    * @brief Move assignment operator
-   * @param other Point2D object
-   * @return Point2D& Reference of Point2D object
+   * @param other Point2 object
+   * @return Point2& Reference of Point2 object
    */
-  auto operator=(Point2D&& other) -> Point2D& = default;
+  auto operator=(Point2&& other) -> Point2& = default;
 
   /**
    * @brief Calculate distance between this point and target point
-   * @param target Other Point2D object
-   * @return double Euclidean Distance between this point and target point
+   * @param target Other Point2 object
+   * @return DistanceType Euclidean Distance between this point and target
+   * point
    */
-  auto CalculateDistance(const Point2D& target) const -> double;
+  auto CalculateDistance(const Point2& target) const -> DistanceType;
 
   /**
    * @brief Calculate distance between lhs point and rhs point
-   * @param lts left hand size Point2D object
-   * @param rts right hand size Point2D object
-   * @return double Euclidean Distance between lts point and lts point
+   * @param lts left hand size Point2 object
+   * @param rts right hand size Point2 object
+   * @return DistanceType Euclidean Distance between lts point and lts point
    */
-  [[nodiscard]] static auto CalculateDistance(const Point2D& lts,
-                                              const Point2D& rts) -> double;
+  [[nodiscard]] static auto CalculateDistance(const Point2& lts,
+                                              const Point2& rts)
+      -> DistanceType;
   /**
    * @brief Set x coordinate value
-   * @param x Double type input x coordinate value
+   * @param x T type input x coordinate value
    */
-  void SetX(double input_x);
+  void SetX(T input_x);
   /**
    * @brief Set y coordinate value
-   * @param y Double type input y coordinate value
+   * @param y T type input y coordinate value
    */
-  void SetY(double input_y);
+  void SetY(T input_y);
 
   /**
    * @brief Get x coordinate value of this point
-   * @return double x coordinate value of this point
+   * @return T x coordinate value of this point
    */
-  [[nodiscard]] auto GetX() const -> double;
+  [[nodiscard]] auto GetX() const -> T;
   /**
    * @brief Get y coordinate value of this point
-   * @return double y coordinate value of this point
+   * @return T y coordinate value of this point
    */
-  [[nodiscard]] auto GetY() const -> double;
+  [[nodiscard]] auto GetY() const -> T;
 
   /**
    * @brief Add assignment operator
-   * @param other Piont2D object
-   * @return Point2D Calculated Point2D object
+   * @param other Piont2 object
+   * @return Point2 Calculated Point2 object
+   * @throw std::out_of_range If an integer coordinate overflows T
    */
-  auto operator+(const Point2D& other) const -> Point2D;
+  auto operator+(const Point2& other) const -> Point2;
   /**
    * @brief Subtract assignment operator
-   * @param other Piont2D object
-   * @return Point2D Calculated Point2D object
+   * @param other Piont2 object
+   * @return Point2 Calculated Point2 object
+   * @throw std::out_of_range If an integer coordinate overflows T
    */
-  auto operator-(const Point2D& other) const -> Point2D;
+  auto operator-(const Point2& other) const -> Point2;
 
   /**
    * @brief Add and accumulate assigment operator
-   * @param other Reference of Point2D object
-   * @return Point2D& Reference of Point2D object
+   * @param other Reference of Point2 object
+   * @return Point2& Reference of Point2 object
+   * @throw std::out_of_range If an integer coordinate overflows T, leaving
+   * this point unchanged
    */
-  auto operator+=(const Point2D& other) -> Point2D&;
+  auto operator+=(const Point2& other) -> Point2&;
   /**
    * @brief Subtract and accumulate assigment operator
-   * @param other Reference of Point2D object
-   * @return Point2D& Reference of Point2D object
+   * @param other Reference of Point2 object
+   * @return Point2& Reference of Point2 object
+   * @throw std::out_of_range If an integer coordinate overflows T, leaving
+   * this point unchanged
    */
-  auto operator-=(const Point2D& other) -> Point2D&;
+  auto operator-=(const Point2& other) -> Point2&;
 
   /**
    * @brief Multiply assigment operator
-   * @param scalar int
-   * @return Point2D Calculated Point2D object
+   * @param scalar T value
+   * @return Point2 Calculated Point2 object
+   * @throw std::out_of_range If an integer coordinate overflows T
    */
-  auto operator*(double scalar) const -> Point2D;
+  auto operator*(T scalar) const -> Point2;
   /**
    * @brief Divide assigment operator
-   * @param scalar Int value
-   * @return Calculated Point2D object
-   * @throw If scalar==0, don't divide
+   * @param scalar T value
+   * @return Calculated Point2 object
+   * @throw If scalar==0, nan or inf, don't divide
+   * @throw std::out_of_range If an integer coordinate overflows T, i.e. the
+   * lowest value divided by -1
    */
-  auto operator/(double scalar) const -> Point2D;
+  auto operator/(T scalar) const -> Point2;
+
+  /**
+   * @brief Floating point scalars would be truncated for integer coordinates
+   */
+  template <typename U,
+            typename = std::enable_if_t<std::is_integral_v<T> &&
+                                        std::is_floating_point_v<U>>>
+  auto operator*(U scalar) const -> Point2 = delete;
+  /**
+   * @brief Floating point scalars would be truncated for integer coordinates
+   */
+  template <typename U,
+            typename = std::enable_if_t<std::is_integral_v<T> &&
+                                        std::is_floating_point_v<U>>>
+  auto operator/(U scalar) const -> Point2 = delete;
 
   /**
    * @brief Equal operator
-   * @param other Reference of Point2D object
+   * @param other Reference of Point2 object
    * @return true Same this point and other point
    * @return false Different this point and other point
    */
-  auto operator==(const Point2D& other) const -> bool;
+  auto operator==(const Point2& other) const -> bool;
   /**
    * @brief Differ operator
-   * @param other Reference of Point2D object
+   * @param other Reference of Point2 object
    * @return true Different this point and other point
    * @return false Same this point and other point
    */
-  auto operator!=(const Point2D& other) const -> bool;
+  auto operator!=(const Point2& other) const -> bool;
 
  protected:
  private:
-  double x_{0.00};  ///< x coordinate
-  double y_{0.00};  ///< y coordinate
+  T x_{0};  ///< x coordinate
+  T y_{0};  ///< y coordinate
 };
 
+/**
+ * @brief Point with double coordinates
+ */
+using Point2D = Point2<double>;
+/**
+ * @brief Point with float coordinates
+ */
+using Point2F = Point2<float>;
+/**
+ * @brief Point with int32_t coordinates
+ */
+using Point2I = Point2<int32_t>;
+
+namespace internal {
+/**
+ * @brief Convert a coordinate to another type, checking its range
+ *
+ * Floating point values converted to an integer type are rounded to the
+ * nearest integer.
+ *
+ * @tparam To Target coordinate type
+ * @tparam From Source coordinate type
+ * @param value Coordinate value
+ * @return To Converted value
+ * @throw std::out_of_range If value is not representable in To
+ */
+template <typename To, typename From>
+auto CheckedConvert(From value) -> To {
+  if constexpr (std::is_same_v<To, From>) {
+    return value;
+  } else if constexpr (std::is_floating_point_v<From> &&
+                       std::is_floating_point_v<To>) {
+    const auto kResult{static_cast<To>(value)};
+    if (std::isfinite(value) && !std::isfinite(kResult)) {
+      throw std::out_of_range("coordinate overflows the target type");
+    }
+    return kResult;
+  } else if constexpr (std::is_floating_point_v<From>) {
+    // Compare in the floating point domain; the bounds are exact powers of
+    // two for every integer type in use.
+    const auto kRounded{std::nearbyint(value)};
+    constexpr auto kLowest{
+        static_cast<From>(std::numeric_limits<To>::lowest())};
+    constexpr auto kUpper{-kLowest};
+    if (!(kRounded >= kLowest && kRounded < kUpper)) {
+      throw std::out_of_range("coordinate is not representable as integer");
+    }
+    return static_cast<To>(kRounded);
+  } else if constexpr (std::is_integral_v<To>) {
+    if (value < static_cast<From>(std::numeric_limits<To>::lowest()) ||
+        value > static_cast<From>(std::numeric_limits<To>::max())) {
+      throw std::out_of_range("coordinate overflows the target type");
+    }
+    return static_cast<To>(value);
+  } else {
+    return static_cast<To>(value);
+  }
+}
+
+/**
+ * @brief Apply an arithmetic operation to two coordinates
+ *
+ * Integer coordinates are combined in int64_t and range checked, since
+ * int32_t overflow is undefined behavior. Floating point coordinates are
+ * combined directly.
+ *
+ * @tparam T Coordinate value type
+ * @tparam Operation e.g. std::plus<>
+ * @param lhs Left operand
+ * @param rhs Right operand
+ * @param operation Operation applied to both
+ * @return T Result
+ * @throw std::out_of_range If an integer result overflows T
+ */
+template <typename T, typename Operation>
+auto CombineCoordinates(T lhs, T rhs, Operation operation) -> T {
+  if constexpr (std::is_integral_v<T>) {
+    static_assert(sizeof(T) < sizeof(int64_t),
+                  "integer coordinates must be narrower than int64_t");
+    return CheckedConvert<T>(
+        operation(static_cast<int64_t>(lhs), static_cast<int64_t>(rhs)));
+  } else {
+    return operation(lhs, rhs);
+  }
+}
+}  // namespace internal
+
+// Defined here rather than in point2d.cpp so that loops over point arrays,
+// e.g. evaluated point expressions, can inline and vectorize them.
+template <typename T>
+inline Point2<T>::Point2(T input_x, T input_y) : x_(input_x), y_(input_y) {}
+template <typename T>
+inline auto Point2<T>::GetX() const -> T {
+  return x_;
+}
+template <typename T>
+inline auto Point2<T>::GetY() const -> T {
+  return y_;
+}
+
+extern template class Point2<double>;
+extern template class Point2<float>;
+extern template class Point2<int32_t>;
+
 }  // namespace zozibush::geometry
 
+namespace std {
+/**
+ * @brief Hash of Point2 consistent with its exact operator==
+ *
+ * Both coordinates are hashed by their bit patterns with -0 folded into +0,
+ * and the result is fully mixed, so every bit of the hash can be used as a
+ * table index or tag.
+ *
+ * @tparam T Coordinate value type
+ */
+template <typename T>
+struct hash<zozibush::geometry::Point2<T>> {
+  /**
+   * @brief Calculate the hash of a point
+   * @param point Point2 object
+   * @return std::size_t Hash value
+   */
+  auto operator()(const zozibush::geometry::Point2<T>& point) const noexcept
+      -> std::size_t;
+};
+
+extern template struct hash<zozibush::geometry::Point2<double>>;
+extern template struct hash<zozibush::geometry::Point2<float>>;
+extern template struct hash<zozibush::geometry::Point2<int32_t>>;
+}  // namespace std
+
 #endif
@@ -0,0 +1,143 @@
+/**
+ * @file geometry/point_cloud.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Structure-of-arrays point container declaration
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_POINT_CLOUD_HPP_
+#define ZOZIBUSH__GEOMETRY_POINT_CLOUD_HPP_
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "geometry/point2d.hpp"
+#include "geometry/point_n.hpp"
+
+namespace zozibush::geometry {
+
+/**
+ * @brief Point container storing one contiguous array per axis
+ *
+ * Batch kernels stream each axis array independently, so consecutive points
+ * fill whole SIMD registers. Instantiated for D = 2, 3 and T = float, double.
+ *
+ * @tparam D Number of dimensions
+ * @tparam T Coordinate value type
+ */
+template <std::size_t D, typename T = double>
+class PointCloud {
+ public:
+  /**
+   * @brief Number of dimensions
+   */
+  static constexpr std::size_t kDimension{D};
+  /**
+   * @brief Coordinate value type
+   */
+  using ValueType = T;
+  /**
+   * @brief Point type of this container
+   */
+  using PointType = PointN<D, T>;
+
+  /**
+   * @brief Construct an empty PointCloud object
+   */
+  PointCloud() = default;
+  /**
+   * @brief Construct a PointCloud object with points
+   * @param points Points to copy
+   */
+  explicit PointCloud(const std::vector<PointType>& points);
+
+  /**
+   * @brief Get the number of points
+   * @return std::size_t Number of points
+   */
+  [[nodiscard]] auto Size() const -> std::size_t;
+  /**
+   * @brief Check whether there is no point
+   * @return true If empty
+   * @return false If not empty
+   */
+  [[nodiscard]] auto Empty() const -> bool;
+  /**
+   * @brief Reserve memory of every axis array
+   * @param capacity Number of points
+   */
+  auto Reserve(std::size_t capacity) -> void;
+  /**
+   * @brief Resize every axis array, new points are at the origin
+   * @param size Number of points
+   * @throw std::bad_alloc If memory runs out, leaving the size unchanged
+   */
+  auto Resize(std::size_t size) -> void;
+  /**
+   * @brief Remove all points
+   */
+  auto Clear() -> void;
+
+  /**
+   * @brief Append a point
+   * @param point PointN object
+   * @throw std::bad_alloc If memory runs out, leaving the cloud unchanged
+   */
+  auto PushBack(const PointType& point) -> void;
+  /**
+   * @brief Get a point
+   * @param index Point index
+   * @return PointType PointN object
+   * @throw std::out_of_range If index is not less than Size()
+   */
+  [[nodiscard]] auto Get(std::size_t index) const -> PointType;
+  /**
+   * @brief Replace a point
+   * @param index Point index
+   * @param point PointN object
+   * @throw std::out_of_range If index is not less than Size()
+   */
+  auto Set(std::size_t index, const PointType& point) -> void;
+
+  /**
+   * @brief Get the coordinate array of one axis
+   * @param axis Axis index, less than D
+   * @return const T* Size() contiguous values
+   */
+  [[nodiscard]] auto Data(std::size_t axis) const -> const T*;
+  /**
+   * @brief Get the mutable coordinate array of one axis
+   * @param axis Axis index, less than D
+   * @return T* Size() contiguous values
+   */
+  auto Data(std::size_t axis) -> T*;
+
+ protected:
+ private:
+  std::array<std::vector<T>, D> axes_;  ///< One array per axis
+};
+
+/**
+ * @brief Build a 2-dimension point cloud from Point2 objects
+ * @tparam T Coordinate value type, float or double
+ * @param points Point2 objects
+ * @return PointCloud<2, T> Point cloud
+ */
+template <typename T>
+[[nodiscard]] auto MakePointCloud(const std::vector<Point2<T>>& points)
+    -> PointCloud<2, T>;
+
+extern template class PointCloud<2, float>;
+extern template class PointCloud<2, double>;
+extern template class PointCloud<3, float>;
+extern template class PointCloud<3, double>;
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_POINT_CLOUD_HPP_
@@ -0,0 +1,82 @@
+/**
+ * @file geometry/point_deduplicator.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Tolerance-snapped point deduplication declaration
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_POINT_DEDUPLICATOR_HPP_
+#define ZOZIBUSH__GEOMETRY_POINT_DEDUPLICATOR_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud.hpp"
+
+namespace zozibush::geometry {
+
+/**
+ * @brief Remove points that snap to the same grid cell
+ *
+ * Cell (i, j) holds the points with floor(x / tolerance) == i and
+ * floor(y / tolerance) == j, and only the lowest index point of each cell
+ * is kept. A zero tolerance keeps one point per exact coordinate pair.
+ *
+ * Points are partitioned by the hash of their cell with a parallel counting
+ * sort that preserves index order, then every partition is deduplicated
+ * with its own PointHashMap small enough to stay in cache. The result does
+ * not depend on the thread count.
+ */
+class PointDeduplicator {
+ public:
+  /**
+   * @brief Construct a new PointDeduplicator object
+   * @param tolerance The cell size, 0 for exact duplicates only
+   * @param unit The unit of the coordinates
+   * @throw std::invalid_argument If tolerance is negative
+   */
+  explicit PointDeduplicator(const Distance& tolerance,
+                             Distance::Type unit = Distance::Type::kMeter);
+
+  /**
+   * @brief Get the cell of a point
+   * @param point Point2D object
+   * @return Point2D Integer cell coordinates, or the point itself for a
+   * zero tolerance
+   */
+  [[nodiscard]] auto Snap(const Point2D& point) const -> Point2D;
+
+  /**
+   * @brief Find the points to keep
+   * @param points Point cloud
+   * @param indices Cleared, then filled with the kept point indices in
+   * ascending order
+   * @param representatives Optional output buffer, at least points.Size()
+   * elements, receives the kept point index of each point's cell
+   * @param thread_count Number of threads, 0 for all hardware threads
+   * @return std::size_t Number of kept points
+   * @throw std::out_of_range If a coordinate is nan or inf
+   * @throw std::length_error If there are 2^32 or more points
+   */
+  auto Deduplicate(const PointCloud<2, double>& points,
+                   std::vector<std::size_t>& indices,
+                   std::size_t* representatives = nullptr,
+                   std::size_t thread_count = 0) const -> std::size_t;
+
+ protected:
+ private:
+  [[nodiscard]] auto Snap(double input_x, double input_y) const -> Point2D;
+
+  double tolerance_{0.0};  ///< Cell size in coordinate unit
+};
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_POINT_DEDUPLICATOR_HPP_
@@ -0,0 +1,558 @@
+/**
+ * @file geometry/point_expression.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Lazy arithmetic on points and point arrays
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_POINT_EXPRESSION_HPP_
+#define ZOZIBUSH__GEOMETRY_POINT_EXPRESSION_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud.hpp"
+
+namespace zozibush::geometry {
+
+/**
+ * @brief Base of lazy point expressions
+ *
+ * Lazy() wraps a point, a point array or a point cloud. The +, -, * and /
+ * operators on the result build a tree of small nodes instead of computing
+ * anything, e.g. (Lazy(a) + b - c) * s / t. Converting a point expression
+ * to Point2 evaluates it in one step. Assign() evaluates an array
+ * expression in one loop over the elements, with no intermediate arrays.
+ * Each element gets the same operations in the same order as the eager
+ * Point2 operators, so results are identical, and integer overflow throws
+ * std::out_of_range during evaluation as it does there.
+ *
+ * Nodes store their operands by value, so an expression can be kept in an
+ * auto variable. Array terms only point to their arrays, which must outlive
+ * the expression, as with std::string_view. A point operand is used for
+ * every element of an array operand. Array sizes and divisors are checked
+ * once, when the expression is built.
+ *
+ * @tparam Derived Node type
+ * @tparam T Coordinate value type
+ */
+template <typename Derived, typename T>
+class PointExpression {
+ public:
+  /**
+   * @brief Coordinate value type
+   */
+  using ValueType = T;
+
+  /**
+   * @brief Get the node as its own type
+   * @return const Derived& Reference of the node
+   */
+  [[nodiscard]] auto Self() const -> const Derived& {
+    return static_cast<const Derived&>(*this);
+  }
+  /**
+   * @brief Evaluate a point expression
+   * @return Point2<T> Value of the expression
+   */
+  [[nodiscard]] auto Evaluate() const -> Point2<T> {
+    static_assert(!Derived::kIsArray, "array expressions need Assign()");
+    return Point2<T>(Self().GetX(0), Self().GetY(0));
+  }
+  /**
+   * @brief Evaluate a point expression on conversion
+   * @return Point2<T> Value of the expression
+   */
+  operator Point2<T>() const {  // NOLINT(google-explicit-constructor)
+    return Evaluate();
+  }
+};
+
+/**
+ * @brief A single point, used for every element
+ * @tparam T Coordinate value type
+ */
+template <typename T>
+class PointTerm : public PointExpression<PointTerm<T>, T> {
+ public:
+  static constexpr bool kIsArray{false};  ///< Whether the node has elements
+
+  /**
+   * @brief Construct a new PointTerm object
+   * @param point Point2 object, copied
+   */
+  explicit PointTerm(const Point2<T>& point)
+      : x_(point.GetX()), y_(point.GetY()) {}
+
+  /**
+   * @brief Get the number of elements
+   * @return std::size_t 0, a point has no elements
+   */
+  [[nodiscard]] auto Size() const -> std::size_t { return 0; }
+  /**
+   * @brief Get the x coordinate of an element
+   * @return T x coordinate of the point
+   */
+  [[nodiscard]] auto GetX(std::size_t /*index*/) const -> T { return x_; }
+  /**
+   * @brief Get the y coordinate of an element
+   * @return T y coordinate of the point
+   */
+  [[nodiscard]] auto GetY(std::size_t /*index*/) const -> T { return y_; }
+
+ protected:
+ private:
+  T x_{0};  ///< x coordinate
+  T y_{0};  ///< y coordinate
+};
+
+/**
+ * @brief An array of Point2 objects
+ * @tparam T Coordinate value type
+ */
+template <typename T>
+class PointArrayTerm : public PointExpression<PointArrayTerm<T>, T> {
+ public:
+  static constexpr bool kIsArray{true};  ///< Whether the node has elements
+
+  /**
+   * @brief Construct a new PointArrayTerm object
+   * @param points First point, not copied
+   * @param count Number of points
+   */
+  PointArrayTerm(const Point2<T>* points, std::size_t count)
+      : points_(points), count_(count) {}
+
+  /**
+   * @brief Get the number of elements
+   * @return std::size_t Number of points
+   */
+  [[nodiscard]] auto Size() const -> std::size_t { return count_; }
+  /**
+   * @brief Get the x coordinate of an element
+   * @param index Element index
+   * @return T x coordinate
+   */
+  [[nodiscard]] auto GetX(std::size_t index) const -> T {
+    return points_[index].GetX();
+  }
+  /**
+   * @brief Get the y coordinate of an element
+   * @param index Element index
+   * @return T y coordinate
+   */
+  [[nodiscard]] auto GetY(std::size_t index) const -> T {
+    return points_[index].GetY();
+  }
+
+ protected:
+ private:
+  const Point2<T>* points_{nullptr};  ///< First point
+  std::size_t count_{0};              ///< Number of points
+};
+
+/**
+ * @brief The points of a 2-dimension PointCloud
+ * @tparam T Coordinate value type
+ */
+template <typename T>
+class PointCloudTerm : public PointExpression<PointCloudTerm<T>, T> {
+ public:
+  static constexpr bool kIsArray{true};  ///< Whether the node has elements
+
+  /**
+   * @brief Construct a new PointCloudTerm object
+   * @param cloud Point cloud, not copied; must not be resized meanwhile
+   */
+  explicit PointCloudTerm(const PointCloud<2, T>& cloud)
+      : x_values_(cloud.Data(0)),
+        y_values_(cloud.Data(1)),
+        count_(cloud.Size()) {}
+
+  /**
+   * @brief Get the number of elements
+   * @return std::size_t Number of points
+   */
+  [[nodiscard]] auto Size() const -> std::size_t { return count_; }
+  /**
+   * @brief Get the x coordinate of an element
+   * @param index Element index
+   * @return T x coordinate
+   */
+  [[nodiscard]] auto GetX(std::size_t index) const -> T {
+    return x_values_[index];
+  }
+  /**
+   * @brief Get the y coordinate of an element
+   * @param index Element index
+   * @return T y coordinate
+   */
+  [[nodiscard]] auto GetY(std::size_t index) const -> T {
+    return y_values_[index];
+  }
+
+ protected:
+ private:
+  const T* x_values_{nullptr};  ///< x coordinates
+  const T* y_values_{nullptr};  ///< y coordinates
+  std::size_t count_{0};        ///< Number of points
+};
+
+namespace internal {
+// Combines the sizes of two operands. Whether an operand is a point comes
+// from its node type, since an empty array also has size 0.
+template <bool IsLhsArray, bool IsRhsArray>
+auto CombineSizes(std::size_t lhs, std::size_t rhs) -> std::size_t {
+  if constexpr (IsLhsArray && IsRhsArray) {
+    if (lhs != rhs) {
+      throw std::invalid_argument("point arrays differ in size");
+    }
+    return lhs;
+  } else if constexpr (IsLhsArray) {
+    return lhs;
+  } else {
+    return rhs;
+  }
+}
+
+// The checks of Point2::operator/, made once per expression.
+template <typename T>
+auto CheckDivisor(T scalar) -> void {
+  if constexpr (std::is_floating_point_v<T>) {
+    if (std::isnan(scalar) || std::isinf(scalar)) {
+      throw std::invalid_argument("scalar is nan or inf");
+    }
+  }
+  if (scalar == T{0}) {
+    throw std::invalid_argument("scalar is 0, don't divide 0.");
+  }
+}
+
+// The arithmetic of the Point2 operators, range checked for integers.
+struct Add {
+  template <typename T>
+  static auto Apply(T lhs, T rhs) -> T {
+    return CombineCoordinates(lhs, rhs, std::plus<>{});
+  }
+};
+struct Subtract {
+  template <typename T>
+  static auto Apply(T lhs, T rhs) -> T {
+    return CombineCoordinates(lhs, rhs, std::minus<>{});
+  }
+};
+struct Multiply {
+  template <typename T>
+  static auto Apply(T lhs, T rhs) -> T {
+    return CombineCoordinates(lhs, rhs, std::multiplies<>{});
+  }
+};
+struct Divide {
+  template <typename T>
+  static auto Apply(T lhs, T rhs) -> T {
+    return CombineCoordinates(lhs, rhs, std::divides<>{});
+  }
+};
+
+// Rejects floating point scalars for integer coordinates, as Point2 does.
+template <typename T, typename U>
+using EnableIfTruncated =
+    std::enable_if_t<std::is_integral_v<T> && std::is_floating_point_v<U>>;
+}  // namespace internal
+
+/**
+ * @brief Sum or difference of two point expressions
+ * @tparam Operation internal::Add or internal::Subtract
+ * @tparam L Left operand node
+ * @tparam R Right operand node
+ * @tparam T Coordinate value type
+ */
+template <typename Operation, typename L, typename R, typename T>
+class PointBinary
+    : public PointExpression<PointBinary<Operation, L, R, T>, T> {
+ public:
+  static constexpr bool kIsArray{L::kIsArray || R::kIsArray};  ///< Elements
+
+  /**
+   * @brief Construct a new PointBinary object
+   * @param lhs Left operand, copied
+   * @param rhs Right operand, copied
+   * @throw std::invalid_argument If both operands are arrays of different
+   * sizes, an empty one included
+   */
+  PointBinary(const L& lhs, const R& rhs)
+      : lhs_(lhs),
+        rhs_(rhs),
+        size_(internal::CombineSizes<L::kIsArray, R::kIsArray>(lhs.Size(),
+                                                                rhs.Size())) {}
+
+  /**
+   * @brief Get the number of elements
+   * @return std::size_t Number of elements, 0 for a point
+   */
+  [[nodiscard]] auto Size() const -> std::size_t { return size_; }
+  /**
+   * @brief Get the x coordinate of an element
+   * @param index Element index
+   * @return T x coordinate
+   */
+  [[nodiscard]] auto GetX(std::size_t index) const -> T {
+    return Operation::Apply(lhs_.GetX(index), rhs_.GetX(index));
+  }
+  /**
+   * @brief Get the y coordinate of an element
+   * @param index Element index
+   * @return T y coordinate
+   */
+  [[nodiscard]] auto GetY(std::size_t index) const -> T {
+    return Operation::Apply(lhs_.GetY(index), rhs_.GetY(index));
+  }
+
+ protected:
+ private:
+  L lhs_;                 ///< Left operand
+  R rhs_;                 ///< Right operand
+  std::size_t size_{0};  ///< Number of elements
+};
+
+/**
+ * @brief Point expression multiplied or divided by a scalar
+ * @tparam Operation internal::Multiply or internal::Divide
+ * @tparam E Operand node
+ * @tparam T Coordinate value type
+ */
+template <typename Operation, typename E, typename T>
+class PointScaled : public PointExpression<PointScaled<Operation, E, T>, T> {
+ public:
+  static constexpr bool kIsArray{E::kIsArray};  ///< Whether it has elements
+
+  /**
+   * @brief Construct a new PointScaled object
+   * @param operand Operand, copied
+   * @param scalar Factor or divisor, already checked
+   */
+  PointScaled(const E& operand, T scalar)
+      : operand_(operand), scalar_(scalar) {}
+
+  /**
+   * @brief Get the number of elements
+   * @return std::size_t Number of elements, 0 for a point
+   */
+  [[nodiscard]] auto Size() const -> std::size_t { return operand_.Size(); }
+  /**
+   * @brief Get the x coordinate of an element
+   * @param index Element index
+   * @return T x coordinate
+   */
+  [[nodiscard]] auto GetX(std::size_t index) const -> T {
+    return Operation::Apply(operand_.GetX(index), scalar_);
+  }
+  /**
+   * @brief Get the y coordinate of an element
+   * @param index Element index
+   * @return T y coordinate
+   */
+  [[nodiscard]] auto GetY(std::size_t index) const -> T {
+    return Operation::Apply(operand_.GetY(index), scalar_);
+  }
+
+ protected:
+ private:
+  E operand_;    ///< Operand
+  T scalar_{0};  ///< Factor or divisor
+};
+
+/**
+ * @brief Start a lazy expression with a point
+ * @tparam T Coordinate value type
+ * @param point Point2 object, copied
+ * @return PointTerm<T> Point term
+ */
+template <typename T>
+auto Lazy(const Point2<T>& point) -> PointTerm<T> {
+  return PointTerm<T>(point);
+}
+/**
+ * @brief Start a lazy expression with a point array
+ * @tparam T Coordinate value type
+ * @param points Point array, must outlive the expression
+ * @return PointArrayTerm<T> Array term
+ */
+template <typename T>
+auto Lazy(const std::vector<Point2<T>>& points) -> PointArrayTerm<T> {
+  return PointArrayTerm<T>(points.data(), points.size());
+}
+/**
+ * @brief Start a lazy expression with a point cloud
+ * @tparam T Coordinate value type
+ * @param cloud Point cloud, must outlive the expression
+ * @return PointCloudTerm<T> Cloud term
+ */
+template <typename T>
+auto Lazy(const PointCloud<2, T>& cloud) -> PointCloudTerm<T> {
+  return PointCloudTerm<T>(cloud);
+}
+
+/**
+ * @brief Sum of two expressions
+ * @return PointBinary Lazy sum
+ * @throw std::invalid_argument If both are arrays of different sizes
+ */
+template <typename L, typename R, typename T>
+auto operator+(const PointExpression<L, T>& lhs,
+               const PointExpression<R, T>& rhs)
+    -> PointBinary<internal::Add, L, R, T> {
+  return {lhs.Self(), rhs.Self()};
+}
+/**
+ * @brief Sum of an expression and a point
+ * @return PointBinary Lazy sum
+ */
+template <typename L, typename T>
+auto operator+(const PointExpression<L, T>& lhs, const Point2<T>& rhs)
+    -> PointBinary<internal::Add, L, PointTerm<T>, T> {
+  return {lhs.Self(), PointTerm<T>(rhs)};
+}
+/**
+ * @brief Sum of a point and an expression
+ * @return PointBinary Lazy sum
+ */
+template <typename R, typename T>
+auto operator+(const Point2<T>& lhs, const PointExpression<R, T>& rhs)
+    -> PointBinary<internal::Add, PointTerm<T>, R, T> {
+  return {PointTerm<T>(lhs), rhs.Self()};
+}
+
+/**
+ * @brief Difference of two expressions
+ * @return PointBinary Lazy difference
+ * @throw std::invalid_argument If both are arrays of different sizes
+ */
+template <typename L, typename R, typename T>
+auto operator-(const PointExpression<L, T>& lhs,
+               const PointExpression<R, T>& rhs)
+    -> PointBinary<internal::Subtract, L, R, T> {
+  return {lhs.Self(), rhs.Self()};
+}
+/**
+ * @brief Difference of an expression and a point
+ * @return PointBinary Lazy difference
+ */
+template <typename L, typename T>
+auto operator-(const PointExpression<L, T>& lhs, const Point2<T>& rhs)
+    -> PointBinary<internal::Subtract, L, PointTerm<T>, T> {
+  return {lhs.Self(), PointTerm<T>(rhs)};
+}
+/**
+ * @brief Difference of a point and an expression
+ * @return PointBinary Lazy difference
+ */
+template <typename R, typename T>
+auto operator-(const Point2<T>& lhs, const PointExpression<R, T>& rhs)
+    -> PointBinary<internal::Subtract, PointTerm<T>, R, T> {
+  return {PointTerm<T>(lhs), rhs.Self()};
+}
+
+/**
+ * @brief Expression multiplied by a scalar
+ * @return PointScaled Lazy product
+ */
+template <typename E, typename T>
+auto operator*(const PointExpression<E, T>& operand,
+               std::common_type_t<T> scalar)
+    -> PointScaled<internal::Multiply, E, T> {
+  return {operand.Self(), scalar};
+}
+/**
+ * @brief Expression multiplied by a scalar
+ * @return PointScaled Lazy product
+ */
+template <typename E, typename T>
+auto operator*(std::common_type_t<T> scalar,
+               const PointExpression<E, T>& operand)
+    -> PointScaled<internal::Multiply, E, T> {
+  return {operand.Self(), scalar};
+}
+/**
+ * @brief Expression divided by a scalar
+ * @return PointScaled Lazy quotient
+ * @throw std::invalid_argument If scalar is 0, nan or inf, checked here
+ * rather than per element
+ */
+template <typename E, typename T>
+auto operator/(const PointExpression<E, T>& operand,
+               std::common_type_t<T> scalar)
+    -> PointScaled<internal::Divide, E, T> {
+  internal::CheckDivisor(scalar);
+  return {operand.Self(), scalar};
+}
+
+/**
+ * @brief Floating point scalars would be truncated for integer coordinates
+ */
+template <typename E, typename T, typename U,
+          typename = internal::EnableIfTruncated<T, U>>
+auto operator*(const PointExpression<E, T>& operand, U scalar) -> void = delete;
+/**
+ * @brief Floating point scalars would be truncated for integer coordinates
+ */
+template <typename E, typename T, typename U,
+          typename = internal::EnableIfTruncated<T, U>>
+auto operator*(U scalar, const PointExpression<E, T>& operand) -> void = delete;
+/**
+ * @brief Floating point scalars would be truncated for integer coordinates
+ */
+template <typename E, typename T, typename U,
+          typename = internal::EnableIfTruncated<T, U>>
+auto operator/(const PointExpression<E, T>& operand, U scalar) -> void = delete;
+
+/**
+ * @brief Evaluate an array expression into a point array
+ * @param expression Array expression
+ * @param output Resized to the expression size; may be an operand
+ */
+template <typename E, typename T>
+auto Assign(const PointExpression<E, T>& expression,
+            std::vector<Point2<T>>& output) -> void {
+  static_assert(E::kIsArray, "point expressions convert to Point2");
+  const auto& kNode{expression.Self()};
+  const auto kCount{kNode.Size()};
+  output.resize(kCount);
+  auto* points{output.data()};
+  for (std::size_t i = 0; i < kCount; ++i) {
+    points[i] = Point2<T>(kNode.GetX(i), kNode.GetY(i));
+  }
+}
+/**
+ * @brief Evaluate an array expression into a point cloud
+ * @param expression Array expression
+ * @param output Resized to the expression size; may be an operand
+ */
+template <typename E, typename T>
+auto Assign(const PointExpression<E, T>& expression, PointCloud<2, T>& output)
+    -> void {
+  static_assert(E::kIsArray, "point expressions convert to Point2");
+  const auto& kNode{expression.Self()};
+  const auto kCount{kNode.Size()};
+  output.Resize(kCount);
+  auto* x_values{output.Data(0)};
+  auto* y_values{output.Data(1)};
+  for (std::size_t i = 0; i < kCount; ++i) {
+    x_values[i] = kNode.GetX(i);
+    y_values[i] = kNode.GetY(i);
+  }
+}
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_POINT_EXPRESSION_HPP_
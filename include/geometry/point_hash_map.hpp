@@ -0,0 +1,363 @@
+/**
+ * @file geometry/point_hash_map.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Flat open-addressing hash map and set keyed on Point2D
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_POINT_HASH_MAP_HPP_
+#define ZOZIBUSH__GEOMETRY_POINT_HASH_MAP_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "geometry/point2d.hpp"
+
+namespace zozibush::geometry {
+namespace internal {
+/**
+ * @brief Mapped type of PointHashSet
+ */
+struct NoValue {};
+}  // namespace internal
+
+/**
+ * @brief Flat open-addressing hash map keyed on Point2D
+ *
+ * Keys, values and one control byte per slot live in three flat arrays. A
+ * control byte is 0 for an empty slot, otherwise the low 7 hash bits with
+ * the high bit set, so a probe mostly reads the dense control array and
+ * compares keys only on a tag match. Collisions are resolved by linear
+ * probing from the slot given by the high hash bits, and Erase shifts the
+ * following entries back instead of leaving tombstones. The table doubles
+ * at 3/4 load.
+ *
+ * Keys compare with the exact Point2D::operator==; snap near-identical
+ * points to a grid first to merge them, see PointDeduplicator. Pointers
+ * returned by Find and Insert stay valid until the next Insert that grows
+ * the table or the next Erase. Header only so that the probe loop inlines.
+ *
+ * @tparam Value Mapped type, default constructible and movable
+ */
+template <typename Value>
+class PointHashMap {
+ public:
+  /**
+   * @brief Construct an empty PointHashMap object without allocation
+   */
+  PointHashMap() = default;
+  /**
+   * @brief Construct an empty PointHashMap object
+   * @param count Number of entries that fit without growing
+   */
+  explicit PointHashMap(std::size_t count) { Reserve(count); }
+
+  /**
+   * @brief Get the number of entries
+   * @return std::size_t Number of entries
+   */
+  [[nodiscard]] auto Size() const -> std::size_t { return size_; }
+  /**
+   * @brief Check whether there is no entry
+   * @return true If empty
+   * @return false If not empty
+   */
+  [[nodiscard]] auto Empty() const -> bool { return size_ == 0; }
+  /**
+   * @brief Get the number of slots
+   * @return std::size_t Number of slots, 0 or a power of two
+   */
+  [[nodiscard]] auto Capacity() const -> std::size_t {
+    return controls_.size();
+  }
+  /**
+   * @brief Remove all entries, keeping the slots
+   */
+  auto Clear() -> void {
+    std::fill(controls_.begin(), controls_.end(), kEmpty);
+    std::fill(values_.begin(), values_.end(), Value{});
+    size_ = 0;
+  }
+  /**
+   * @brief Grow the table so that count entries fit without growing
+   * @param count Number of entries
+   */
+  auto Reserve(std::size_t count) -> void {
+    auto capacity{std::max(Capacity(), kMinimumCapacity)};
+    while (count * 4 > capacity * 3) {
+      capacity *= 2;
+    }
+    if (capacity != Capacity()) {
+      Rehash(capacity);
+    }
+  }
+
+  /**
+   * @brief Insert an entry unless the key is already present
+   * @param key Point2D key
+   * @param value Value stored for a new key, dropped otherwise
+   * @return std::pair<Value*, bool> Stored value and whether it was inserted
+   * @throw std::out_of_range If a coordinate of key is nan
+   */
+  auto Insert(const Point2D& key, Value value) -> std::pair<Value*, bool> {
+    if (std::isnan(key.GetX()) || std::isnan(key.GetY())) {
+      throw std::out_of_range("point coordinate is nan");
+    }
+    if ((size_ + 1) * 4 > Capacity() * 3) {
+      Rehash(std::max(Capacity() * 2, kMinimumCapacity));
+    }
+    const auto kHash{std::hash<Point2D>{}(key)};
+    const auto kTag{GetTag(kHash)};
+    for (auto slot = GetSlot(kHash);; slot = (slot + 1) & mask_) {
+      if (controls_[slot] == kEmpty) {
+        controls_[slot] = kTag;
+        keys_[slot] = key;
+        values_[slot] = std::move(value);
+        ++size_;
+        return {&values_[slot], true};
+      }
+      if (controls_[slot] == kTag && keys_[slot] == key) {
+        return {&values_[slot], false};
+      }
+    }
+  }
+  /**
+   * @brief Get the value of a key, inserting a default value if absent
+   * @param key Point2D key
+   * @return Value& Stored value
+   * @throw std::out_of_range If a coordinate of key is nan
+   */
+  auto operator[](const Point2D& key) -> Value& {
+    return *Insert(key, Value{}).first;
+  }
+  /**
+   * @brief Find the value of a key
+   * @param key Point2D key
+   * @return const Value* Stored value or nullptr
+   */
+  [[nodiscard]] auto Find(const Point2D& key) const -> const Value* {
+    const auto kSlot{FindSlot(key)};
+    return (kSlot == kNotFound) ? nullptr : &values_[kSlot];
+  }
+  /**
+   * @brief Find the mutable value of a key
+   * @param key Point2D key
+   * @return Value* Stored value or nullptr
+   */
+  auto Find(const Point2D& key) -> Value* {
+    const auto kSlot{FindSlot(key)};
+    return (kSlot == kNotFound) ? nullptr : &values_[kSlot];
+  }
+  /**
+   * @brief Check whether a key is present
+   * @param key Point2D key
+   * @return true If present
+   * @return false If absent
+   */
+  [[nodiscard]] auto Contains(const Point2D& key) const -> bool {
+    return FindSlot(key) != kNotFound;
+  }
+  /**
+   * @brief Remove the entry of a key
+   * @param key Point2D key
+   * @return true If an entry was removed
+   * @return false If the key was absent
+   */
+  auto Erase(const Point2D& key) -> bool {
+    auto hole{FindSlot(key)};
+    if (hole == kNotFound) {
+      return false;
+    }
+    // An entry may move into the hole unless its home slot lies strictly
+    // between the hole and the entry along the probe sequence.
+    for (auto slot = (hole + 1) & mask_; controls_[slot] != kEmpty;
+         slot = (slot + 1) & mask_) {
+      const auto kHome{GetSlot(std::hash<Point2D>{}(keys_[slot]))};
+      if (((slot - kHome) & mask_) >= ((slot - hole) & mask_)) {
+        controls_[hole] = controls_[slot];
+        keys_[hole] = keys_[slot];
+        values_[hole] = std::move(values_[slot]);
+        hole = slot;
+      }
+    }
+    controls_[hole] = kEmpty;
+    values_[hole] = Value{};
+    --size_;
+    return true;
+  }
+
+  /**
+   * @brief Call function for every entry, in slot order
+   * @tparam Function Callable as function(const Point2D&, const Value&)
+   * @param function Function object
+   */
+  template <typename Function>
+  auto ForEach(Function&& function) const -> void {
+    for (std::size_t slot = 0; slot < Capacity(); ++slot) {
+      if (controls_[slot] != kEmpty) {
+        function(keys_[slot], values_[slot]);
+      }
+    }
+  }
+
+ protected:
+ private:
+  static constexpr std::size_t kMinimumCapacity{16};
+  static constexpr std::size_t kNotFound{
+      std::numeric_limits<std::size_t>::max()};
+  static constexpr uint8_t kEmpty{0};
+
+  [[nodiscard]] auto GetSlot(std::size_t hash) const -> std::size_t {
+    return hash >> shift_;
+  }
+  [[nodiscard]] static auto GetTag(std::size_t hash) -> uint8_t {
+    return static_cast<uint8_t>(hash | 0x80U);
+  }
+  [[nodiscard]] auto FindSlot(const Point2D& key) const -> std::size_t {
+    if (size_ == 0) {
+      return kNotFound;
+    }
+    const auto kHash{std::hash<Point2D>{}(key)};
+    const auto kTag{GetTag(kHash)};
+    for (auto slot = GetSlot(kHash);; slot = (slot + 1) & mask_) {
+      if (controls_[slot] == kEmpty) {
+        return kNotFound;
+      }
+      if (controls_[slot] == kTag && keys_[slot] == key) {
+        return slot;
+      }
+    }
+  }
+  auto Rehash(std::size_t capacity) -> void {
+    auto controls{std::move(controls_)};
+    auto keys{std::move(keys_)};
+    auto values{std::move(values_)};
+    controls_.assign(capacity, kEmpty);
+    keys_.resize(capacity);
+    values_.clear();
+    values_.resize(capacity);
+    mask_ = capacity - 1;
+    shift_ = std::numeric_limits<std::size_t>::digits;
+    for (auto count = capacity; count > 1; count /= 2) {
+      --shift_;
+    }
+    for (std::size_t i = 0; i < controls.size(); ++i) {
+      if (controls[i] == kEmpty) {
+        continue;
+      }
+      auto slot{GetSlot(std::hash<Point2D>{}(keys[i]))};
+      while (controls_[slot] != kEmpty) {
+        slot = (slot + 1) & mask_;
+      }
+      controls_[slot] = controls[i];
+      keys_[slot] = keys[i];
+      values_[slot] = std::move(values[i]);
+    }
+  }
+
+  std::vector<uint8_t> controls_;  ///< 0 if empty, else tag of the key
+  std::vector<Point2D> keys_;      ///< Key of each slot
+  std::vector<Value> values_;      ///< Value of each slot
+  std::size_t size_{0};            ///< Number of entries
+  std::size_t mask_{0};            ///< Capacity - 1
+  int shift_{std::numeric_limits<std::size_t>::digits};  ///< Hash to slot
+};
+
+/**
+ * @brief Flat open-addressing hash set of Point2D
+ *
+ * A PointHashMap whose mapped values take one byte per slot and are never
+ * read, so the probe behaviour and invalidation rules are the same.
+ */
+class PointHashSet {
+ public:
+  /**
+   * @brief Construct an empty PointHashSet object without allocation
+   */
+  PointHashSet() = default;
+  /**
+   * @brief Construct an empty PointHashSet object
+   * @param count Number of points that fit without growing
+   */
+  explicit PointHashSet(std::size_t count) : map_(count) {}
+
+  /**
+   * @brief Get the number of points
+   * @return std::size_t Number of points
+   */
+  [[nodiscard]] auto Size() const -> std::size_t { return map_.Size(); }
+  /**
+   * @brief Check whether there is no point
+   * @return true If empty
+   * @return false If not empty
+   */
+  [[nodiscard]] auto Empty() const -> bool { return map_.Empty(); }
+  /**
+   * @brief Remove all points, keeping the slots
+   */
+  auto Clear() -> void { map_.Clear(); }
+  /**
+   * @brief Grow the table so that count points fit without growing
+   * @param count Number of points
+   */
+  auto Reserve(std::size_t count) -> void { map_.Reserve(count); }
+
+  /**
+   * @brief Insert a point
+   * @param point Point2D object
+   * @return true If the point was inserted
+   * @return false If the point was already present
+   * @throw std::out_of_range If a coordinate is nan
+   */
+  auto Insert(const Point2D& point) -> bool {
+    return map_.Insert(point, internal::NoValue{}).second;
+  }
+  /**
+   * @brief Check whether a point is present
+   * @param point Point2D object
+   * @return true If present
+   * @return false If absent
+   */
+  [[nodiscard]] auto Contains(const Point2D& point) const -> bool {
+    return map_.Contains(point);
+  }
+  /**
+   * @brief Remove a point
+   * @param point Point2D object
+   * @return true If the point was removed
+   * @return false If the point was absent
+   */
+  auto Erase(const Point2D& point) -> bool { return map_.Erase(point); }
+
+  /**
+   * @brief Call function for every point, in slot order
+   * @tparam Function Callable as function(const Point2D&)
+   * @param function Function object
+   */
+  template <typename Function>
+  auto ForEach(Function&& function) const -> void {
+    map_.ForEach([&](const Point2D& point, const internal::NoValue&) {
+      function(point);
+    });
+  }
+
+ protected:
+ private:
+  PointHashMap<internal::NoValue> map_;  ///< Map with unused values
+};
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_POINT_HASH_MAP_HPP_
@@ -0,0 +1,322 @@
+/**
+ * @file geometry/point_n.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Point class template declaration with fixed N-dimension
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_POINT_N_HPP_
+#define ZOZIBUSH__GEOMETRY_POINT_N_HPP_
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "geometry/point2d.hpp"
+
+namespace zozibush::geometry {
+namespace internal {
+/**
+ * @brief Call function once per axis with the axis as a compile-time constant
+ * @tparam Function Callable taking std::integral_constant<std::size_t, I>
+ * @tparam kAxes Axis indices
+ * @param function Function object
+ */
+template <typename Function, std::size_t... kAxes>
+constexpr auto ForEachAxis(Function&& function,
+                           std::index_sequence<kAxes...> /*axes*/) -> void {
+  (function(std::integral_constant<std::size_t, kAxes>{}), ...);
+}
+}  // namespace internal
+
+/**
+ * @brief Point class with fixed D-dimension
+ *
+ * All per-axis loops are expanded at compile time, so e.g. the distance of a
+ * PointN<3> is three subtractions and multiplications without a loop. The
+ * class is header only for that reason. Operators follow Point2D, including
+ * the nan/inf/zero checks of operator/ and an operator!= that holds only
+ * when every coordinate differs.
+ *
+ * @tparam D Number of dimensions
+ * @tparam T Coordinate value type
+ */
+template <std::size_t D, typename T = double>
+class PointN {
+ public:
+  static_assert(D > 0, "D must not be 0");
+  static_assert(std::is_arithmetic_v<T>, "T must be an arithmetic type");
+
+  /**
+   * @brief Number of dimensions
+   */
+  static constexpr std::size_t kDimension{D};
+  /**
+   * @brief Coordinate value type
+   */
+  using ValueType = T;
+  /**
+   * @brief Type of calculated distances, double for integer coordinates
+   */
+  using DistanceType =
+      std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+  /**
+   * @brief Construct a new PointN object at the origin
+   */
+  constexpr PointN() = default;
+  /**
+   * @brief Construct a new PointN object with one value per axis
+   * @param values Coordinate values, exactly D of them
+   */
+  template <typename... Values,
+            typename = std::enable_if_t<
+                sizeof...(Values) == D &&
+                (std::is_convertible_v<Values, T> && ...)>>
+  constexpr PointN(Values... values)  // NOLINT(google-explicit-constructor)
+      : values_{static_cast<T>(values)...} {}
+  /**
+   * @brief Construct a new PointN object with coordinate array
+   * @param values Coordinate values
+   */
+  constexpr explicit PointN(const std::array<T, D>& values) : values_(values) {}
+  /**
+   * @brief Construct a new PointN object from a Point2 object
+   * @param point Point2 object
+   */
+  template <std::size_t E = D, typename = std::enable_if_t<E == 2>>
+  explicit PointN(const Point2<T>& point)
+      : values_{point.GetX(), point.GetY()} {}
+
+  /**
+   * @brief Convert to Point2 object, only for 2-dimension
+   * @return Point2<T> Point2 object
+   */
+  template <std::size_t E = D, typename = std::enable_if_t<E == 2>>
+  [[nodiscard]] auto ToPoint2() const -> Point2<T> {
+    return Point2<T>(values_[0], values_[1]);
+  }
+
+  /**
+   * @brief Get coordinate value of axis
+   * @param axis Axis index, less than D
+   * @return T Coordinate value
+   */
+  [[nodiscard]] constexpr auto operator[](std::size_t axis) const -> T {
+    return values_[axis];
+  }
+  /**
+   * @brief Get reference of coordinate value of axis
+   * @param axis Axis index, less than D
+   * @return T& Reference of coordinate value
+   */
+  constexpr auto operator[](std::size_t axis) -> T& { return values_[axis]; }
+
+  /**
+   * @brief Get coordinate value of compile-time axis
+   * @tparam kAxis Axis index
+   * @return T Coordinate value
+   */
+  template <std::size_t kAxis>
+  [[nodiscard]] constexpr auto Get() const -> T {
+    static_assert(kAxis < D, "axis out of range");
+    return std::get<kAxis>(values_);
+  }
+  /**
+   * @brief Set coordinate value of compile-time axis
+   * @tparam kAxis Axis index
+   * @param value Coordinate value
+   */
+  template <std::size_t kAxis>
+  constexpr auto Set(T value) -> void {
+    static_assert(kAxis < D, "axis out of range");
+    std::get<kAxis>(values_) = value;
+  }
+
+  /**
+   * @brief Get all coordinate values
+   * @return const std::array<T, D>& Coordinate values
+   */
+  [[nodiscard]] constexpr auto GetValues() const -> const std::array<T, D>& {
+    return values_;
+  }
+
+  /**
+   * @brief Calculate squared distance between lhs point and rhs point
+   * @param lhs left hand side PointN object
+   * @param rhs right hand side PointN object
+   * @return DistanceType Squared Euclidean distance
+   */
+  [[nodiscard]] static constexpr auto CalculateSquaredDistance(
+      const PointN& lhs, const PointN& rhs) -> DistanceType {
+    DistanceType result{0};
+    internal::ForEachAxis(
+        [&](auto axis) {
+          const auto kDelta{
+              static_cast<DistanceType>(std::get<axis>(lhs.values_)) -
+              static_cast<DistanceType>(std::get<axis>(rhs.values_))};
+          result += kDelta * kDelta;
+        },
+        std::make_index_sequence<D>{});
+    return result;
+  }
+  /**
+   * @brief Calculate distance between lhs point and rhs point
+   * @param lhs left hand side PointN object
+   * @param rhs right hand side PointN object
+   * @return DistanceType Euclidean distance
+   */
+  [[nodiscard]] static auto CalculateDistance(const PointN& lhs,
+                                              const PointN& rhs)
+      -> DistanceType {
+    return std::sqrt(CalculateSquaredDistance(lhs, rhs));
+  }
+  /**
+   * @brief Calculate distance between this point and target point
+   * @param target Other PointN object
+   * @return DistanceType Euclidean distance
+   */
+  [[nodiscard]] auto CalculateDistance(const PointN& target) const
+      -> DistanceType {
+    return CalculateDistance(*this, target);
+  }
+
+  /**
+   * @brief Add operator
+   * @param other PointN object
+   * @return PointN Calculated PointN object
+   */
+  constexpr auto operator+(const PointN& other) const -> PointN {
+    PointN result(*this);
+    result += other;
+    return result;
+  }
+  /**
+   * @brief Subtract operator
+   * @param other PointN object
+   * @return PointN Calculated PointN object
+   */
+  constexpr auto operator-(const PointN& other) const -> PointN {
+    PointN result(*this);
+    result -= other;
+    return result;
+  }
+  /**
+   * @brief Add and accumulate operator
+   * @param other PointN object
+   * @return PointN& Reference of this object
+   */
+  constexpr auto operator+=(const PointN& other) -> PointN& {
+    internal::ForEachAxis(
+        [&](auto axis) {
+          std::get<axis>(values_) += std::get<axis>(other.values_);
+        },
+        std::make_index_sequence<D>{});
+    return *this;
+  }
+  /**
+   * @brief Subtract and accumulate operator
+   * @param other PointN object
+   * @return PointN& Reference of this object
+   */
+  constexpr auto operator-=(const PointN& other) -> PointN& {
+    internal::ForEachAxis(
+        [&](auto axis) {
+          std::get<axis>(values_) -= std::get<axis>(other.values_);
+        },
+        std::make_index_sequence<D>{});
+    return *this;
+  }
+  /**
+   * @brief Multiply operator
+   * @param scalar T value
+   * @return PointN Calculated PointN object
+   */
+  constexpr auto operator*(T scalar) const -> PointN {
+    PointN result(*this);
+    internal::ForEachAxis(
+        [&](auto axis) { std::get<axis>(result.values_) *= scalar; },
+        std::make_index_sequence<D>{});
+    return result;
+  }
+  /**
+   * @brief Divide operator
+   * @param scalar T value
+   * @return PointN Calculated PointN object
+   * @throw If scalar==0, nan or inf, don't divide
+   */
+  auto operator/(T scalar) const -> PointN {
+    if constexpr (std::is_floating_point_v<T>) {
+      if (std::isnan(scalar) || std::isinf(scalar)) {
+        throw std::invalid_argument("scalar is nan or inf");
+      }
+    }
+    if (scalar == T{0}) {
+      throw std::invalid_argument("scalar is 0, don't divide 0.");
+    }
+
+    PointN result(*this);
+    internal::ForEachAxis(
+        [&](auto axis) { std::get<axis>(result.values_) /= scalar; },
+        std::make_index_sequence<D>{});
+    return result;
+  }
+
+  /**
+   * @brief Equal operator
+   * @param other PointN object
+   * @return true Every coordinate is the same
+   * @return false Any coordinate differs
+   */
+  constexpr auto operator==(const PointN& other) const -> bool {
+    bool result{true};
+    internal::ForEachAxis(
+        [&](auto axis) {
+          result = result && (std::get<axis>(values_) ==
+                              std::get<axis>(other.values_));
+        },
+        std::make_index_sequence<D>{});
+    return result;
+  }
+  /**
+   * @brief Differ operator, as Point2D's
+   * @param other PointN object
+   * @return true Every coordinate differs
+   * @return false Any coordinate is the same
+   */
+  constexpr auto operator!=(const PointN& other) const -> bool {
+    bool result{true};
+    internal::ForEachAxis(
+        [&](auto axis) {
+          result = result && (std::get<axis>(values_) !=
+                              std::get<axis>(other.values_));
+        },
+        std::make_index_sequence<D>{});
+    return result;
+  }
+
+ protected:
+ private:
+  std::array<T, D> values_{};  ///< Coordinate values
+};
+
+/**
+ * @brief Point with 3 double coordinates
+ */
+using Point3D = PointN<3, double>;
+/**
+ * @brief Point with 3 float coordinates
+ */
+using Point3F = PointN<3, float>;
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_POINT_N_HPP_
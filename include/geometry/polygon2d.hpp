@@ -0,0 +1,167 @@
+/**
+ * @file geometry/polygon2d.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Polygon class declaration with 2-dimension
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_POLYGON_2D_HPP_
+#define ZOZIBUSH__GEOMETRY_POLYGON_2D_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud.hpp"
+
+namespace zozibush::geometry {
+
+/**
+ * @brief Simple polygon with 2-dimension
+ *
+ * The ring is closed implicitly, the last vertex connects to the first.
+ * Containment uses the even-odd (crossing number) rule; points exactly on an
+ * edge may be reported either way. Without an index a containment query walks
+ * every edge; after BuildIndex() only the edges of one horizontal slab are
+ * tested.
+ */
+class Polygon2D {
+ public:
+  /**
+   * @brief Construct a new Polygon2D object with vertices
+   * @param vertices Vertices in ring order, without repeating the first
+   * @throw std::invalid_argument If there are less than 3 vertices
+   */
+  explicit Polygon2D(const std::vector<Point2D>& vertices);
+
+  /**
+   * @brief Get the number of vertices
+   * @return std::size_t Number of vertices
+   */
+  [[nodiscard]] auto GetVertexCount() const -> std::size_t;
+  /**
+   * @brief Get the vertices
+   * @return const std::vector<Point2D>& Vertices in ring order
+   */
+  [[nodiscard]] auto GetVertices() const -> const std::vector<Point2D>&;
+
+  /**
+   * @brief Build the slab index for sub-linear containment queries
+   *
+   * The y range of the polygon is cut into equal slabs and every edge is
+   * listed in each slab it overlaps. The slab count is halved while that
+   * would list more than 64 entries per edge.
+   *
+   * @param slab_count Number of slabs, 0 picks one per vertex
+   * @throw std::length_error If the edges do not fit 32-bit indices
+   */
+  auto BuildIndex(std::size_t slab_count = 0) -> void;
+  /**
+   * @brief Check whether the slab index is built
+   * @return true If BuildIndex() was called
+   * @return false If containment queries walk every edge
+   */
+  [[nodiscard]] auto HasIndex() const -> bool;
+  /**
+   * @brief Get the number of edge entries in the slab index
+   * @return std::size_t Entries over all slabs, 0 without an index
+   */
+  [[nodiscard]] auto GetIndexSize() const -> std::size_t;
+
+  /**
+   * @brief Check whether a point is inside the polygon
+   * @param point Point2D object
+   * @return true If inside
+   * @return false If outside
+   */
+  [[nodiscard]] auto Contains(const Point2D& point) const -> bool;
+  /**
+   * @brief Check containment of many points at once
+   *
+   * Bit i % 64 of mask[i / 64] is set when point i is inside. Without an
+   * index the edges are the outer loop and the points the inner one, which
+   * vectorizes over points.
+   *
+   * @param points Point cloud
+   * @param mask Output buffer, at least GetMaskWordCount(points.Size())
+   * @param thread_count Number of threads, 0 for all hardware threads
+   */
+  auto Contains(const PointCloud<2, double>& points, uint64_t* mask,
+                std::size_t thread_count = 0) const -> void;
+  /**
+   * @brief Check containment of many float points at once
+   *
+   * Same as the double overload; coordinates are widened to double, which
+   * is exact, so results match converting the cloud first.
+   *
+   * @param points Point cloud
+   * @param mask Output buffer, at least GetMaskWordCount(points.Size())
+   * @param thread_count Number of threads, 0 for all hardware threads
+   */
+  auto Contains(const PointCloud<2, float>& points, uint64_t* mask,
+                std::size_t thread_count = 0) const -> void;
+  /**
+   * @brief Get the number of mask words for a number of points
+   * @param point_count Number of points
+   * @return std::size_t Number of uint64_t words
+   */
+  [[nodiscard]] static auto GetMaskWordCount(std::size_t point_count)
+      -> std::size_t;
+
+  /**
+   * @brief Calculate the signed area, positive for counter-clockwise rings
+   * @return double Signed area in squared coordinate unit
+   */
+  [[nodiscard]] auto CalculateSignedArea() const -> double;
+  /**
+   * @brief Calculate the area
+   * @return double Area in squared coordinate unit
+   */
+  [[nodiscard]] auto CalculateArea() const -> double;
+  /**
+   * @brief Calculate the perimeter
+   * @param unit The unit of the coordinates
+   * @return Distance Length of the closed ring
+   */
+  [[nodiscard]] auto CalculatePerimeter(
+      Distance::Type unit = Distance::Type::kMeter) const -> Distance;
+  /**
+   * @brief Calculate the centroid of the enclosed area
+   * @return Point2D Centroid
+   * @throw std::invalid_argument If the area is 0
+   */
+  [[nodiscard]] auto CalculateCentroid() const -> Point2D;
+
+ protected:
+ private:
+  [[nodiscard]] auto ContainsIndexed(double input_x, double input_y) const
+      -> bool;
+  template <typename T>
+  auto ContainsBlock(const T* x_values, const T* y_values, std::size_t count,
+                     uint64_t* mask) const -> void;
+  template <typename T>
+  auto ContainsCloud(const PointCloud<2, T>& points, uint64_t* mask,
+                     std::size_t thread_count) const -> void;
+
+  std::vector<Point2D> vertices_;  ///< Vertices
+  std::vector<double> edge_x_;      ///< Start x of each edge
+  std::vector<double> edge_y_;      ///< Start y of each edge
+  std::vector<double> edge_end_y_;  ///< End y of each edge
+  std::vector<double> edge_slope_;  ///< dx/dy of each edge, 0 if horizontal
+  double min_y_{0.0};               ///< Minimum y of vertices
+  double max_y_{0.0};               ///< Maximum y of vertices
+  double slab_scale_{0.0};          ///< Slabs per unit of y
+  std::vector<uint32_t> slab_offsets_;  ///< Start of each slab in slab_edges_
+  std::vector<uint32_t> slab_edges_;    ///< Edge indices grouped by slab
+};
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_POLYGON_2D_HPP_
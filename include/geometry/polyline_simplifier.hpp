@@ -0,0 +1,186 @@
+/**
+ * @file geometry/polyline_simplifier.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Polyline simplification declaration
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_POLYLINE_SIMPLIFIER_HPP_
+#define ZOZIBUSH__GEOMETRY_POLYLINE_SIMPLIFIER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/point2d.hpp"
+
+namespace zozibush::geometry {
+
+/**
+ * @brief Polyline simplification with reusable scratch memory
+ *
+ * Coordinates are interpreted in the unit given at construction, and the
+ * tolerance is converted into that unit. The first and last points are always
+ * kept. Scratch buffers grow to the longest polyline seen and are reused, so
+ * simplifying many polylines with one object does not allocate after warm-up.
+ */
+class PolylineSimplifier {
+ public:
+  /**
+   * @brief The enum class for simplification method.
+   */
+  enum class Method {
+    kDouglasPeucker = 0,     ///< Keep points farther than tolerance
+    kVisvalingamWhyatt = 1,  ///< Drop points with small effective area
+  };
+
+  /**
+   * @brief Construct a new PolylineSimplifier object
+   * @param tolerance The tolerance
+   * @param unit The unit of the coordinates
+   */
+  explicit PolylineSimplifier(const Distance& tolerance,
+                              Distance::Type unit = Distance::Type::kMeter);
+
+  /**
+   * @brief Simplify with Douglas-Peucker
+   *
+   * Uses an explicit stack instead of recursion. A point is kept when it is
+   * farther than the tolerance from the segment between the kept points
+   * around it.
+   *
+   * @param points Input points
+   * @param count Number of input points
+   * @param output Output buffer, at least count elements, may not alias
+   * points
+   * @return std::size_t Number of output points
+   */
+  auto DouglasPeucker(const Point2D* points, std::size_t count,
+                      Point2D* output) -> std::size_t;
+  /**
+   * @brief Simplify with Visvalingam-Whyatt
+   *
+   * Repeatedly drops the point whose triangle with its neighbours has the
+   * smallest area, using an indexed min-heap, until every remaining triangle
+   * has an area of at least tolerance squared.
+   *
+   * @param points Input points
+   * @param count Number of input points
+   * @param output Output buffer, at least count elements, may not alias
+   * points
+   * @return std::size_t Number of output points
+   */
+  auto VisvalingamWhyatt(const Point2D* points, std::size_t count,
+                         Point2D* output) -> std::size_t;
+  /**
+   * @brief Simplify with a method
+   * @param method The simplification method
+   * @param points Input points
+   * @param count Number of input points
+   * @param output Output buffer, at least count elements
+   * @return std::size_t Number of output points
+   */
+  auto Simplify(Method method, const Point2D* points, std::size_t count,
+                Point2D* output) -> std::size_t;
+
+  /**
+   * @brief Simplify many polylines in parallel
+   *
+   * Polyline i is points[offsets[i], offsets[i + 1]). Its simplified points
+   * are written at the same offset in output, and their number to counts[i].
+   *
+   * @param tolerance The tolerance
+   * @param method The simplification method
+   * @param points Concatenated input points
+   * @param offsets polyline_count + 1 offsets into points
+   * @param polyline_count Number of polylines
+   * @param output Output buffer, at least offsets[polyline_count] elements
+   * @param counts Output buffer, polyline_count elements
+   * @param unit The unit of the coordinates
+   * @param thread_count Number of threads, 0 for all hardware threads
+   */
+  static auto SimplifyBatch(const Distance& tolerance, Method method,
+                            const Point2D* points, const std::size_t* offsets,
+                            std::size_t polyline_count, Point2D* output,
+                            std::size_t* counts,
+                            Distance::Type unit = Distance::Type::kMeter,
+                            std::size_t thread_count = 0) -> void;
+
+ protected:
+ private:
+  auto Load(const Point2D* points, std::size_t count) -> void;
+  auto Store(const Point2D* points, std::size_t count, Point2D* output) const
+      -> std::size_t;
+
+  auto CalculateArea(uint32_t index) const -> double;
+  auto SwapHeap(std::size_t lhs, std::size_t rhs) -> void;
+  auto SiftUp(std::size_t position) -> void;
+  auto SiftDown(std::size_t position) -> void;
+  auto UpdateHeap(uint32_t index, double area) -> void;
+
+  double tolerance_{0.0};  ///< Tolerance in coordinate unit
+
+  std::vector<double> x_values_;  ///< Scratch x coordinates
+  std::vector<double> y_values_;  ///< Scratch y coordinates
+  std::vector<uint8_t> keep_;     ///< Whether each point is kept
+
+  std::vector<uint32_t> stack_;  ///< Douglas-Peucker range stack
+
+  std::vector<uint32_t> previous_;       ///< Previous alive point
+  std::vector<uint32_t> next_;           ///< Next alive point
+  std::vector<double> areas_;            ///< Effective area of each point
+  std::vector<uint32_t> heap_;           ///< Min-heap of point indices
+  std::vector<uint32_t> heap_position_;  ///< Heap position of each point
+};
+
+/**
+ * @brief Douglas-Peucker simplification of an unbounded point feed
+ *
+ * Works on an opening window: the window starts at the last emitted point and
+ * grows while the segment to the newest point stays within tolerance of all
+ * points in between. Otherwise, or when the window reaches its capacity, the
+ * point before the newest one is emitted and starts the next window. Memory
+ * is fixed to the window capacity.
+ */
+class StreamingSimplifier {
+ public:
+  /**
+   * @brief Construct a new StreamingSimplifier object
+   * @param tolerance The tolerance
+   * @param window_capacity Maximum number of buffered points, at least 2
+   * @param unit The unit of the coordinates
+   * @throw std::invalid_argument If window_capacity is less than 2
+   */
+  StreamingSimplifier(const Distance& tolerance, std::size_t window_capacity,
+                      Distance::Type unit = Distance::Type::kMeter);
+
+  /**
+   * @brief Feed a point
+   * @param point Point2D object
+   * @param output Output buffer, at least 1 element
+   * @return std::size_t Number of emitted points, 0 or 1
+   */
+  auto Push(const Point2D& point, Point2D* output) -> std::size_t;
+  /**
+   * @brief End the feed, emitting the last point, and reset
+   * @param output Output buffer, at least 1 element
+   * @return std::size_t Number of emitted points, 0 or 1
+   */
+  auto Finish(Point2D* output) -> std::size_t;
+
+ protected:
+ private:
+  double tolerance_{0.0};               ///< Tolerance in coordinate unit
+  std::size_t window_capacity_{2};      ///< Maximum window size
+  std::vector<Point2D> window_;         ///< Anchor and following points
+};
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_POLYLINE_SIMPLIFIER_HPP_
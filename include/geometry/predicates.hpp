@@ -0,0 +1,300 @@
+/**
+ * @file geometry/predicates.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Robust geometric predicate declaration
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_PREDICATES_HPP_
+#define ZOZIBUSH__GEOMETRY_PREDICATES_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud.hpp"
+
+namespace zozibush::geometry {
+namespace internal {
+/**
+ * @brief Half of the machine epsilon of double, 2^-53
+ */
+constexpr double kHalfEpsilon{1.1102230246251565e-16};
+/**
+ * @brief Relative error bound of the floating point Orient2D
+ */
+constexpr double kOrientErrorBound{(3.0 + 16.0 * kHalfEpsilon) * kHalfEpsilon};
+/**
+ * @brief Relative error bound of the floating point InCircle
+ */
+constexpr double kInCircleErrorBound{(10.0 + 96.0 * kHalfEpsilon) *
+                                     kHalfEpsilon};
+
+/**
+ * @brief Adaptive Orient2D, the stages after the floating point filter
+ *
+ * Tries the exact determinant of the rounded differences, then a first
+ * order correction for their rounding errors, and only then Orient2DExact.
+ *
+ * @param permanent |(ax - cx) * (by - cy)| + |(ay - cy) * (bx - cx)|
+ * @return double Value with the exact sign of the determinant
+ */
+[[nodiscard]] auto Orient2DAdaptive(double ax, double ay, double bx,
+                                    double by, double cx, double cy,
+                                    double permanent) -> double;
+/**
+ * @brief Adaptive InCircle, the stages after the floating point filter
+ *
+ * Staged like Orient2DAdaptive, ending in InCircleExact.
+ *
+ * @param permanent Permanent computed by the InCircle filter
+ * @return double Value with the exact sign of the determinant
+ */
+[[nodiscard]] auto InCircleAdaptive(double ax, double ay, double bx,
+                                    double by, double cx, double cy,
+                                    double dx, double dy, double permanent)
+    -> double;
+/**
+ * @brief Exact Orient2D with floating point expansions
+ * @return double Value with the exact sign of the determinant
+ */
+[[nodiscard]] auto Orient2DExact(double ax, double ay, double bx, double by,
+                                 double cx, double cy) -> double;
+/**
+ * @brief Exact InCircle with floating point expansions
+ * @return double Value with the exact sign of the determinant
+ */
+[[nodiscard]] auto InCircleExact(double ax, double ay, double bx, double by,
+                                 double cx, double cy, double dx, double dy)
+    -> double;
+/**
+ * @brief Exactly compare the crossing point of two segments with a point
+ *
+ * Segments ab and cd must cross properly: a and b strictly on opposite sides
+ * of line cd, and c and d strictly on opposite sides of line ab.
+ *
+ * @return double Negative, zero or positive as the crossing point comes
+ * before, at or after p in lexicographic (x, y) order
+ */
+[[nodiscard]] auto CompareCrossing(double ax, double ay, double bx,
+                                   double by, double cx, double cy, double dx,
+                                   double dy, double px, double py) -> double;
+}  // namespace internal
+
+/**
+ * @brief Orientation of three points
+ *
+ * Evaluates the determinant in floating point and only falls back to
+ * adaptive expansion arithmetic when the result is within the rounding
+ * error bound, so the sign is always exact while the common case costs a few
+ * flops. Near-degenerate inputs mostly stop at the cheap adaptive stages.
+ * Inputs must be finite and not so large or small that products overflow
+ * or underflow.
+ *
+ * @return double Positive if a, b, c are counter-clockwise, negative if
+ * clockwise, 0 if collinear; the magnitude is approximately twice the signed
+ * triangle area
+ */
+[[nodiscard]] inline auto Orient2D(double ax, double ay, double bx, double by,
+                                   double cx, double cy) -> double {
+  const auto kLeft{(ax - cx) * (by - cy)};
+  const auto kRight{(ay - cy) * (bx - cx)};
+  const auto kDeterminant{kLeft - kRight};
+  // Opposite signs or a zero term cannot cancel, the result is exact enough.
+  if ((kLeft > 0.0 && kRight <= 0.0) || (kLeft < 0.0 && kRight >= 0.0) ||
+      kLeft == 0.0) {
+    return kDeterminant;
+  }
+  const auto kPermanent{std::abs(kLeft) + std::abs(kRight)};
+  const auto kBound{internal::kOrientErrorBound * kPermanent};
+  if (kDeterminant >= kBound || -kDeterminant >= kBound) {
+    return kDeterminant;
+  }
+  return internal::Orient2DAdaptive(ax, ay, bx, by, cx, cy, kPermanent);
+}
+/**
+ * @brief Orientation of three points
+ * @param a First point
+ * @param b Second point
+ * @param c Third point
+ * @return double See the coordinate overload
+ */
+[[nodiscard]] inline auto Orient2D(const Point2D& a, const Point2D& b,
+                                   const Point2D& c) -> double {
+  return Orient2D(a.GetX(), a.GetY(), b.GetX(), b.GetY(), c.GetX(), c.GetY());
+}
+
+/**
+ * @brief Position of d against the circle through a, b and c
+ *
+ * Filtered like Orient2D, the sign is exact.
+ *
+ * @return double Positive if d is inside the circle through counter-clockwise
+ * a, b, c, negative if outside, 0 if on the circle; the sign flips when a, b,
+ * c are clockwise
+ */
+[[nodiscard]] inline auto InCircle(double ax, double ay, double bx, double by,
+                                   double cx, double cy, double dx, double dy)
+    -> double {
+  const auto kAdx{ax - dx};
+  const auto kAdy{ay - dy};
+  const auto kBdx{bx - dx};
+  const auto kBdy{by - dy};
+  const auto kCdx{cx - dx};
+  const auto kCdy{cy - dy};
+
+  const auto kBdxCdy{kBdx * kCdy};
+  const auto kCdxBdy{kCdx * kBdy};
+  const auto kALift{kAdx * kAdx + kAdy * kAdy};
+  const auto kCdxAdy{kCdx * kAdy};
+  const auto kAdxCdy{kAdx * kCdy};
+  const auto kBLift{kBdx * kBdx + kBdy * kBdy};
+  const auto kAdxBdy{kAdx * kBdy};
+  const auto kBdxAdy{kBdx * kAdy};
+  const auto kCLift{kCdx * kCdx + kCdy * kCdy};
+
+  const auto kDeterminant{kALift * (kBdxCdy - kCdxBdy) +
+                          kBLift * (kCdxAdy - kAdxCdy) +
+                          kCLift * (kAdxBdy - kBdxAdy)};
+  const auto kPermanent{
+      (std::abs(kBdxCdy) + std::abs(kCdxBdy)) * kALift +
+      (std::abs(kCdxAdy) + std::abs(kAdxCdy)) * kBLift +
+      (std::abs(kAdxBdy) + std::abs(kBdxAdy)) * kCLift};
+  const auto kBound{internal::kInCircleErrorBound * kPermanent};
+  if (kDeterminant > kBound || -kDeterminant > kBound) {
+    return kDeterminant;
+  }
+  return internal::InCircleAdaptive(ax, ay, bx, by, cx, cy, dx, dy,
+                                    kPermanent);
+}
+/**
+ * @brief Position of d against the circle through a, b and c
+ * @param a First point on the circle
+ * @param b Second point on the circle
+ * @param c Third point on the circle
+ * @param d Query point
+ * @return double See the coordinate overload
+ */
+[[nodiscard]] inline auto InCircle(const Point2D& a, const Point2D& b,
+                                   const Point2D& c, const Point2D& d)
+    -> double {
+  return InCircle(a.GetX(), a.GetY(), b.GetX(), b.GetY(), c.GetX(), c.GetY(),
+                  d.GetX(), d.GetY());
+}
+
+/**
+ * @brief Position of a point against a segment
+ */
+enum class SegmentSide : int8_t {
+  kRight,        ///< Strictly right of the directed line ab
+  kLeft,         ///< Strictly left of the directed line ab
+  kBeforeStart,  ///< On the line, before a
+  kAfterEnd,     ///< On the line, after b
+  kOnSegment     ///< On the closed segment ab
+};
+
+/**
+ * @brief Position of p against segment ab
+ *
+ * The side is Orient2D's exact sign. Collinear points are ordered along ab
+ * by coordinate comparisons, which are exact as well. For a degenerate
+ * segment, a equal to b, p is kOnSegment if equal to a and kAfterEnd
+ * otherwise.
+ *
+ * @return SegmentSide Position of p
+ */
+[[nodiscard]] inline auto GetSegmentSide(double ax, double ay, double bx,
+                                         double by, double px, double py)
+    -> SegmentSide {
+  const auto kOrientation{Orient2D(ax, ay, bx, by, px, py)};
+  if (kOrientation > 0.0) {
+    return SegmentSide::kLeft;
+  }
+  if (kOrientation < 0.0) {
+    return SegmentSide::kRight;
+  }
+  // Collinear, so one coordinate orders the points unless ab is vertical.
+  const auto kUseX{ax != bx};
+  const auto kA{kUseX ? ax : ay};
+  const auto kB{kUseX ? bx : by};
+  const auto kP{kUseX ? px : py};
+  if (kA == kB) {
+    return (px == ax && py == ay) ? SegmentSide::kOnSegment
+                                  : SegmentSide::kAfterEnd;
+  }
+  const auto kForward{kA < kB};
+  if (kForward ? kP < kA : kP > kA) {
+    return SegmentSide::kBeforeStart;
+  }
+  if (kForward ? kP > kB : kP < kB) {
+    return SegmentSide::kAfterEnd;
+  }
+  return SegmentSide::kOnSegment;
+}
+/**
+ * @brief Position of p against segment ab
+ * @param a Segment start
+ * @param b Segment end
+ * @param p Query point
+ * @return SegmentSide See the coordinate overload
+ */
+[[nodiscard]] inline auto GetSegmentSide(const Point2D& a, const Point2D& b,
+                                         const Point2D& p) -> SegmentSide {
+  return GetSegmentSide(a.GetX(), a.GetY(), b.GetX(), b.GetY(), p.GetX(),
+                        p.GetY());
+}
+
+/**
+ * @brief Orientation of a, b and every point of a cloud
+ *
+ * Filters a block of points in a branch-free loop, then runs the adaptive
+ * stages for the few left undecided, over threads in ranges.
+ *
+ * @param a First point
+ * @param b Second point
+ * @param points Third points
+ * @param signs Output of points.Size() values, -1, 0 or 1 as the sign of
+ * Orient2D(a, b, point)
+ * @param thread_count Number of threads, 0 for all hardware threads
+ */
+auto Orient2D(const Point2D& a, const Point2D& b,
+              const PointCloud<2, double>& points, int8_t* signs,
+              std::size_t thread_count = 0) -> void;
+/**
+ * @brief Position of every point of a cloud against the circle through a, b
+ * and c
+ *
+ * Batched like the Orient2D overload for point clouds.
+ *
+ * @param a First point on the circle
+ * @param b Second point on the circle
+ * @param c Third point on the circle
+ * @param points Query points
+ * @param signs Output of points.Size() values, -1, 0 or 1 as the sign of
+ * InCircle(a, b, c, point)
+ * @param thread_count Number of threads, 0 for all hardware threads
+ */
+auto InCircle(const Point2D& a, const Point2D& b, const Point2D& c,
+              const PointCloud<2, double>& points, int8_t* signs,
+              std::size_t thread_count = 0) -> void;
+/**
+ * @brief Position of every point of a cloud against segment ab
+ * @param a Segment start
+ * @param b Segment end
+ * @param points Query points
+ * @param sides Output of points.Size() values
+ * @param thread_count Number of threads, 0 for all hardware threads
+ */
+auto GetSegmentSide(const Point2D& a, const Point2D& b,
+                    const PointCloud<2, double>& points, SegmentSide* sides,
+                    std::size_t thread_count = 0) -> void;
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_PREDICATES_HPP_
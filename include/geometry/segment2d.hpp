@@ -0,0 +1,118 @@
+/**
+ * @file geometry/segment2d.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Line segment class declaration with 2-dimension
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_SEGMENT_2D_HPP_
+#define ZOZIBUSH__GEOMETRY_SEGMENT_2D_HPP_
+
+#include "geometry/point2d.hpp"
+
+namespace zozibush::geometry {
+namespace internal {
+/**
+ * @brief Intersect closed segments ab and cd
+ *
+ * Whether they intersect is decided exactly with Orient2D. The reported
+ * point is exact when it is an endpoint of either segment, which includes
+ * every touching and overlapping case; an overlap reports its
+ * lexicographically smallest point. A proper crossing is computed in double
+ * precision and clamped to both bounding boxes.
+ *
+ * @param ax x of a
+ * @param ay y of a
+ * @param bx x of b
+ * @param by y of b
+ * @param cx x of c
+ * @param cy y of c
+ * @param dx x of d
+ * @param dy y of d
+ * @param point_x Set to x of an intersection point if any
+ * @param point_y Set to y of an intersection point if any
+ * @return true If the segments share at least one point
+ * @return false If they are disjoint
+ */
+auto IntersectSegments(double ax, double ay, double bx, double by, double cx,
+                       double cy, double dx, double dy, double& point_x,
+                       double& point_y) -> bool;
+}  // namespace internal
+
+/**
+ * @brief Closed line segment between two Point2D objects
+ */
+class Segment2D {
+ public:
+  /**
+   * @brief Construct a new Segment2D object at the origin
+   */
+  Segment2D() = default;
+  /**
+   * @brief Construct a new Segment2D object
+   * @param start Start point
+   * @param end End point, may equal start
+   */
+  Segment2D(const Point2D& start, const Point2D& end);
+
+  /**
+   * @brief Get the start point
+   * @return const Point2D& Start point
+   */
+  [[nodiscard]] auto GetStart() const -> const Point2D&;
+  /**
+   * @brief Get the end point
+   * @return const Point2D& End point
+   */
+  [[nodiscard]] auto GetEnd() const -> const Point2D&;
+  /**
+   * @brief Calculate the length
+   * @return double Euclidean length
+   */
+  [[nodiscard]] auto CalculateLength() const -> double;
+
+  /**
+   * @brief Check whether this segment shares a point with other segment
+   * @param other Segment2D object
+   * @return true If they touch, cross or overlap
+   * @return false If they are disjoint
+   */
+  [[nodiscard]] auto Intersects(const Segment2D& other) const -> bool;
+  /**
+   * @brief Find a point shared with other segment
+   * @param other Segment2D object
+   * @param point Set to the shared point, see internal::IntersectSegments
+   * @return true If they touch, cross or overlap
+   * @return false If they are disjoint, point is left unchanged
+   */
+  auto Intersect(const Segment2D& other, Point2D& point) const -> bool;
+
+  /**
+   * @brief Equal operator
+   * @param other Segment2D object
+   * @return true Same start and end
+   * @return false Otherwise, a reversed segment is not equal
+   */
+  auto operator==(const Segment2D& other) const -> bool;
+  /**
+   * @brief Differ operator
+   * @param other Segment2D object
+   * @return true Start or end differs
+   * @return false Same start and end
+   */
+  auto operator!=(const Segment2D& other) const -> bool;
+
+ protected:
+ private:
+  Point2D start_;  ///< Start point
+  Point2D end_;    ///< End point
+};
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_SEGMENT_2D_HPP_
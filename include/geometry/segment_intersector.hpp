@@ -0,0 +1,108 @@
+/**
+ * @file geometry/segment_intersector.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Sweep line segment intersection declaration
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_SEGMENT_INTERSECTOR_HPP_
+#define ZOZIBUSH__GEOMETRY_SEGMENT_INTERSECTOR_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/point2d.hpp"
+#include "geometry/segment2d.hpp"
+
+namespace zozibush::geometry {
+
+/**
+ * @brief Finds all intersecting pairs of a set of segments
+ *
+ * A Bentley-Ottmann sweep in O((n + k) log n) for n segments and k
+ * intersecting pairs. Segments are closed, so touching, crossing and
+ * overlapping pairs are all reported, once each, with a point of
+ * internal::IntersectSegments. The sweep status is ordered with exact
+ * orientation tests and crossings swap neighbours in place, so collinear,
+ * vertical, duplicate and zero-length segments are handled. Crossing points
+ * are rounded, but whether a crossing comes before an endpoint event is
+ * decided on interval bounds and, when those are inconclusive, exactly.
+ *
+ * Results go to caller-owned buffers: pair i is segment indices
+ * pairs[2i] < pairs[2i+1] and optionally points[i]. The total count is
+ * returned even when it exceeds the capacity, so a caller can retry with
+ * larger buffers.
+ */
+class SegmentIntersector {
+ public:
+  /**
+   * @brief Construct a new SegmentIntersector object
+   * @param segments Segments, copied
+   * @throw std::out_of_range If a coordinate is nan or inf
+   * @throw std::length_error If there are 2^31 segments or more
+   */
+  explicit SegmentIntersector(const std::vector<Segment2D>& segments);
+
+  /**
+   * @brief Get the number of segments
+   * @return std::size_t Number of segments
+   */
+  [[nodiscard]] auto GetSegmentCount() const -> std::size_t;
+
+  /**
+   * @brief Check whether any two segments intersect
+   *
+   * Stops the sweep at the first intersection found.
+   *
+   * @return true If some pair intersects
+   * @return false If all segments are disjoint
+   */
+  [[nodiscard]] auto HasIntersection() const -> bool;
+  /**
+   * @brief Find all intersecting pairs in one sweep
+   * @param pairs 2 * capacity segment indices, filled in sweep order
+   * @param points capacity points or nullptr if not needed
+   * @param capacity Number of pairs the buffers hold
+   * @return std::size_t Number of intersecting pairs
+   */
+  auto FindIntersections(uint32_t* pairs, Point2D* points,
+                         std::size_t capacity) const -> std::size_t;
+  /**
+   * @brief Find all intersecting pairs with one sweep per grid cell
+   *
+   * The bounding box is split into cells of about a thousand segments and
+   * each segment is swept in every cell its bounding box overlaps. A pair is
+   * reported only by the cell holding the lower-left corner of the overlap
+   * of the two bounding boxes, which both segments reach, so every pair is
+   * found exactly once. Small inputs fall back to the single sweep.
+   *
+   * @param pairs 2 * capacity segment indices, grouped by cell
+   * @param points capacity points or nullptr if not needed
+   * @param capacity Number of pairs the buffers hold
+   * @param thread_count Number of threads, 0 for all hardware threads
+   * @return std::size_t Number of intersecting pairs
+   */
+  auto FindIntersectionsParallel(uint32_t* pairs, Point2D* points,
+                                 std::size_t capacity,
+                                 std::size_t thread_count = 0) const
+      -> std::size_t;
+
+ protected:
+ private:
+  // Endpoints are stored lexicographically ordered, start before end.
+  std::vector<double> start_x_;  ///< x of the smaller endpoint
+  std::vector<double> start_y_;  ///< y of the smaller endpoint
+  std::vector<double> end_x_;    ///< x of the larger endpoint
+  std::vector<double> end_y_;    ///< y of the larger endpoint
+  std::vector<uint32_t> events_;  ///< 2 * segment + is-end, in sweep order
+};
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_SEGMENT_INTERSECTOR_HPP_
@@ -0,0 +1,231 @@
+/**
+ * @file geometry/transform2d.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Affine transform declaration for 2-dimension points
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_TRANSFORM_2D_HPP_
+#define ZOZIBUSH__GEOMETRY_TRANSFORM_2D_HPP_
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud.hpp"
+
+namespace zozibush::geometry {
+
+/**
+ * @brief Affine transform of the plane, a 3x3 matrix with last row 0 0 1
+ *
+ * A point maps to x' = m00 x + m01 y + m02, y' = m10 x + m11 y + m12.
+ * Composition and inversion are constexpr. The batch Apply() functions run
+ * over threads in blocks. They pick a loop for the kind of transform:
+ * translation only, axis-aligned (scale and translation), or general.
+ * Every loop gives the results of Apply(const Point2D&) for finite
+ * coordinates.
+ */
+class Transform2D {
+ public:
+  /**
+   * @brief Construct a new Transform2D object, the identity
+   */
+  constexpr Transform2D() = default;
+  /**
+   * @brief Construct a new Transform2D object from the first two rows
+   * @param m00 x scale
+   * @param m01 x shear
+   * @param m02 x translation
+   * @param m10 y shear
+   * @param m11 y scale
+   * @param m12 y translation
+   */
+  constexpr Transform2D(double m00, double m01, double m02, double m10,
+                        double m11, double m12)
+      : matrix_{m00, m01, m02, m10, m11, m12} {}
+
+  /**
+   * @brief Make a translation
+   * @param offset_x x offset
+   * @param offset_y y offset
+   * @return Transform2D Translation
+   */
+  [[nodiscard]] static constexpr auto Translation(double offset_x,
+                                                  double offset_y)
+      -> Transform2D {
+    return {1.0, 0.0, offset_x, 0.0, 1.0, offset_y};
+  }
+  /**
+   * @brief Make a scale about the origin
+   * @param scale_x x factor
+   * @param scale_y y factor
+   * @return Transform2D Scale
+   */
+  [[nodiscard]] static constexpr auto Scale(double scale_x, double scale_y)
+      -> Transform2D {
+    return {scale_x, 0.0, 0.0, 0.0, scale_y, 0.0};
+  }
+  /**
+   * @brief Make a counter-clockwise rotation about the origin
+   *
+   * Not constexpr, std::cos and std::sin are not.
+   *
+   * @param radians Angle in radians
+   * @return Transform2D Rotation
+   */
+  [[nodiscard]] static auto Rotation(double radians) -> Transform2D;
+
+  /**
+   * @brief Get a matrix element
+   * @param row Row, 0 to 2
+   * @param column Column, 0 to 2
+   * @return double Element; the last row is 0 0 1
+   */
+  [[nodiscard]] constexpr auto Get(std::size_t row, std::size_t column) const
+      -> double {
+    if (row == 2) {
+      return (column == 2) ? 1.0 : 0.0;
+    }
+    return matrix_[row * 3 + column];
+  }
+
+  /**
+   * @brief Compose, rhs first and then this
+   * @param rhs Transform applied first
+   * @return Transform2D Matrix product this * rhs
+   */
+  [[nodiscard]] constexpr auto operator*(const Transform2D& rhs) const
+      -> Transform2D {
+    const auto& kL{matrix_};
+    const auto& kR{rhs.matrix_};
+    return {kL[0] * kR[0] + kL[1] * kR[3],
+            kL[0] * kR[1] + kL[1] * kR[4],
+            kL[0] * kR[2] + kL[1] * kR[5] + kL[2],
+            kL[3] * kR[0] + kL[4] * kR[3],
+            kL[3] * kR[1] + kL[4] * kR[4],
+            kL[3] * kR[2] + kL[4] * kR[5] + kL[5]};
+  }
+  /**
+   * @brief Compose in application order, this first and then next
+   * @param next Transform applied second
+   * @return Transform2D Matrix product next * this
+   */
+  [[nodiscard]] constexpr auto Then(const Transform2D& next) const
+      -> Transform2D {
+    return next * *this;
+  }
+  /**
+   * @brief Invert the transform
+   * @return Transform2D Inverse
+   * @throw std::invalid_argument If the determinant is 0, nan or inf
+   */
+  [[nodiscard]] constexpr auto Invert() const -> Transform2D {
+    const auto& kM{matrix_};
+    const auto kDeterminant{kM[0] * kM[4] - kM[1] * kM[3]};
+    // x - x is 0 only for finite x; std::isfinite is not constexpr.
+    if (kDeterminant == 0.0 || !(kDeterminant - kDeterminant == 0.0)) {
+      throw std::invalid_argument("transform is not invertible");
+    }
+    const auto kA{kM[4] / kDeterminant};
+    const auto kB{-kM[1] / kDeterminant};
+    const auto kD{-kM[3] / kDeterminant};
+    const auto kE{kM[0] / kDeterminant};
+    return {kA, kB, -(kA * kM[2] + kB * kM[5]),
+            kD, kE, -(kD * kM[2] + kE * kM[5])};
+  }
+
+  /**
+   * @brief Check whether the transform only translates
+   * @return true If the linear part is the identity
+   * @return false Otherwise
+   */
+  [[nodiscard]] constexpr auto IsTranslation() const -> bool {
+    return matrix_[0] == 1.0 && matrix_[1] == 0.0 && matrix_[3] == 0.0 &&
+           matrix_[4] == 1.0;
+  }
+  /**
+   * @brief Check whether the transform keeps axes parallel, i.e. is a scale
+   * followed by a translation
+   * @return true If both shear elements are 0
+   * @return false Otherwise
+   */
+  [[nodiscard]] constexpr auto IsAxisAligned() const -> bool {
+    return matrix_[1] == 0.0 && matrix_[3] == 0.0;
+  }
+
+  /**
+   * @brief Equal operator, element by element
+   * @param other Transform2D object
+   * @return true If all elements are equal
+   * @return false Otherwise
+   */
+  [[nodiscard]] constexpr auto operator==(const Transform2D& other) const
+      -> bool {
+    for (std::size_t i = 0; i < matrix_.size(); ++i) {
+      if (!(matrix_[i] == other.matrix_[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Apply to a point
+   * @param point Point2D object
+   * @return Point2D Transformed point
+   */
+  [[nodiscard]] auto Apply(const Point2D& point) const -> Point2D {
+    const auto kX{point.GetX()};
+    const auto kY{point.GetY()};
+    return {matrix_[0] * kX + matrix_[1] * kY + matrix_[2],
+            matrix_[3] * kX + matrix_[4] * kY + matrix_[5]};
+  }
+  /**
+   * @brief Apply to a point array
+   * @param input Input points
+   * @param count Number of points
+   * @param output Output buffer of count points, may be input
+   * @param thread_count Number of threads, 0 for all hardware threads
+   */
+  auto Apply(const Point2D* input, std::size_t count, Point2D* output,
+             std::size_t thread_count = 0) const -> void;
+  /**
+   * @brief Apply to a point cloud
+   * @param input Input cloud
+   * @param output Resized to input.Size(), may be input
+   * @param thread_count Number of threads, 0 for all hardware threads
+   */
+  auto Apply(const PointCloud<2, double>& input, PointCloud<2, double>& output,
+             std::size_t thread_count = 0) const -> void;
+  /**
+   * @brief Apply to a point array in place
+   * @param points Points, overwritten
+   * @param count Number of points
+   * @param thread_count Number of threads, 0 for all hardware threads
+   */
+  auto ApplyInPlace(Point2D* points, std::size_t count,
+                    std::size_t thread_count = 0) const -> void;
+  /**
+   * @brief Apply to a point cloud in place
+   * @param points Point cloud, overwritten
+   * @param thread_count Number of threads, 0 for all hardware threads
+   */
+  auto ApplyInPlace(PointCloud<2, double>& points,
+                    std::size_t thread_count = 0) const -> void;
+
+ protected:
+ private:
+  std::array<double, 6> matrix_{1.0, 0.0, 0.0,
+                                0.0, 1.0, 0.0};  ///< First two rows
+};
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_TRANSFORM_2D_HPP_
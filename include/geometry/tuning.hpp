@@ -0,0 +1,126 @@
+/**
+ * @file geometry/tuning.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Host-dependent parameters of the batch kernels
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_TUNING_HPP_
+#define ZOZIBUSH__GEOMETRY_TUNING_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace zozibush::geometry {
+
+/**
+ * @brief Parameters of the batch kernels, picked per host
+ *
+ * A grain is the smallest range ParallelFor hands to one thread. When a
+ * grain is too small, starting threads costs more than the work they take.
+ * When it is too large, mid-sized inputs leave cores idle. Calibration
+ * measures the cost of starting a thread and the per-item cost of each
+ * kernel. It then picks the smallest power of two whose work is a few
+ * thread starts. Grains never change results.
+ */
+struct TuningParameters {
+  /**
+   * @brief The enum class for where the parameters come from.
+   */
+  enum class Source {
+    kDefault,      ///< Built-in values, before or without calibration
+    kCache,        ///< Read from the cache file
+    kCalibration,  ///< Measured in this process
+    kUser,         ///< Set with SetTuningParameters()
+  };
+
+  std::size_t query_grain{1024};       ///< Radius queries per range (Dbscan)
+  std::size_t cell_grain{4096};        ///< Points per range of GridIndex cells
+  std::size_t contains_grain{1024};    ///< Points per Polygon2D::Contains range
+  std::size_t selection_grain{65536};  ///< Points per range of SelectNearest
+  std::size_t predicate_grain{4096};   ///< Points per range of batch predicates
+  std::size_t transform_grain{65536};  ///< Points per Transform2D::Apply range
+  uint64_t thread_start_ns{0};  ///< Starting and joining a thread, 0 unknown
+  Source source{Source::kDefault};  ///< Origin of the values
+};
+
+/**
+ * @brief Get the current parameters
+ *
+ * The first call reads the cache file, or calibrates and writes it when
+ * the file has no entry for this host. Calibration takes a few tens of
+ * milliseconds; callers racing with it get the defaults meanwhile.
+ *
+ * @return TuningParameters Current parameters
+ */
+[[nodiscard]] auto GetTuningParameters() -> TuningParameters;
+/**
+ * @brief Calibrate now, make the result current and write the cache file
+ * @return TuningParameters Calibrated parameters
+ */
+auto CalibrateTuningParameters() -> TuningParameters;
+/**
+ * @brief Replace the current parameters, without writing the cache file
+ * @param parameters New parameters; source is set to kUser
+ * @throw std::invalid_argument If a grain is 0 or contains_grain is not a
+ * multiple of 64
+ */
+auto SetTuningParameters(const TuningParameters& parameters) -> void;
+
+/**
+ * @brief Get the CPU model name of this host
+ * @return std::string Model name from /proc/cpuinfo, or "unknown"
+ */
+[[nodiscard]] auto GetCpuModel() -> std::string;
+/**
+ * @brief Get the path of the cache file
+ *
+ * GEOMETRY_TUNING_CACHE wins if set; an empty value disables the cache.
+ * Otherwise the file is zozibush_geometry/tuning.txt below XDG_CACHE_HOME
+ * or HOME/.cache.
+ *
+ * @return std::string Cache file path, empty if there is none
+ */
+[[nodiscard]] auto GetTuningCachePath() -> std::string;
+
+namespace internal {
+/**
+ * @brief Get the cache key of this host, the CPU model and thread count
+ * @return std::string Cache key without tabs or newlines
+ */
+[[nodiscard]] auto GetTuningKey() -> std::string;
+/**
+ * @brief Read the entry of a key from a cache file
+ * @param path Cache file path
+ * @param key Cache key
+ * @return std::optional<TuningParameters> Parameters with source kCache, or
+ * nothing if the file or a valid entry is missing
+ */
+[[nodiscard]] auto ReadTuningCache(const std::string& path,
+                                   const std::string& key)
+    -> std::optional<TuningParameters>;
+/**
+ * @brief Write the entry of a key to a cache file, keeping other keys
+ *
+ * The file is replaced through a rename, so readers never see half of it.
+ *
+ * @param path Cache file path; missing directories are created
+ * @param key Cache key
+ * @param parameters Parameters to store
+ * @return true If the file was written
+ * @return false If writing failed
+ */
+auto WriteTuningCache(const std::string& path, const std::string& key,
+                      const TuningParameters& parameters) -> bool;
+}  // namespace internal
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_TUNING_HPP_
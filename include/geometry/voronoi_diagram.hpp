@@ -0,0 +1,84 @@
+/**
+ * @file geometry/voronoi_diagram.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Voronoi diagram declaration
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_VORONOI_DIAGRAM_HPP_
+#define ZOZIBUSH__GEOMETRY_VORONOI_DIAGRAM_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/delaunay.hpp"
+#include "geometry/point2d.hpp"
+
+namespace zozibush::geometry {
+
+/**
+ * @brief Voronoi diagram as the dual of a Delaunay triangulation
+ *
+ * Voronoi vertex t is the circumcenter of triangle t. The cell of a point is
+ * the circumcenters of the triangles around it, collected by walking the
+ * half-edges once per point and stored as compressed index arrays. Cells of
+ * hull points are unbounded; their vertices form an open chain and clipping
+ * to a region is left to the caller.
+ */
+class VoronoiDiagram {
+ public:
+  /**
+   * @brief Construct a new VoronoiDiagram object
+   * @param delaunay Delaunay triangulation, only read during construction
+   */
+  explicit VoronoiDiagram(const Delaunay& delaunay);
+
+  /**
+   * @brief Get the number of cells, one per input point
+   * @return std::size_t Number of cells
+   */
+  [[nodiscard]] auto GetCellCount() const -> std::size_t;
+  /**
+   * @brief Get the Voronoi vertices
+   * @return const std::vector<Point2D>& Circumcenter of each triangle
+   */
+  [[nodiscard]] auto GetVertices() const -> const std::vector<Point2D>&;
+  /**
+   * @brief Check whether the cell of a point is bounded
+   * @param point Point index
+   * @return true If the point is not on the hull
+   * @return false If the cell is unbounded or empty
+   * @throw std::out_of_range If point is not less than GetCellCount()
+   */
+  [[nodiscard]] auto IsBounded(uint32_t point) const -> bool;
+  /**
+   * @brief Get the vertices of the cell of a point
+   *
+   * Duplicate points that were left out of the triangulation have an empty
+   * cell.
+   *
+   * @param point Point index
+   * @param vertices Cleared, then filled with cell vertices counter-clockwise
+   * @return std::size_t Number of vertices
+   * @throw std::out_of_range If point is not less than GetCellCount()
+   */
+  auto GetCell(uint32_t point, std::vector<Point2D>& vertices) const
+      -> std::size_t;
+
+ protected:
+ private:
+  std::vector<Point2D> vertices_;        ///< Circumcenters
+  std::vector<uint32_t> cell_offsets_;   ///< Start of each cell
+  std::vector<uint32_t> cell_vertices_;  ///< Vertex indices of all cells
+  std::vector<uint8_t> bounded_;         ///< Whether each cell is bounded
+};
+
+}  // namespace zozibush::geometry
+
+#endif  // ZOZIBUSH__GEOMETRY_VORONOI_DIAGRAM_HPP_
@@ -0,0 +1,123 @@
+/**
+ * @file geometry/query_client.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Local query client declaration
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_QUERY_CLIENT_HPP_
+#define ZOZIBUSH__GEOMETRY_QUERY_CLIENT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "geometry/point2d.hpp"
+#include "geometry/query_protocol.hpp"
+
+namespace zozibush::geometry::query {
+
+/**
+ * @brief Blocking client of a QueryServer
+ *
+ * Every call sends one request and waits for its response. Use one client
+ * per thread; the server batches the requests of all clients.
+ */
+class QueryClient {
+ public:
+  /**
+   * @brief Construct a new QueryClient object connected to a server
+   * @param socket_path Path of the server socket
+   * @throw std::invalid_argument If socket_path is empty or too long
+   * @throw std::runtime_error If the connection fails
+   */
+  explicit QueryClient(const std::string& socket_path);
+  /**
+   * @brief Copy constructor, deleted
+   */
+  QueryClient(const QueryClient&) = delete;
+  /**
+   * @brief Copy assignment operator, deleted
+   * @return QueryClient& Reference of QueryClient object
+   */
+  auto operator=(const QueryClient&) -> QueryClient& = delete;
+  /**
+   * @brief Close the connection
+   */
+  ~QueryClient();
+
+  /**
+   * @brief Find the nearest set point of each query point
+   * @param set Point set id
+   * @param queries Query points
+   * @param count Number of query points
+   * @param indices Output buffer of count set point indices
+   * @param distances Output buffer of count distances
+   * @throw std::runtime_error If the server reports an error or the
+   * connection fails
+   */
+  auto Nearest(uint32_t set, const Point2D* queries, std::size_t count,
+               uint32_t* indices, double* distances) -> void;
+  /**
+   * @brief Find the set points within radius of each query point
+   * @param set Point set id
+   * @param radius Inclusive radius
+   * @param queries Query points
+   * @param count Number of query points
+   * @param counts Filled with the number of points found per query
+   * @param indices Filled with the indices found, query after query, each
+   * run ascending
+   * @throw std::runtime_error If the server reports an error or the
+   * connection fails
+   */
+  auto Radius(uint32_t set, double radius, const Point2D* queries,
+              std::size_t count, std::vector<uint32_t>& counts,
+              std::vector<uint32_t>& indices) -> void;
+  /**
+   * @brief Calculate the distance from each query point to a set point
+   * @param set Point set id
+   * @param queries Query points
+   * @param indices Set point index of each query point
+   * @param count Number of query points
+   * @param distances Output buffer of count distances
+   * @throw std::runtime_error If the server reports an error or the
+   * connection fails
+   */
+  auto Distance(uint32_t set, const Point2D* queries, const uint32_t* indices,
+                std::size_t count, double* distances) -> void;
+  /**
+   * @brief Add a point set to the server
+   * @param points Points of the set
+   * @param count Number of points
+   * @return uint32_t Set id
+   * @throw std::runtime_error If the server rejects the set or the
+   * connection fails
+   */
+  auto Load(const Point2D* points, std::size_t count) -> uint32_t;
+  /**
+   * @brief Get the server statistics
+   * @return Statistics Counters and latency percentiles
+   * @throw std::runtime_error If the connection fails
+   */
+  auto GetStatistics() -> Statistics;
+
+ protected:
+ private:
+  auto Call(MessageType type, uint32_t set, uint32_t count,
+            const std::vector<char>& payload) -> MessageHeader;
+
+  int socket_{-1};            ///< Connected socket
+  uint32_t next_id_{0};       ///< Id of the next request
+  std::vector<char> request_;   ///< Request payload buffer
+  std::vector<char> response_;  ///< Response payload buffer
+};
+
+}  // namespace zozibush::geometry::query
+
+#endif  // ZOZIBUSH__GEOMETRY_QUERY_CLIENT_HPP_
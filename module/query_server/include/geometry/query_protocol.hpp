@@ -0,0 +1,135 @@
+/**
+ * @file geometry/query_protocol.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Binary protocol of the local query server
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_QUERY_PROTOCOL_HPP_
+#define ZOZIBUSH__GEOMETRY_QUERY_PROTOCOL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace zozibush::geometry::query {
+
+/**
+ * @brief The enum class for message type.
+ *
+ * Every message is a MessageHeader followed by header.size payload bytes.
+ * Client and server share a host, so values are in native byte order. With
+ * count queries and points stored as x, y doubles, the payloads are:
+ *
+ * | Type        | Request                         | Response               |
+ * |-------------|---------------------------------|------------------------|
+ * | kNearest    | count points                    | count uint32 indices,  |
+ * |             |                                 | count double distances |
+ * | kRadius     | double radius, count points     | count uint32 counts,   |
+ * |             |                                 | then all uint32        |
+ * |             |                                 | indices, ascending     |
+ * |             |                                 | per query              |
+ * | kDistance   | count points, count uint32      | count double distances |
+ * |             | indices into the set            |                        |
+ * | kLoad       | count points                    | empty, set id in the   |
+ * |             |                                 | header                 |
+ * | kStatistics | empty                           | Statistics             |
+ *
+ * A response echoes the id and type of its request. If status is not kOk,
+ * the payload is an error message instead.
+ */
+enum class MessageType : uint16_t {
+  kNearest = 1,     ///< Nearest point of each query point
+  kRadius = 2,      ///< Points within a radius of each query point
+  kDistance = 3,    ///< Distance from each query point to a set point
+  kLoad = 4,        ///< Add a point set and index it
+  kStatistics = 5,  ///< Server statistics
+};
+
+/**
+ * @brief The enum class for response status.
+ */
+enum class Status : uint16_t {
+  kOk = 0,               ///< Success
+  kBadRequest = 1,       ///< Unknown type or inconsistent sizes
+  kUnknownSet = 2,       ///< No point set with the id
+  kIndexOutOfRange = 3,  ///< A point index is not in the set
+  kServerError = 4,      ///< Request failed inside the server
+};
+
+/**
+ * @brief Fixed-size header of every message
+ */
+struct MessageHeader {
+  uint32_t size{0};      ///< Payload bytes following the header
+  uint32_t id{0};        ///< Request id, echoed in the response
+  uint16_t type{0};      ///< MessageType
+  uint16_t status{0};    ///< Status, kOk in requests
+  uint32_t set{0};       ///< Point set id
+  uint32_t count{0};     ///< Number of query points
+  uint32_t reserved{0};  ///< Zero
+};
+
+/**
+ * @brief Server statistics, the kStatistics response payload
+ *
+ * Latencies run from the arrival of a complete request until its response
+ * is ready to be written, over the most recent requests.
+ */
+struct Statistics {
+  uint64_t request_count{0};    ///< Requests answered
+  uint64_t query_count{0};      ///< Query points answered
+  uint64_t batch_count{0};      ///< Batches run by the dispatcher
+  uint64_t queue_depth{0};      ///< Requests waiting now
+  uint64_t max_queue_depth{0};  ///< Most requests ever waiting
+  uint64_t p50_latency_ns{0};   ///< Median latency
+  uint64_t p99_latency_ns{0};   ///< 99th percentile latency
+};
+
+/**
+ * @brief Largest accepted payload
+ */
+constexpr uint32_t kMaxPayloadSize{uint32_t{1} << 28U};
+
+namespace internal {
+/**
+ * @brief Read exactly size bytes, retrying on EINTR
+ * @param socket Socket descriptor
+ * @param data Output buffer
+ * @param size Number of bytes
+ * @return true If all bytes were read
+ * @return false If the peer closed the socket or reading failed
+ */
+auto ReadFull(int socket, void* data, std::size_t size) -> bool;
+/**
+ * @brief Write exactly size bytes, retrying on EINTR, without SIGPIPE
+ * @param socket Socket descriptor
+ * @param data Input buffer
+ * @param size Number of bytes
+ * @return true If all bytes were written
+ * @return false If writing failed
+ */
+auto WriteFull(int socket, const void* data, std::size_t size) -> bool;
+/**
+ * @brief Check that a path fits a Unix domain socket address
+ * @param path Socket path
+ * @throw std::invalid_argument If path is empty or too long
+ */
+auto CheckSocketPath(const std::string& path) -> void;
+/**
+ * @brief Get the request payload size implied by a header
+ * @param header Request header
+ * @return std::size_t Expected payload size, or SIZE_MAX for an unknown type
+ */
+[[nodiscard]] auto GetRequestSize(const MessageHeader& header)
+    -> std::size_t;
+}  // namespace internal
+
+}  // namespace zozibush::geometry::query
+
+#endif  // ZOZIBUSH__GEOMETRY_QUERY_PROTOCOL_HPP_
@@ -0,0 +1,192 @@
+/**
+ * @file geometry/query_server.hpp
+ * @author zozibush (zozibush88@gmail.com)
+ * @brief Local query server declaration
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 zozibush, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_QUERY_SERVER_HPP_
+#define ZOZIBUSH__GEOMETRY_QUERY_SERVER_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "geometry/grid_index.hpp"
+#include "geometry/point_cloud.hpp"
+#include "geometry/query_protocol.hpp"
+
+namespace zozibush::geometry::query {
+
+/**
+ * @brief Server answering point queries over a Unix domain socket
+ *
+ * Point sets are indexed once with a GridIndex and shared by every client.
+ * Each connection has a reader thread that parses requests and queues
+ * them. A single dispatcher thread drains the queue: all requests waiting
+ * at that moment, up to max_batch_queries query points, form one batch.
+ * The nearest and radius queries of a batch run in one ParallelFor, and
+ * its distance queries go through one CalculatePairwiseDistances call.
+ * While a batch runs, new requests pile up and form the next one, so
+ * batches grow with the load without a fixed delay. kLoad and kStatistics
+ * requests are answered by the reader thread directly.
+ *
+ * Responses are queued on their connection and sent by its own writer
+ * thread, so a client that reads slowly delays nobody else. A client whose
+ * unsent responses grow past max_outbox_bytes is disconnected.
+ */
+class QueryServer {
+ public:
+  /**
+   * @brief Construct a new QueryServer object, not yet listening
+   * @param socket_path Path of the Unix domain socket
+   * @param thread_count Number of threads per batch, 0 for all hardware
+   * threads
+   * @param max_batch_queries Most query points per batch; a larger
+   * request still forms a batch of its own
+   * @param max_outbox_bytes Most unsent response bytes per connection
+   * before it is dropped; a larger response is still sent on its own
+   * @throw std::invalid_argument If socket_path is empty or too long
+   */
+  explicit QueryServer(std::string socket_path, std::size_t thread_count = 0,
+                       std::size_t max_batch_queries = 65536,
+                       std::size_t max_outbox_bytes = std::size_t{1} << 26U);
+  /**
+   * @brief Copy constructor, deleted
+   */
+  QueryServer(const QueryServer&) = delete;
+  /**
+   * @brief Copy assignment operator, deleted
+   * @return QueryServer& Reference of QueryServer object
+   */
+  auto operator=(const QueryServer&) -> QueryServer& = delete;
+  /**
+   * @brief Stop the server and remove the socket file
+   */
+  ~QueryServer();
+
+  /**
+   * @brief Add and index a point set, also while running
+   * @param points Point cloud, copied
+   * @return uint32_t Set id, counting from 0
+   * @throw std::invalid_argument If points is empty
+   * @throw std::out_of_range If a coordinate is nan or inf
+   * @throw std::length_error If there are 2^32 or more points
+   */
+  auto AddPointSet(const PointCloud<2, double>& points) -> uint32_t;
+
+  /**
+   * @brief Bind the socket and start the threads
+   *
+   * A stale socket file at the path is replaced.
+   *
+   * @throw std::runtime_error If the socket cannot be bound
+   */
+  auto Start() -> void;
+  /**
+   * @brief Close all connections, finish the queued requests and join the
+   * threads; does nothing if not running
+   */
+  auto Stop() -> void;
+
+  /**
+   * @brief Get the server statistics
+   * @return Statistics Counters and latency percentiles
+   */
+  [[nodiscard]] auto GetStatistics() const -> Statistics;
+
+ protected:
+ private:
+  struct PointSet {
+    PointSet(const PointCloud<2, double>& input, double cell_size,
+             std::size_t thread_count);
+
+    PointCloud<2, double> points;  ///< Points of the set
+    GridIndex index;               ///< Index over points
+  };
+  struct Connection {
+    explicit Connection(int input_socket) : socket(input_socket) {}
+    Connection(const Connection&) = delete;
+    auto operator=(const Connection&) -> Connection& = delete;
+    ~Connection();
+
+    int socket{-1};               ///< Socket descriptor, closed on destruction
+    std::mutex outbox_mutex;      ///< Guards the members below
+    std::condition_variable outbox_ready;  ///< Signals outbox changes
+    std::deque<std::vector<char>> outbox;  ///< Responses not yet sent
+    std::size_t outbox_bytes{0};  ///< Bytes in outbox
+    std::size_t pending{0};       ///< Requests read but not yet answered
+    bool reading{true};           ///< Whether the reader thread still runs
+    bool dropped{false};          ///< Whether responses are discarded
+    std::atomic<int> exited{0};   ///< Number of its threads that returned
+  };
+  struct Session {
+    std::shared_ptr<Connection> connection;  ///< Connection of the threads
+    std::thread reader;                      ///< Runs ReadLoop
+    std::thread writer;                      ///< Runs WriteLoop
+  };
+  struct Request {
+    std::shared_ptr<Connection> connection;  ///< Where to respond
+    MessageHeader header;                    ///< Request header
+    std::vector<char> payload;               ///< Request payload
+    std::chrono::steady_clock::time_point arrival;  ///< Arrival time
+  };
+
+  auto AcceptLoop() -> void;
+  auto ReadLoop(std::shared_ptr<Connection> connection) -> void;
+  auto WriteLoop(std::shared_ptr<Connection> connection) -> void;
+  auto JoinExitedSessions() -> void;
+  auto DispatchLoop() -> void;
+  auto RunBatch(std::vector<Request>& batch) -> void;
+  auto Respond(const Request& request, Status status,
+               const std::vector<char>& payload) -> void;
+  auto RespondError(const Request& request, Status status,
+                    const std::string& message) -> void;
+
+  std::string socket_path_;             ///< Socket file path
+  std::size_t thread_count_{0};         ///< Threads per batch
+  std::size_t max_batch_queries_{0};    ///< Query points per batch
+  std::size_t max_outbox_bytes_{0};     ///< Unsent bytes per connection
+
+  mutable std::shared_mutex sets_mutex_;         ///< Guards sets_
+  std::vector<std::unique_ptr<PointSet>> sets_;  ///< Point sets by id
+
+  int listen_socket_{-1};             ///< Listening socket
+  std::atomic<bool> stopping_{false};  ///< Set by Stop
+  std::thread acceptor_;              ///< Runs AcceptLoop
+  std::thread dispatcher_;            ///< Runs DispatchLoop
+
+  std::mutex sessions_mutex_;     ///< Guards sessions_
+  std::vector<Session> sessions_;  ///< Connections and their threads
+
+  mutable std::mutex queue_mutex_;         ///< Guards the queue members
+  std::condition_variable queue_ready_;    ///< Signals new requests
+  std::deque<Request> queue_;              ///< Requests waiting for a batch
+  std::size_t max_queue_depth_{0};         ///< Largest queue size
+  bool dispatcher_done_{false};            ///< Whether to drain and exit
+
+  mutable std::mutex statistics_mutex_;  ///< Guards the members below
+  uint64_t request_count_{0};            ///< Answered requests
+  uint64_t query_count_{0};              ///< Answered query points
+  uint64_t batch_count_{0};              ///< Batches run
+  std::vector<uint64_t> latencies_;      ///< Recent latencies, a ring
+  std::size_t latency_position_{0};      ///< Next ring slot
+};
+
+}  // namespace zozibush::geometry::query
+
+#endif  // ZOZIBUSH__GEOMETRY_QUERY_SERVER_HPP_
@@ -0,0 +1,185 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include <signal.h>
+
+#include <charconv>
+#include <cinttypes>
+#include <cstddef>
+#include <cstdio>
+#include <ctime>
+#include <exception>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "geometry/point_cloud.hpp"
+#include "geometry/query_server.hpp"
+
+namespace {
+using zozibush::geometry::PointCloud;
+
+constexpr int kUsageError{2};
+constexpr const char* kUsage{
+    R"(Usage: geometry_server --socket <path> [options]
+
+Answers nearest, radius and distance queries over a Unix domain socket; see
+geometry/query_protocol.hpp for the protocol. Runs until SIGINT or SIGTERM.
+
+Options:
+  --socket p      Socket path, replaced if it exists
+  --set f         Binary point file (interleaved x, y doubles) to load as
+                  the next set id, repeatable
+  --threads n     Worker threads per batch, 0 for all hardware threads
+  --max-batch n   Most query points per batch (default 65536)
+  --report s      Print statistics to stderr every s seconds, 0 for never
+  -h, --help      Print this text
+)"};
+
+struct Options {
+  std::string socket_path;
+  std::vector<std::string> set_paths;
+  std::size_t thread_count{0};
+  std::size_t max_batch_queries{65536};
+  std::size_t report_seconds{0};
+  bool help{false};
+};
+
+auto ParseCount(std::string_view text, std::string_view option)
+    -> std::size_t {
+  std::size_t value{0};
+  const auto* end{text.data() + text.size()};
+  const auto [kLast, kError] = std::from_chars(text.data(), end, value);
+  if (kError != std::errc() || kLast != end) {
+    throw std::invalid_argument("malformed value '" + std::string(text) +
+                                "' of " + std::string(option));
+  }
+  return value;
+}
+
+auto ParseOptions(int argc, const char* const* argv) -> Options {
+  Options options;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view kArgument{argv[i]};
+    if (kArgument == "-h" || kArgument == "--help") {
+      options.help = true;
+      return options;
+    }
+    if (i + 1 == argc) {
+      throw std::invalid_argument("unknown option or missing value '" +
+                                  std::string(kArgument) + "'");
+    }
+    const std::string_view kValue{argv[++i]};
+    if (kArgument == "--socket") {
+      options.socket_path = kValue;
+    } else if (kArgument == "--set") {
+      options.set_paths.emplace_back(kValue);
+    } else if (kArgument == "--threads") {
+      options.thread_count = ParseCount(kValue, kArgument);
+    } else if (kArgument == "--max-batch") {
+      options.max_batch_queries = ParseCount(kValue, kArgument);
+    } else if (kArgument == "--report") {
+      options.report_seconds = ParseCount(kValue, kArgument);
+    } else {
+      throw std::invalid_argument("unknown option '" + std::string(kArgument) +
+                                  "'");
+    }
+  }
+  if (options.socket_path.empty()) {
+    throw std::invalid_argument("--socket is required");
+  }
+  return options;
+}
+
+auto ReadBinaryPoints(const std::string& path) -> PointCloud<2, double> {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    throw std::runtime_error("cannot open " + path);
+  }
+  std::vector<double> values;
+  double value{0.0};
+  while (file.read(reinterpret_cast<char*>(&value), sizeof(value))) {
+    values.push_back(value);
+  }
+  if (file.gcount() != 0 || values.size() % 2 != 0) {
+    throw std::runtime_error(path + " is not a whole number of points");
+  }
+  PointCloud<2, double> points;
+  points.Resize(values.size() / 2);
+  for (std::size_t i = 0; i < points.Size(); ++i) {
+    points.Data(0)[i] = values[2 * i];
+    points.Data(1)[i] = values[2 * i + 1];
+  }
+  return points;
+}
+
+auto PrintStatistics(const zozibush::geometry::query::Statistics& statistics)
+    -> void {
+  std::fprintf(stderr,
+               "requests %" PRIu64 " queries %" PRIu64 " batches %" PRIu64
+               " queue %" PRIu64 " max queue %" PRIu64 " p50 %.1f us p99 "
+               "%.1f us\n",
+               statistics.request_count, statistics.query_count,
+               statistics.batch_count, statistics.queue_depth,
+               statistics.max_queue_depth,
+               static_cast<double>(statistics.p50_latency_ns) / 1e3,
+               static_cast<double>(statistics.p99_latency_ns) / 1e3);
+}
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+  Options options;
+  try {
+    options = ParseOptions(argc, argv);
+  } catch (const std::invalid_argument& error) {
+    std::fprintf(stderr, "geometry_server: %s\n\n%s", error.what(), kUsage);
+    return kUsageError;
+  }
+  if (options.help) {
+    std::fputs(kUsage, stdout);
+    return 0;
+  }
+
+  // Block the signals before any thread starts, so that all threads inherit
+  // the mask and only the wait below receives them.
+  sigset_t signals;
+  sigemptyset(&signals);
+  sigaddset(&signals, SIGINT);
+  sigaddset(&signals, SIGTERM);
+  pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+  try {
+    zozibush::geometry::query::QueryServer server(
+        options.socket_path, options.thread_count, options.max_batch_queries);
+    for (const auto& kPath : options.set_paths) {
+      const auto kSet{server.AddPointSet(ReadBinaryPoints(kPath))};
+      std::fprintf(stderr, "geometry_server: set %u from %s\n", kSet,
+                   kPath.c_str());
+    }
+    server.Start();
+    std::fprintf(stderr, "geometry_server: listening on %s\n",
+                 options.socket_path.c_str());
+
+    while (true) {
+      if (options.report_seconds == 0) {
+        int signal{0};
+        sigwait(&signals, &signal);
+        break;
+      }
+      const timespec kTimeout{static_cast<time_t>(options.report_seconds), 0};
+      if (sigtimedwait(&signals, nullptr, &kTimeout) >= 0) {
+        break;
+      }
+      PrintStatistics(server.GetStatistics());
+    }
+    server.Stop();
+    PrintStatistics(server.GetStatistics());
+  } catch (const std::exception& error) {
+    std::fprintf(stderr, "geometry_server: %s\n", error.what());
+    return 1;
+  }
+  return 0;
+}
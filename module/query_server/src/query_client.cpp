@@ -0,0 +1,151 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/query_client.hpp"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+using zozibush::geometry::Point2D;
+
+auto AppendPoints(const Point2D* points, std::size_t count,
+                  std::vector<char>& payload) -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    const double kCoordinates[2]{points[i].GetX(), points[i].GetY()};
+    const auto* bytes{reinterpret_cast<const char*>(kCoordinates)};
+    payload.insert(payload.end(), bytes, bytes + sizeof(kCoordinates));
+  }
+}
+
+auto CheckCount(std::size_t count) -> uint32_t {
+  if (count > std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error("too many points in one request");
+  }
+  return static_cast<uint32_t>(count);
+}
+}  // namespace
+
+namespace zozibush::geometry::query {
+QueryClient::QueryClient(const std::string& socket_path) {
+  internal::CheckSocketPath(socket_path);
+  socket_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (socket_ < 0) {
+    throw std::runtime_error(std::string("cannot create socket: ") +
+                             std::strerror(errno));
+  }
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  std::memcpy(address.sun_path, socket_path.c_str(), socket_path.size());
+  if (::connect(socket_, reinterpret_cast<const sockaddr*>(&address),
+                sizeof(address)) != 0) {
+    const std::string kError{std::strerror(errno)};
+    ::close(socket_);
+    throw std::runtime_error("cannot connect to " + socket_path + ": " +
+                             kError);
+  }
+}
+
+QueryClient::~QueryClient() { ::close(socket_); }
+
+auto QueryClient::Nearest(uint32_t set, const Point2D* queries,
+                          std::size_t count, uint32_t* indices,
+                          double* distances) -> void {
+  request_.clear();
+  AppendPoints(queries, count, request_);
+  const auto kHeader{
+      Call(MessageType::kNearest, set, CheckCount(count), request_)};
+  if (kHeader.size != count * (sizeof(uint32_t) + sizeof(double))) {
+    throw std::runtime_error("malformed nearest response");
+  }
+  std::memcpy(indices, response_.data(), count * sizeof(uint32_t));
+  std::memcpy(distances, response_.data() + count * sizeof(uint32_t),
+              count * sizeof(double));
+}
+
+auto QueryClient::Radius(uint32_t set, double radius, const Point2D* queries,
+                         std::size_t count, std::vector<uint32_t>& counts,
+                         std::vector<uint32_t>& indices) -> void {
+  request_.clear();
+  const auto* bytes{reinterpret_cast<const char*>(&radius)};
+  request_.insert(request_.end(), bytes, bytes + sizeof(radius));
+  AppendPoints(queries, count, request_);
+  const auto kHeader{
+      Call(MessageType::kRadius, set, CheckCount(count), request_)};
+  if (kHeader.size < count * sizeof(uint32_t) ||
+      kHeader.size % sizeof(uint32_t) != 0) {
+    throw std::runtime_error("malformed radius response");
+  }
+  counts.resize(count);
+  indices.resize(kHeader.size / sizeof(uint32_t) - count);
+  std::memcpy(counts.data(), response_.data(), count * sizeof(uint32_t));
+  std::memcpy(indices.data(), response_.data() + count * sizeof(uint32_t),
+              indices.size() * sizeof(uint32_t));
+}
+
+auto QueryClient::Distance(uint32_t set, const Point2D* queries,
+                           const uint32_t* indices, std::size_t count,
+                           double* distances) -> void {
+  request_.clear();
+  AppendPoints(queries, count, request_);
+  const auto* bytes{reinterpret_cast<const char*>(indices)};
+  request_.insert(request_.end(), bytes, bytes + count * sizeof(uint32_t));
+  const auto kHeader{
+      Call(MessageType::kDistance, set, CheckCount(count), request_)};
+  if (kHeader.size != count * sizeof(double)) {
+    throw std::runtime_error("malformed distance response");
+  }
+  std::memcpy(distances, response_.data(), count * sizeof(double));
+}
+
+auto QueryClient::Load(const Point2D* points, std::size_t count)
+    -> uint32_t {
+  request_.clear();
+  AppendPoints(points, count, request_);
+  return Call(MessageType::kLoad, 0, CheckCount(count), request_).set;
+}
+
+auto QueryClient::GetStatistics() -> Statistics {
+  const auto kHeader{Call(MessageType::kStatistics, 0, 0, {})};
+  Statistics statistics;
+  if (kHeader.size != sizeof(statistics)) {
+    throw std::runtime_error("malformed statistics response");
+  }
+  std::memcpy(&statistics, response_.data(), sizeof(statistics));
+  return statistics;
+}
+
+auto QueryClient::Call(MessageType type, uint32_t set, uint32_t count,
+                       const std::vector<char>& payload) -> MessageHeader {
+  if (payload.size() > kMaxPayloadSize) {
+    throw std::length_error("request payload too large");
+  }
+  MessageHeader header;
+  header.size = static_cast<uint32_t>(payload.size());
+  header.id = next_id_++;
+  header.type = static_cast<uint16_t>(type);
+  header.set = set;
+  header.count = count;
+  if (!internal::WriteFull(socket_, &header, sizeof(header)) ||
+      !internal::WriteFull(socket_, payload.data(), payload.size()) ||
+      !internal::ReadFull(socket_, &header, sizeof(header))) {
+    throw std::runtime_error("connection to the query server failed");
+  }
+  response_.resize(header.size);
+  if (!internal::ReadFull(socket_, response_.data(), response_.size())) {
+    throw std::runtime_error("connection to the query server failed");
+  }
+  if (header.status != static_cast<uint16_t>(Status::kOk)) {
+    throw std::runtime_error("query server error " +
+                             std::to_string(header.status) + ": " +
+                             std::string(response_.begin(), response_.end()));
+  }
+  return header;
+}
+}  // namespace zozibush::geometry::query
@@ -0,0 +1,78 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/query_protocol.hpp"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace {
+constexpr std::size_t kPointSize{2 * sizeof(double)};
+}  // namespace
+
+namespace zozibush::geometry::query::internal {
+static_assert(sizeof(MessageHeader) == 24, "header must have no padding");
+static_assert(sizeof(Statistics) == 56, "statistics must have no padding");
+
+auto ReadFull(int socket, void* data, std::size_t size) -> bool {
+  auto* bytes{static_cast<char*>(data)};
+  while (size > 0) {
+    const auto kRead{::recv(socket, bytes, size, 0)};
+    if (kRead < 0 && errno == EINTR) {
+      continue;
+    }
+    if (kRead <= 0) {
+      return false;
+    }
+    bytes += kRead;
+    size -= static_cast<std::size_t>(kRead);
+  }
+  return true;
+}
+
+auto WriteFull(int socket, const void* data, std::size_t size) -> bool {
+  const auto* bytes{static_cast<const char*>(data)};
+  while (size > 0) {
+    const auto kWritten{::send(socket, bytes, size, MSG_NOSIGNAL)};
+    if (kWritten < 0 && errno == EINTR) {
+      continue;
+    }
+    if (kWritten <= 0) {
+      return false;
+    }
+    bytes += kWritten;
+    size -= static_cast<std::size_t>(kWritten);
+  }
+  return true;
+}
+
+auto CheckSocketPath(const std::string& path) -> void {
+  if (path.empty() || path.size() >= sizeof(sockaddr_un::sun_path)) {
+    throw std::invalid_argument("socket path is empty or too long");
+  }
+}
+
+auto GetRequestSize(const MessageHeader& header) -> std::size_t {
+  const std::size_t kCount{header.count};
+  switch (static_cast<MessageType>(header.type)) {
+    case MessageType::kNearest:
+    case MessageType::kLoad:
+      return kCount * kPointSize;
+    case MessageType::kRadius:
+      return sizeof(double) + kCount * kPointSize;
+    case MessageType::kDistance:
+      return kCount * (kPointSize + sizeof(uint32_t));
+    case MessageType::kStatistics:
+      return 0;
+  }
+  return std::numeric_limits<std::size_t>::max();
+}
+}  // namespace zozibush::geometry::query::internal
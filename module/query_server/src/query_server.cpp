@@ -0,0 +1,549 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/query_server.hpp"
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "geometry/batch_distance.hpp"
+#include "geometry/parallel.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/tuning.hpp"
+
+namespace {
+using zozibush::geometry::PointCloud;
+
+constexpr std::size_t kLatencyWindow{8192};
+constexpr int kAcceptTimeoutMs{100};
+constexpr std::chrono::milliseconds kWaitTimeout{100};
+constexpr std::size_t kPointSize{2 * sizeof(double)};
+
+// Reads the x, y doubles of count points starting at data.
+auto DecodePoints(const char* data, std::size_t count,
+                  PointCloud<2, double>& points) -> void {
+  points.Resize(count);
+  auto* x_values{points.Data(0)};
+  auto* y_values{points.Data(1)};
+  for (std::size_t i = 0; i < count; ++i) {
+    std::memcpy(&x_values[i], data + i * kPointSize, sizeof(double));
+    std::memcpy(&y_values[i], data + i * kPointSize + sizeof(double),
+                sizeof(double));
+  }
+}
+
+auto AreFinite(const PointCloud<2, double>& points) -> bool {
+  for (std::size_t axis = 0; axis < 2; ++axis) {
+    const auto* values{points.Data(axis)};
+    for (std::size_t i = 0; i < points.Size(); ++i) {
+      if (!std::isfinite(values[i])) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+template <typename T>
+auto Append(const T* values, std::size_t count, std::vector<char>& payload)
+    -> void {
+  const auto kSize{payload.size()};
+  payload.resize(kSize + count * sizeof(T));
+  if (count > 0) {
+    std::memcpy(payload.data() + kSize, values, count * sizeof(T));
+  }
+}
+}  // namespace
+
+namespace zozibush::geometry::query {
+QueryServer::PointSet::PointSet(const PointCloud<2, double>& input,
+                                double cell_size, std::size_t thread_count)
+    : points(input), index(points, cell_size, thread_count) {}
+
+QueryServer::Connection::~Connection() { ::close(socket); }
+
+QueryServer::QueryServer(std::string socket_path, std::size_t thread_count,
+                         std::size_t max_batch_queries,
+                         std::size_t max_outbox_bytes)
+    : socket_path_(std::move(socket_path)),
+      thread_count_(thread_count),
+      max_batch_queries_(max_batch_queries),
+      max_outbox_bytes_(max_outbox_bytes) {
+  internal::CheckSocketPath(socket_path_);
+}
+
+QueryServer::~QueryServer() { Stop(); }
+
+auto QueryServer::AddPointSet(const PointCloud<2, double>& points)
+    -> uint32_t {
+  if (points.Empty()) {
+    throw std::invalid_argument("point set is empty");
+  }
+  if (points.Size() > std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error("point set has 2^32 or more points");
+  }
+  // Indexing happens outside the lock, so queries keep running meanwhile.
+  auto set{std::make_unique<PointSet>(
+      points, GridIndex::EstimateCellSize(points), thread_count_)};
+  const std::unique_lock kLock(sets_mutex_);
+  if (sets_.size() >= std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error("too many point sets");
+  }
+  sets_.push_back(std::move(set));
+  return static_cast<uint32_t>(sets_.size() - 1);
+}
+
+auto QueryServer::Start() -> void {
+  if (listen_socket_ >= 0) {
+    return;
+  }
+  const auto kSocket{::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)};
+  if (kSocket < 0) {
+    throw std::runtime_error(std::string("cannot create socket: ") +
+                             std::strerror(errno));
+  }
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  std::memcpy(address.sun_path, socket_path_.c_str(), socket_path_.size());
+  ::unlink(socket_path_.c_str());
+  if (::bind(kSocket, reinterpret_cast<const sockaddr*>(&address),
+             sizeof(address)) != 0 ||
+      ::listen(kSocket, SOMAXCONN) != 0) {
+    const std::string kError{std::strerror(errno)};
+    ::close(kSocket);
+    throw std::runtime_error("cannot listen on " + socket_path_ + ": " +
+                             kError);
+  }
+
+  listen_socket_ = kSocket;
+  stopping_ = false;
+  dispatcher_done_ = false;
+  acceptor_ = std::thread(&QueryServer::AcceptLoop, this);
+  dispatcher_ = std::thread(&QueryServer::DispatchLoop, this);
+}
+
+auto QueryServer::Stop() -> void {
+  if (listen_socket_ < 0) {
+    return;
+  }
+  // No connection is accepted once the acceptor is joined, so shutting down
+  // the known ones ends every reader thread.
+  stopping_ = true;
+  acceptor_.join();
+  std::vector<Session> sessions;
+  {
+    const std::lock_guard kLock(sessions_mutex_);
+    sessions.swap(sessions_);
+  }
+  for (const auto& kSession : sessions) {
+    ::shutdown(kSession.connection->socket, SHUT_RDWR);
+  }
+  for (auto& session : sessions) {
+    session.reader.join();
+  }
+  {
+    const std::lock_guard kLock(queue_mutex_);
+    dispatcher_done_ = true;
+  }
+  queue_ready_.notify_all();
+  dispatcher_.join();
+  // Every request is answered now, so the writers run out of work.
+  for (auto& session : sessions) {
+    session.writer.join();
+  }
+
+  ::close(listen_socket_);
+  listen_socket_ = -1;
+  ::unlink(socket_path_.c_str());
+}
+
+auto QueryServer::GetStatistics() const -> Statistics {
+  Statistics statistics;
+  std::vector<uint64_t> latencies;
+  {
+    const std::lock_guard kLock(statistics_mutex_);
+    statistics.request_count = request_count_;
+    statistics.query_count = query_count_;
+    statistics.batch_count = batch_count_;
+    latencies = latencies_;
+  }
+  {
+    const std::lock_guard kLock(queue_mutex_);
+    statistics.queue_depth = queue_.size();
+    statistics.max_queue_depth = max_queue_depth_;
+  }
+  if (!latencies.empty()) {
+    const auto kLast{latencies.size() - 1};
+    auto* p50{latencies.data() + kLast / 2};
+    auto* p99{latencies.data() + kLast * 99 / 100};
+    std::nth_element(latencies.data(), p99, latencies.data() + kLast + 1);
+    // Everything before p99 is no larger, so the median is among them.
+    std::nth_element(latencies.data(), p50, p99);
+    statistics.p50_latency_ns = *p50;
+    statistics.p99_latency_ns = *p99;
+  }
+  return statistics;
+}
+
+auto QueryServer::AcceptLoop() -> void {
+  while (!stopping_) {
+    JoinExitedSessions();
+    pollfd descriptor{listen_socket_, POLLIN, 0};
+    if (::poll(&descriptor, 1, kAcceptTimeoutMs) <= 0) {
+      continue;
+    }
+    const auto kSocket{::accept4(listen_socket_, nullptr, nullptr,
+                                 SOCK_CLOEXEC)};
+    if (kSocket < 0) {
+      continue;
+    }
+    auto connection{std::make_shared<Connection>(kSocket)};
+    const std::lock_guard kLock(sessions_mutex_);
+    sessions_.push_back(
+        {connection, std::thread(&QueryServer::ReadLoop, this, connection),
+         std::thread(&QueryServer::WriteLoop, this, connection)});
+  }
+}
+
+auto QueryServer::JoinExitedSessions() -> void {
+  const std::lock_guard kLock(sessions_mutex_);
+  const auto kExited{std::partition(
+      sessions_.begin(), sessions_.end(), [](const Session& kSession) {
+        return kSession.connection->exited < 2;
+      })};
+  for (auto session = kExited; session != sessions_.end(); ++session) {
+    session->reader.join();
+    session->writer.join();
+  }
+  sessions_.erase(kExited, sessions_.end());
+}
+
+auto QueryServer::ReadLoop(std::shared_ptr<Connection> connection) -> void {
+  Request request;
+  request.connection = connection;
+  while (internal::ReadFull(connection->socket, &request.header,
+                            sizeof(request.header))) {
+    const auto kTooLarge{request.header.size > kMaxPayloadSize};
+    if (!kTooLarge) {
+      request.payload.resize(request.header.size);
+      if (!internal::ReadFull(connection->socket, request.payload.data(),
+                              request.payload.size())) {
+        break;
+      }
+    }
+    request.arrival = std::chrono::steady_clock::now();
+    // Every complete request gets exactly one response, which the writer
+    // thread waits for before it exits.
+    {
+      const std::lock_guard kLock(connection->outbox_mutex);
+      ++connection->pending;
+    }
+    if (kTooLarge) {
+      // The stream cannot be resynchronized without reading the payload.
+      RespondError(request, Status::kBadRequest, "payload too large");
+      break;
+    }
+    if (internal::GetRequestSize(request.header) != request.header.size) {
+      RespondError(request, Status::kBadRequest,
+                   "unknown type or payload size does not match count");
+      continue;
+    }
+
+    const auto kType{static_cast<MessageType>(request.header.type)};
+    if (kType == MessageType::kStatistics) {
+      const auto kStatistics{GetStatistics()};
+      std::vector<char> payload;
+      Append(&kStatistics, 1, payload);
+      Respond(request, Status::kOk, payload);
+    } else if (kType == MessageType::kLoad) {
+      try {
+        PointCloud<2, double> points;
+        DecodePoints(request.payload.data(), request.header.count, points);
+        request.header.set = AddPointSet(points);
+        Respond(request, Status::kOk, {});
+      } catch (const std::exception& kError) {
+        RespondError(request, Status::kBadRequest, kError.what());
+      }
+    } else {
+      {
+        const std::lock_guard kLock(queue_mutex_);
+        queue_.push_back(std::move(request));
+        max_queue_depth_ = std::max(max_queue_depth_, queue_.size());
+      }
+      queue_ready_.notify_one();
+      request = Request{connection, {}, {}, {}};
+    }
+  }
+
+  {
+    const std::lock_guard kLock(connection->outbox_mutex);
+    connection->reading = false;
+  }
+  connection->outbox_ready.notify_one();
+  ++connection->exited;
+}
+
+auto QueryServer::WriteLoop(std::shared_ptr<Connection> connection) -> void {
+  std::unique_lock lock(connection->outbox_mutex);
+  while (!connection->dropped) {
+    if (connection->outbox.empty()) {
+      if (!connection->reading && connection->pending == 0) {
+        break;
+      }
+      connection->outbox_ready.wait_for(lock, kWaitTimeout);
+      continue;
+    }
+    const auto kMessage{std::move(connection->outbox.front())};
+    connection->outbox.pop_front();
+    connection->outbox_bytes -= kMessage.size();
+    lock.unlock();
+    const auto kWritten{
+        internal::WriteFull(connection->socket, kMessage.data(),
+                            kMessage.size())};
+    lock.lock();
+    if (!kWritten) {
+      // The client is gone; make sure its reader thread notices too.
+      connection->dropped = true;
+      ::shutdown(connection->socket, SHUT_RDWR);
+    }
+  }
+  connection->outbox.clear();
+  connection->outbox_bytes = 0;
+  lock.unlock();
+  ++connection->exited;
+}
+
+auto QueryServer::DispatchLoop() -> void {
+  std::vector<Request> batch;
+  while (true) {
+    {
+      std::unique_lock lock(queue_mutex_);
+      while (!dispatcher_done_ && queue_.empty()) {
+        queue_ready_.wait_for(lock, kWaitTimeout);
+      }
+      if (queue_.empty()) {
+        return;
+      }
+      std::size_t query_count{0};
+      do {
+        query_count += queue_.front().header.count;
+        batch.push_back(std::move(queue_.front()));
+        queue_.pop_front();
+      } while (!queue_.empty() &&
+               query_count + queue_.front().header.count <= max_batch_queries_);
+    }
+    {
+      const std::lock_guard kLock(statistics_mutex_);
+      ++batch_count_;
+    }
+    try {
+      RunBatch(batch);
+    } catch (const std::exception& kError) {
+      for (const auto& kRequest : batch) {
+        RespondError(kRequest, Status::kServerError, kError.what());
+      }
+    }
+    batch.clear();
+  }
+}
+
+auto QueryServer::RunBatch(std::vector<Request>& batch) -> void {
+  const std::shared_lock kLock(sets_mutex_);
+
+  // Lay out the nearest and radius queries of all requests side by side; a
+  // negative radius marks a nearest query. Distance queries become pairs of
+  // query point and set point.
+  std::vector<Status> statuses(batch.size(), Status::kOk);
+  std::vector<std::size_t> firsts(batch.size(), 0);
+  PointCloud<2, double> searches;
+  std::vector<uint32_t> search_sets;
+  std::vector<double> search_radii;
+  PointCloud<2, double> lhs;
+  PointCloud<2, double> rhs;
+  PointCloud<2, double> points;
+  for (std::size_t r = 0; r < batch.size(); ++r) {
+    const auto& kHeader{batch[r].header};
+    const auto* payload{batch[r].payload.data()};
+    if (kHeader.set >= sets_.size()) {
+      statuses[r] = Status::kUnknownSet;
+      continue;
+    }
+    const auto kType{static_cast<MessageType>(kHeader.type)};
+    auto radius{-1.0};
+    if (kType == MessageType::kRadius) {
+      std::memcpy(&radius, payload, sizeof(double));
+      payload += sizeof(double);
+      if (!std::isfinite(radius) || radius < 0.0) {
+        statuses[r] = Status::kBadRequest;
+        continue;
+      }
+    }
+    DecodePoints(payload, kHeader.count, points);
+    if (!AreFinite(points)) {
+      statuses[r] = Status::kBadRequest;
+      continue;
+    }
+
+    const auto& kSet{*sets_[kHeader.set]};
+    if (kType == MessageType::kDistance) {
+      const auto* indices{payload + kHeader.count * kPointSize};
+      std::vector<uint32_t> set_indices(kHeader.count);
+      std::memcpy(set_indices.data(), indices,
+                  kHeader.count * sizeof(uint32_t));
+      if (std::any_of(set_indices.begin(), set_indices.end(),
+                      [&](uint32_t index) {
+                        return index >= kSet.points.Size();
+                      })) {
+        statuses[r] = Status::kIndexOutOfRange;
+        continue;
+      }
+      firsts[r] = lhs.Size();
+      for (std::size_t i = 0; i < kHeader.count; ++i) {
+        lhs.PushBack(points.Get(i));
+        rhs.PushBack(kSet.points.Get(set_indices[i]));
+      }
+    } else {
+      firsts[r] = searches.Size();
+      for (std::size_t i = 0; i < kHeader.count; ++i) {
+        searches.PushBack(points.Get(i));
+        search_sets.push_back(kHeader.set);
+        search_radii.push_back(radius);
+      }
+    }
+  }
+
+  const auto kSearchCount{searches.Size()};
+  std::vector<uint32_t> nearest(kSearchCount);
+  std::vector<double> nearest_distances(kSearchCount);
+  std::vector<std::vector<std::size_t>> found(kSearchCount);
+  ParallelFor(
+      kSearchCount, GetTuningParameters().query_grain,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          const auto& kSet{*sets_[search_sets[i]]};
+          const Point2D kQuery(searches.Data(0)[i], searches.Data(1)[i]);
+          if (search_radii[i] < 0.0) {
+            const auto kNearest{kSet.index.FindNearest(kQuery)};
+            nearest[i] = static_cast<uint32_t>(kNearest);
+            nearest_distances[i] = kQuery.CalculateDistance(
+                {kSet.points.Data(0)[kNearest], kSet.points.Data(1)[kNearest]});
+          } else {
+            kSet.index.SearchRadius(kQuery, search_radii[i], found[i]);
+          }
+        }
+      },
+      thread_count_);
+  std::vector<double> distances(lhs.Size());
+  CalculatePairwiseDistances(lhs, rhs, distances.data());
+
+  std::vector<char> payload;
+  std::vector<uint32_t> values;
+  for (std::size_t r = 0; r < batch.size(); ++r) {
+    if (statuses[r] == Status::kUnknownSet) {
+      RespondError(batch[r], statuses[r], "unknown point set");
+      continue;
+    }
+    if (statuses[r] == Status::kIndexOutOfRange) {
+      RespondError(batch[r], statuses[r], "point index out of range");
+      continue;
+    }
+    if (statuses[r] != Status::kOk) {
+      RespondError(batch[r], statuses[r], "radius or point is not finite");
+      continue;
+    }
+    const auto kFirst{firsts[r]};
+    const auto kCount{batch[r].header.count};
+    payload.clear();
+    switch (static_cast<MessageType>(batch[r].header.type)) {
+      case MessageType::kNearest:
+        Append(nearest.data() + kFirst, kCount, payload);
+        Append(nearest_distances.data() + kFirst, kCount, payload);
+        break;
+      case MessageType::kRadius:
+        values.clear();
+        for (std::size_t i = kFirst; i < kFirst + kCount; ++i) {
+          values.push_back(static_cast<uint32_t>(found[i].size()));
+        }
+        for (std::size_t i = kFirst; i < kFirst + kCount; ++i) {
+          values.insert(values.end(), found[i].begin(), found[i].end());
+        }
+        Append(values.data(), values.size(), payload);
+        break;
+      default:
+        Append(distances.data() + kFirst, kCount, payload);
+        break;
+    }
+    Respond(batch[r], Status::kOk, payload);
+  }
+}
+
+auto QueryServer::Respond(const Request& request, Status status,
+                          const std::vector<char>& payload) -> void {
+  auto header{request.header};
+  header.size = static_cast<uint32_t>(payload.size());
+  header.status = static_cast<uint16_t>(status);
+
+  // Counted before writing, so that a client sees its own request in the
+  // statistics it asks for next.
+  const auto kLatency{std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - request.arrival)};
+  {
+    const std::lock_guard kLock(statistics_mutex_);
+    ++request_count_;
+    if (status == Status::kOk &&
+        header.type != static_cast<uint16_t>(MessageType::kLoad)) {
+      query_count_ += header.count;
+    }
+    const auto kValue{static_cast<uint64_t>(kLatency.count())};
+    if (latencies_.size() < kLatencyWindow) {
+      latencies_.push_back(kValue);
+    } else {
+      latencies_[latency_position_] = kValue;
+      latency_position_ = (latency_position_ + 1) % kLatencyWindow;
+    }
+  }
+
+  std::vector<char> message(sizeof(header) + payload.size());
+  std::memcpy(message.data(), &header, sizeof(header));
+  if (!payload.empty()) {
+    std::memcpy(message.data() + sizeof(header), payload.data(),
+                payload.size());
+  }
+  auto& connection{*request.connection};
+  {
+    const std::lock_guard kLock(connection.outbox_mutex);
+    if (connection.pending > 0) {
+      --connection.pending;
+    }
+    if (connection.dropped) {
+      return;
+    }
+    if (connection.outbox_bytes > max_outbox_bytes_) {
+      // The client stopped reading; drop it rather than buffer without
+      // bound. Its reader and writer threads then wind down.
+      connection.dropped = true;
+      ::shutdown(connection.socket, SHUT_RDWR);
+    } else {
+      connection.outbox_bytes += message.size();
+      connection.outbox.push_back(std::move(message));
+    }
+  }
+  connection.outbox_ready.notify_one();
+}
+
+auto QueryServer::RespondError(const Request& request, Status status,
+                               const std::string& message) -> void {
+  Respond(request, status, std::vector<char>(message.begin(), message.end()));
+}
+}  // namespace zozibush::geometry::query
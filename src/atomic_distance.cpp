@@ -0,0 +1,149 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/atomic_distance.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+auto GetThreadHash() -> std::size_t {
+  thread_local const std::size_t kThreadHash{
+      std::hash<std::thread::id>{}(std::this_thread::get_id())};
+  return kThreadHash;
+}
+
+auto GetDefaultShardCount() -> std::size_t {
+  const auto kHardwareThreads{std::thread::hardware_concurrency()};
+  return (kHardwareThreads == 0U) ? 1U : kHardwareThreads;
+}
+}  // namespace
+
+namespace zozibush::geometry {
+AtomicDistance::AtomicDistance(const Distance& initial)
+    : nanometer_(initial.GetNanometer()) {}
+
+auto AtomicDistance::IsLockFree() const -> bool {
+  return nanometer_.is_lock_free();
+}
+
+auto AtomicDistance::Load(std::memory_order order) const -> Distance {
+  return Distance::FromNanometer(nanometer_.load(order));
+}
+auto AtomicDistance::Store(const Distance& desired, std::memory_order order)
+    -> void {
+  nanometer_.store(desired.GetNanometer(), order);
+}
+auto AtomicDistance::Exchange(const Distance& desired, std::memory_order order)
+    -> Distance {
+  return Distance::FromNanometer(
+      nanometer_.exchange(desired.GetNanometer(), order));
+}
+
+auto AtomicDistance::FetchAdd(const Distance& other, std::memory_order order)
+    -> Distance {
+  return Distance::FromNanometer(
+      nanometer_.fetch_add(other.GetNanometer(), order));
+}
+auto AtomicDistance::FetchSub(const Distance& other, std::memory_order order)
+    -> Distance {
+  return Distance::FromNanometer(
+      nanometer_.fetch_sub(other.GetNanometer(), order));
+}
+
+auto AtomicDistance::CompareExchange(Distance& expected,
+                                     const Distance& desired,
+                                     std::memory_order order) -> bool {
+  auto expected_nanometer{expected.GetNanometer()};
+  const auto kExchanged{nanometer_.compare_exchange_strong(
+      expected_nanometer, desired.GetNanometer(), order)};
+  expected = Distance::FromNanometer(expected_nanometer);
+  return kExchanged;
+}
+
+auto AtomicDistance::FetchMin(const Distance& other, std::memory_order order)
+    -> Distance {
+  const auto kCandidate{other.GetNanometer()};
+  auto current{nanometer_.load(std::memory_order_relaxed)};
+  while (kCandidate < current &&
+         !nanometer_.compare_exchange_weak(current, kCandidate, order,
+                                           std::memory_order_relaxed)) {
+  }
+  return Distance::FromNanometer(current);
+}
+auto AtomicDistance::FetchMax(const Distance& other, std::memory_order order)
+    -> Distance {
+  const auto kCandidate{other.GetNanometer()};
+  auto current{nanometer_.load(std::memory_order_relaxed)};
+  while (kCandidate > current &&
+         !nanometer_.compare_exchange_weak(current, kCandidate, order,
+                                           std::memory_order_relaxed)) {
+  }
+  return Distance::FromNanometer(current);
+}
+
+auto AtomicDistance::operator+=(const Distance& other) -> void {
+  nanometer_.fetch_add(other.GetNanometer());
+}
+auto AtomicDistance::operator-=(const Distance& other) -> void {
+  nanometer_.fetch_sub(other.GetNanometer());
+}
+
+ShardedAtomicDistance::ShardedAtomicDistance()
+    : ShardedAtomicDistance(GetDefaultShardCount()) {}
+
+ShardedAtomicDistance::ShardedAtomicDistance(std::size_t shard_count)
+    : shard_count_(shard_count) {
+  if (shard_count == 0U) {
+    throw std::invalid_argument("shard count is 0");
+  }
+  shards_ = std::make_unique<Shard[]>(shard_count);
+}
+
+auto ShardedAtomicDistance::GetShardCount() const -> std::size_t {
+  return shard_count_;
+}
+
+auto ShardedAtomicDistance::GetLocalShard() -> Shard& {
+  return shards_[GetThreadHash() % shard_count_];
+}
+
+auto ShardedAtomicDistance::Add(const Distance& other) -> void {
+  GetLocalShard().nanometer.fetch_add(other.GetNanometer(),
+                                      std::memory_order_relaxed);
+}
+auto ShardedAtomicDistance::Subtract(const Distance& other) -> void {
+  GetLocalShard().nanometer.fetch_sub(other.GetNanometer(),
+                                      std::memory_order_relaxed);
+}
+
+auto ShardedAtomicDistance::Load() const -> Distance {
+  // Sum as unsigned so intermediate wrap-around between shards is defined and
+  // cancels out exactly like the single atomic would.
+  uint64_t total{0};
+  for (std::size_t i = 0; i < shard_count_; ++i) {
+    total += static_cast<uint64_t>(
+        shards_[i].nanometer.load(std::memory_order_relaxed));
+  }
+  return Distance::FromNanometer(static_cast<int64_t>(total));
+}
+auto ShardedAtomicDistance::Drain() -> Distance {
+  uint64_t total{0};
+  for (std::size_t i = 0; i < shard_count_; ++i) {
+    total += static_cast<uint64_t>(
+        shards_[i].nanometer.exchange(0, std::memory_order_relaxed));
+  }
+  return Distance::FromNanometer(static_cast<int64_t>(total));
+}
+
+auto ShardedAtomicDistance::operator+=(const Distance& other) -> void {
+  Add(other);
+}
+auto ShardedAtomicDistance::operator-=(const Distance& other) -> void {
+  Subtract(other);
+}
+}  // namespace zozibush::geometry
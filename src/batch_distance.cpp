@@ -0,0 +1,98 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/batch_distance.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+template <std::size_t D, typename T>
+auto GetAxes(const zozibush::geometry::PointCloud<D, T>& cloud)
+    -> std::array<const T*, D> {
+  std::array<const T*, D> result{};
+  for (std::size_t axis = 0; axis < D; ++axis) {
+    result[axis] = cloud.Data(axis);
+  }
+  return result;
+}
+
+template <typename T>
+auto TakeSquareRoots(std::size_t count, T* values) -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    values[i] = std::sqrt(values[i]);
+  }
+}
+}  // namespace
+
+namespace zozibush::geometry {
+template <std::size_t D, typename T>
+auto CalculateSquaredDistances(const PointCloud<D, T>& cloud,
+                               const PointN<D, T>& query, T* distances)
+    -> void {
+  const auto kAxes{GetAxes(cloud)};
+  const auto kCount{cloud.Size()};
+  for (std::size_t i = 0; i < kCount; ++i) {
+    T sum{0};
+    internal::ForEachAxis(
+        [&](auto axis) {
+          const T kDelta{std::get<axis>(kAxes)[i] - query.template Get<axis>()};
+          sum += kDelta * kDelta;
+        },
+        std::make_index_sequence<D>{});
+    distances[i] = sum;
+  }
+}
+
+template <std::size_t D, typename T>
+auto CalculateDistances(const PointCloud<D, T>& cloud,
+                        const PointN<D, T>& query, T* distances) -> void {
+  CalculateSquaredDistances(cloud, query, distances);
+  TakeSquareRoots(cloud.Size(), distances);
+}
+
+template <std::size_t D, typename T>
+auto CalculatePairwiseDistances(const PointCloud<D, T>& lhs,
+                                const PointCloud<D, T>& rhs, T* distances)
+    -> void {
+  if (lhs.Size() != rhs.Size()) {
+    throw std::invalid_argument("point clouds differ in size");
+  }
+
+  const auto kLhsAxes{GetAxes(lhs)};
+  const auto kRhsAxes{GetAxes(rhs)};
+  const auto kCount{lhs.Size()};
+  for (std::size_t i = 0; i < kCount; ++i) {
+    T sum{0};
+    internal::ForEachAxis(
+        [&](auto axis) {
+          const T kDelta{std::get<axis>(kLhsAxes)[i] -
+                         std::get<axis>(kRhsAxes)[i]};
+          sum += kDelta * kDelta;
+        },
+        std::make_index_sequence<D>{});
+    distances[i] = std::sqrt(sum);
+  }
+}
+
+#define ZOZIBUSH_GEOMETRY_INSTANTIATE_BATCH_DISTANCE(D, T)                   \
+  template auto CalculateSquaredDistances(const PointCloud<D, T>& cloud,     \
+                                          const PointN<D, T>& query,         \
+                                          T* distances) -> void;             \
+  template auto CalculateDistances(const PointCloud<D, T>& cloud,            \
+                                   const PointN<D, T>& query, T* distances)  \
+      -> void;                                                               \
+  template auto CalculatePairwiseDistances(const PointCloud<D, T>& lhs,      \
+                                           const PointCloud<D, T>& rhs,      \
+                                           T* distances) -> void;
+
+ZOZIBUSH_GEOMETRY_INSTANTIATE_BATCH_DISTANCE(2, float)
+ZOZIBUSH_GEOMETRY_INSTANTIATE_BATCH_DISTANCE(2, double)
+ZOZIBUSH_GEOMETRY_INSTANTIATE_BATCH_DISTANCE(3, float)
+ZOZIBUSH_GEOMETRY_INSTANTIATE_BATCH_DISTANCE(3, double)
+
+#undef ZOZIBUSH_GEOMETRY_INSTANTIATE_BATCH_DISTANCE
+}  // namespace zozibush::geometry
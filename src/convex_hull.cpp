@@ -0,0 +1,108 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/convex_hull.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "geometry/parallel.hpp"
+#include "geometry/predicates.hpp"
+
+namespace {
+constexpr std::size_t kBlockSize{std::size_t{1} << 16U};
+
+// Replaces candidates by the hull of those points, counter-clockwise from
+// the lowest (x, y) point, using hull as scratch.
+auto BuildHull(const double* x_values, const double* y_values,
+               std::vector<std::size_t>& candidates,
+               std::vector<std::size_t>& hull) -> void {
+  std::sort(candidates.begin(), candidates.end(),
+            [&](std::size_t lhs, std::size_t rhs) {
+              if (x_values[lhs] != x_values[rhs]) {
+                return x_values[lhs] < x_values[rhs];
+              }
+              if (y_values[lhs] != y_values[rhs]) {
+                return y_values[lhs] < y_values[rhs];
+              }
+              return lhs < rhs;
+            });
+  candidates.erase(
+      std::unique(candidates.begin(), candidates.end(),
+                  [&](std::size_t lhs, std::size_t rhs) {
+                    return x_values[lhs] == x_values[rhs] &&
+                           y_values[lhs] == y_values[rhs];
+                  }),
+      candidates.end());
+  if (candidates.size() < 3) {
+    return;
+  }
+  hull.clear();
+
+  const auto kTurnsLeft{[&](std::size_t first, std::size_t second,
+                            std::size_t third) {
+    return zozibush::geometry::Orient2D(
+               x_values[first], y_values[first], x_values[second],
+               y_values[second], x_values[third], y_values[third]) > 0.0;
+  }};
+  const auto kAppend{[&](std::size_t point, std::size_t floor) {
+    while (hull.size() > floor &&
+           !kTurnsLeft(hull[hull.size() - 2], hull.back(), point)) {
+      hull.pop_back();
+    }
+    hull.push_back(point);
+  }};
+  for (const auto kPoint : candidates) {
+    kAppend(kPoint, 1);
+  }
+  const auto kLowerSize{hull.size()};
+  for (auto point = candidates.rbegin() + 1; point != candidates.rend();
+       ++point) {
+    kAppend(*point, kLowerSize);
+  }
+  // The upper chain ends at the first point again.
+  hull.pop_back();
+  candidates.swap(hull);
+}
+}  // namespace
+
+namespace zozibush::geometry {
+auto FindConvexHull(const PointCloud<2, double>& points,
+                    std::vector<std::size_t>& indices,
+                    std::size_t thread_count) -> std::size_t {
+  const auto kCount{points.Size()};
+  const auto* x_values{points.Data(0)};
+  const auto* y_values{points.Data(1)};
+  const auto kBlocks{(kCount + kBlockSize - 1) / kBlockSize};
+
+  std::vector<std::vector<std::size_t>> block_hulls(kBlocks);
+  ParallelFor(
+      kBlocks, 1,
+      [&](std::size_t first_block, std::size_t last_block) {
+        std::vector<std::size_t> scratch;
+        for (auto block = first_block; block < last_block; ++block) {
+          auto& hull{block_hulls[block]};
+          const auto kEnd{std::min(kCount, (block + 1) * kBlockSize)};
+          for (auto i = block * kBlockSize; i < kEnd; ++i) {
+            if (!std::isfinite(x_values[i]) || !std::isfinite(y_values[i])) {
+              throw std::out_of_range("point is nan or inf");
+            }
+            hull.push_back(i);
+          }
+          BuildHull(x_values, y_values, hull, scratch);
+        }
+      },
+      thread_count);
+
+  indices.clear();
+  for (const auto& hull : block_hulls) {
+    indices.insert(indices.end(), hull.begin(), hull.end());
+  }
+  std::vector<std::size_t> scratch;
+  BuildHull(x_values, y_values, indices, scratch);
+  return indices.size();
+}
+}  // namespace zozibush::geometry
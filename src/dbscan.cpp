@@ -0,0 +1,164 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/dbscan.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "geometry/grid_index.hpp"
+#include "geometry/parallel.hpp"
+#include "geometry/tuning.hpp"
+
+namespace {
+// Union-find over atomic parents. A root is only ever linked below a smaller
+// root, so parents decrease monotonically and each root is the lowest index
+// of its set. Relaxed ordering is enough: the parents publish no other data,
+// and ParallelFor joins the threads before anyone reads the result.
+class ConcurrentDisjointSet {
+ public:
+  explicit ConcurrentDisjointSet(std::size_t count) : parents_(count) {
+    for (std::size_t i = 0; i < count; ++i) {
+      parents_[i].store(i, std::memory_order_relaxed);
+    }
+  }
+
+  auto Find(std::size_t index) -> std::size_t {
+    while (true) {
+      auto parent{parents_[index].load(std::memory_order_relaxed)};
+      if (parent == index) {
+        return index;
+      }
+      const auto kGrandparent{parents_[parent].load(std::memory_order_relaxed)};
+      if (kGrandparent != parent) {
+        // Path halving; losing the race only skips a shortcut.
+        parents_[index].compare_exchange_weak(parent, kGrandparent,
+                                              std::memory_order_relaxed);
+      }
+      index = kGrandparent;
+    }
+  }
+
+  auto Union(std::size_t lhs, std::size_t rhs) -> void {
+    while (true) {
+      lhs = Find(lhs);
+      rhs = Find(rhs);
+      if (lhs == rhs) {
+        return;
+      }
+      if (lhs < rhs) {
+        std::swap(lhs, rhs);
+      }
+      auto expected{lhs};
+      if (parents_[lhs].compare_exchange_strong(expected, rhs,
+                                                std::memory_order_relaxed)) {
+        return;
+      }
+    }
+  }
+
+ private:
+  std::vector<std::atomic<std::size_t>> parents_;
+};
+}  // namespace
+
+namespace zozibush::geometry {
+Dbscan::Dbscan(const Distance& eps, std::size_t min_points,
+               Distance::Type unit)
+    : eps_(eps.GetValue(unit)), min_points_(min_points) {
+  if (!(eps_ > 0.0)) {
+    throw std::invalid_argument("eps is not positive");
+  }
+  if (min_points_ == 0) {
+    throw std::invalid_argument("min_points is 0");
+  }
+}
+
+auto Dbscan::Cluster(const PointCloud<2, double>& points, int64_t* labels,
+                     std::size_t thread_count) const -> std::size_t {
+  const auto kCount{points.Size()};
+  const auto kPointGrain{GetTuningParameters().query_grain};
+  const GridIndex kGrid(points, eps_, thread_count);
+  const auto* x_values{points.Data(0)};
+  const auto* y_values{points.Data(1)};
+
+  std::vector<uint8_t> core(kCount);
+  ParallelFor(
+      kCount, kPointGrain,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          std::size_t neighbours{0};
+          kGrid.VisitRadius(x_values[i], y_values[i], eps_, [&](std::size_t) {
+            return ++neighbours < min_points_;
+          });
+          core[i] = static_cast<uint8_t>(neighbours >= min_points_);
+        }
+      },
+      thread_count);
+
+  ConcurrentDisjointSet clusters(kCount);
+  ParallelFor(
+      kCount, kPointGrain,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          if (core[i] == 0) {
+            continue;
+          }
+          kGrid.VisitRadius(x_values[i], y_values[i], eps_,
+                            [&](std::size_t neighbour) {
+                              if (neighbour < i && core[neighbour] != 0) {
+                                clusters.Union(i, neighbour);
+                              }
+                              return true;
+                            });
+        }
+      },
+      thread_count);
+
+  // Roots are the lowest core index of their cluster, so numbering them in
+  // index order is deterministic. Only roots are read while labelling.
+  std::size_t cluster_count{0};
+  for (std::size_t i = 0; i < kCount; ++i) {
+    if (core[i] != 0 && clusters.Find(i) == i) {
+      labels[i] = static_cast<int64_t>(cluster_count++);
+    }
+  }
+  ParallelFor(
+      kCount, kPointGrain,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          if (core[i] == 0) {
+            continue;
+          }
+          const auto kRoot{clusters.Find(i)};
+          if (kRoot != i) {
+            labels[i] = labels[kRoot];
+          }
+        }
+      },
+      thread_count);
+  ParallelFor(
+      kCount, kPointGrain,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          if (core[i] != 0) {
+            continue;
+          }
+          auto owner{kCount};
+          kGrid.VisitRadius(x_values[i], y_values[i], eps_,
+                            [&](std::size_t neighbour) {
+                              if (core[neighbour] != 0 && neighbour < owner) {
+                                owner = neighbour;
+                              }
+                              return true;
+                            });
+          labels[i] = (owner < kCount) ? labels[owner] : kNoise;
+        }
+      },
+      thread_count);
+  return cluster_count;
+}
+}  // namespace zozibush::geometry
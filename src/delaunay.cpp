@@ -0,0 +1,413 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/delaunay.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "geometry/predicates.hpp"
+
+namespace {
+constexpr double kInfinity{std::numeric_limits<double>::infinity()};
+constexpr uint32_t kInvalid{zozibush::geometry::Delaunay::kInvalid};
+
+auto CalculateSquaredDistance(double ax, double ay, double bx, double by)
+    -> double {
+  const auto kDeltaX{ax - bx};
+  const auto kDeltaY{ay - by};
+  return kDeltaX * kDeltaX + kDeltaY * kDeltaY;
+}
+
+// Circumcenter relative to a; inf or nan components for collinear points.
+auto CalculateCircumcenterOffset(double ax, double ay, double bx, double by,
+                                 double cx, double cy)
+    -> std::pair<double, double> {
+  const auto kDx{bx - ax};
+  const auto kDy{by - ay};
+  const auto kEx{cx - ax};
+  const auto kEy{cy - ay};
+  const auto kBl{kDx * kDx + kDy * kDy};
+  const auto kCl{kEx * kEx + kEy * kEy};
+  const auto kScale{0.5 / (kDx * kEy - kDy * kEx)};
+  return {(kEy * kBl - kDy * kCl) * kScale, (kDx * kCl - kEx * kBl) * kScale};
+}
+
+// Monotone in the angle of (dx, dy), in [0, 1).
+auto CalculatePseudoAngle(double delta_x, double delta_y) -> double {
+  const auto kNorm{std::abs(delta_x) + std::abs(delta_y)};
+  const auto kRatio{kNorm > 0.0 ? delta_x / kNorm : 0.0};
+  return (delta_y > 0.0 ? 3.0 - kRatio : 1.0 + kRatio) / 4.0;
+}
+}  // namespace
+
+namespace zozibush::geometry {
+Delaunay::Delaunay(const PointCloud<2, double>& points)
+    : x_values_(points.Data(0), points.Data(0) + points.Size()),
+      y_values_(points.Data(1), points.Data(1) + points.Size()) {
+  if (points.Size() > kInvalid / 6) {
+    throw std::length_error("too many points for 32-bit half-edges");
+  }
+  for (std::size_t i = 0; i < points.Size(); ++i) {
+    if (!std::isfinite(x_values_[i]) || !std::isfinite(y_values_[i])) {
+      throw std::out_of_range("point is nan or inf");
+    }
+  }
+
+  Triangulate();
+
+  hull_next_ = {};
+  hull_previous_ = {};
+  hull_edges_ = {};
+  hull_hash_ = {};
+  edge_stack_ = {};
+}
+
+auto Delaunay::GetPointCount() const -> std::size_t { return x_values_.size(); }
+auto Delaunay::GetPoint(uint32_t index) const -> Point2D {
+  return {x_values_[index], y_values_[index]};
+}
+auto Delaunay::GetTriangleCount() const -> std::size_t {
+  return triangles_.size() / 3;
+}
+auto Delaunay::GetTriangles() const -> const std::vector<uint32_t>& {
+  return triangles_;
+}
+auto Delaunay::GetHalfEdges() const -> const std::vector<uint32_t>& {
+  return half_edges_;
+}
+auto Delaunay::GetHull() const -> const std::vector<uint32_t>& {
+  return hull_;
+}
+
+auto Delaunay::Triangulate() -> void {
+  const auto kCount{static_cast<uint32_t>(x_values_.size())};
+  if (kCount == 0) {
+    return;
+  }
+
+  const auto [kMinX, kMaxX] =
+      std::minmax_element(x_values_.begin(), x_values_.end());
+  const auto [kMinY, kMaxY] =
+      std::minmax_element(y_values_.begin(), y_values_.end());
+  const auto kBoxX{(*kMinX + *kMaxX) * 0.5};
+  const auto kBoxY{(*kMinY + *kMaxY) * 0.5};
+
+  // Seed: the point nearest the box center, its nearest neighbour, and the
+  // point forming the smallest circumcircle with both.
+  uint32_t seed_a{0};
+  auto best{kInfinity};
+  for (uint32_t i = 0; i < kCount; ++i) {
+    const auto kDistance{
+        CalculateSquaredDistance(x_values_[i], y_values_[i], kBoxX, kBoxY)};
+    if (kDistance < best) {
+      best = kDistance;
+      seed_a = i;
+    }
+  }
+  const auto kAx{x_values_[seed_a]};
+  const auto kAy{y_values_[seed_a]};
+  auto seed_b{kInvalid};
+  best = kInfinity;
+  for (uint32_t i = 0; i < kCount; ++i) {
+    const auto kDistance{
+        CalculateSquaredDistance(x_values_[i], y_values_[i], kAx, kAy)};
+    if (kDistance > 0.0 && kDistance < best) {
+      best = kDistance;
+      seed_b = i;
+    }
+  }
+  if (seed_b == kInvalid) {
+    hull_.push_back(seed_a);
+    return;
+  }
+  auto seed_c{kInvalid};
+  best = kInfinity;
+  for (uint32_t i = 0; i < kCount; ++i) {
+    const auto [kOffsetX, kOffsetY] = CalculateCircumcenterOffset(
+        kAx, kAy, x_values_[seed_b], y_values_[seed_b], x_values_[i],
+        y_values_[i]);
+    const auto kRadius{kOffsetX * kOffsetX + kOffsetY * kOffsetY};
+    if (kRadius < best) {
+      best = kRadius;
+      seed_c = i;
+    }
+  }
+
+  const auto kOrientation{
+      (seed_c == kInvalid)
+          ? 0.0
+          : Orient2D(kAx, kAy, x_values_[seed_b], y_values_[seed_b],
+                     x_values_[seed_c], y_values_[seed_c])};
+  if (kOrientation == 0.0) {
+    // Collinear: no triangle, the hull runs along the line once.
+    hull_.resize(kCount);
+    std::iota(hull_.begin(), hull_.end(), 0U);
+    std::sort(hull_.begin(), hull_.end(), [&](uint32_t lhs, uint32_t rhs) {
+      return std::make_pair(x_values_[lhs], y_values_[lhs]) <
+             std::make_pair(x_values_[rhs], y_values_[rhs]);
+    });
+    hull_.erase(std::unique(hull_.begin(), hull_.end(),
+                            [&](uint32_t lhs, uint32_t rhs) {
+                              return x_values_[lhs] == x_values_[rhs] &&
+                                     y_values_[lhs] == y_values_[rhs];
+                            }),
+                hull_.end());
+    return;
+  }
+  if (kOrientation < 0.0) {
+    std::swap(seed_b, seed_c);
+  }
+  const auto [kCenterX, kCenterY] = CalculateCircumcenterOffset(
+      kAx, kAy, x_values_[seed_b], y_values_[seed_b], x_values_[seed_c],
+      y_values_[seed_c]);
+  center_x_ = kAx + kCenterX;
+  center_y_ = kAy + kCenterY;
+
+  // Every point is outside the hull of the points before it in this order.
+  std::vector<std::pair<double, uint32_t>> order(kCount);
+  for (uint32_t i = 0; i < kCount; ++i) {
+    order[i] = {CalculateSquaredDistance(x_values_[i], y_values_[i],
+                                         center_x_, center_y_),
+                i};
+  }
+  std::sort(order.begin(), order.end());
+
+  // Sweep over coordinates permuted into that order, so the points around
+  // the advancing front are also close in memory; indices are mapped back
+  // once the mesh is complete.
+  std::vector<uint32_t> original(kCount);
+  std::vector<uint32_t> rank(kCount);
+  std::vector<double> sorted_x(kCount);
+  std::vector<double> sorted_y(kCount);
+  for (uint32_t i = 0; i < kCount; ++i) {
+    original[i] = order[i].second;
+    rank[order[i].second] = i;
+    sorted_x[i] = x_values_[order[i].second];
+    sorted_y[i] = y_values_[order[i].second];
+  }
+  order = {};
+  x_values_.swap(sorted_x);
+  y_values_.swap(sorted_y);
+  seed_a = rank[seed_a];
+  seed_b = rank[seed_b];
+  seed_c = rank[seed_c];
+  rank = {};
+
+  const auto kHashSize{static_cast<std::size_t>(
+      std::ceil(std::sqrt(static_cast<double>(kCount))))};
+  hull_next_.assign(kCount, kInvalid);
+  hull_previous_.assign(kCount, kInvalid);
+  hull_edges_.assign(kCount, kInvalid);
+  hull_hash_.assign(kHashSize, kInvalid);
+  hull_start_ = seed_a;
+  hull_next_[seed_a] = hull_previous_[seed_c] = seed_b;
+  hull_next_[seed_b] = hull_previous_[seed_a] = seed_c;
+  hull_next_[seed_c] = hull_previous_[seed_b] = seed_a;
+  hull_edges_[seed_a] = 0;
+  hull_edges_[seed_b] = 1;
+  hull_edges_[seed_c] = 2;
+  for (const auto kSeed : {seed_a, seed_b, seed_c}) {
+    hull_hash_[GetHashKey(x_values_[kSeed], y_values_[kSeed])] = kSeed;
+  }
+
+  const auto kMaxTriangleCount{std::max<std::size_t>(2 * kCount, 5) - 5};
+  triangles_.reserve(kMaxTriangleCount * 3);
+  half_edges_.reserve(kMaxTriangleCount * 3);
+  AddTriangle(seed_a, seed_b, seed_c, kInvalid, kInvalid, kInvalid);
+
+  auto previous_x{std::numeric_limits<double>::quiet_NaN()};
+  auto previous_y{std::numeric_limits<double>::quiet_NaN()};
+  for (uint32_t point = 0; point < kCount; ++point) {
+    const auto kX{x_values_[point]};
+    const auto kY{y_values_[point]};
+    if (kX == previous_x && kY == previous_y) {
+      continue;
+    }
+    previous_x = kX;
+    previous_y = kY;
+    if (point == seed_a || point == seed_b || point == seed_c) {
+      continue;
+    }
+
+    // Start just before the live hull vertex nearest in angle.
+    auto start{hull_start_};
+    const auto kKey{GetHashKey(kX, kY)};
+    for (std::size_t j = 0; j < kHashSize; ++j) {
+      const auto kCandidate{hull_hash_[(kKey + j) % kHashSize]};
+      if (kCandidate != kInvalid && hull_next_[kCandidate] != kCandidate) {
+        start = kCandidate;
+        break;
+      }
+    }
+    start = hull_previous_[start];
+
+    // Find an edge the point sees, i.e. lies strictly right of.
+    auto edge{start};
+    while (true) {
+      const auto kNext{hull_next_[edge]};
+      if (Orient2D(x_values_[edge], y_values_[edge], x_values_[kNext],
+                   y_values_[kNext], kX, kY) < 0.0) {
+        break;
+      }
+      edge = kNext;
+      if (edge == start) {
+        edge = kInvalid;
+        break;
+      }
+    }
+    if (edge == kInvalid) {
+      // On the hull, i.e. a duplicate of an inserted point.
+      continue;
+    }
+
+    auto triangle{AddTriangle(edge, point, hull_next_[edge], kInvalid,
+                              kInvalid, hull_edges_[edge])};
+    hull_edges_[point] = Legalize(triangle + 2);
+    hull_edges_[edge] = triangle;
+
+    auto next{hull_next_[edge]};
+    while (true) {
+      const auto kFollowing{hull_next_[next]};
+      if (!(Orient2D(x_values_[next], y_values_[next], x_values_[kFollowing],
+                     y_values_[kFollowing], kX, kY) < 0.0)) {
+        break;
+      }
+      triangle = AddTriangle(next, point, kFollowing, hull_edges_[point],
+                             kInvalid, hull_edges_[next]);
+      hull_edges_[point] = Legalize(triangle + 2);
+      hull_next_[next] = next;
+      next = kFollowing;
+    }
+
+    if (edge == start) {
+      while (true) {
+        const auto kPrevious{hull_previous_[edge]};
+        if (!(Orient2D(x_values_[kPrevious], y_values_[kPrevious],
+                       x_values_[edge], y_values_[edge], kX, kY) < 0.0)) {
+          break;
+        }
+        triangle = AddTriangle(kPrevious, point, edge, kInvalid,
+                               hull_edges_[edge], hull_edges_[kPrevious]);
+        Legalize(triangle + 2);
+        hull_edges_[kPrevious] = triangle;
+        hull_next_[edge] = edge;
+        edge = kPrevious;
+      }
+    }
+
+    hull_start_ = hull_previous_[point] = edge;
+    hull_next_[edge] = hull_previous_[next] = point;
+    hull_next_[point] = next;
+    hull_hash_[GetHashKey(kX, kY)] = point;
+    hull_hash_[GetHashKey(x_values_[edge], y_values_[edge])] = edge;
+  }
+
+  auto vertex{hull_start_};
+  do {
+    hull_.push_back(original[vertex]);
+    vertex = hull_next_[vertex];
+  } while (vertex != hull_start_);
+
+  x_values_.swap(sorted_x);
+  y_values_.swap(sorted_y);
+  for (auto& point : triangles_) {
+    point = original[point];
+  }
+}
+
+auto Delaunay::AddTriangle(uint32_t first, uint32_t second, uint32_t third,
+                           uint32_t first_opposite, uint32_t second_opposite,
+                           uint32_t third_opposite) -> uint32_t {
+  const auto kTriangle{static_cast<uint32_t>(triangles_.size())};
+  triangles_.insert(triangles_.end(), {first, second, third});
+  half_edges_.insert(half_edges_.end(), {kInvalid, kInvalid, kInvalid});
+  Link(kTriangle, first_opposite);
+  Link(kTriangle + 1, second_opposite);
+  Link(kTriangle + 2, third_opposite);
+  return kTriangle;
+}
+
+auto Delaunay::Link(uint32_t edge, uint32_t opposite) -> void {
+  half_edges_[edge] = opposite;
+  if (opposite != kInvalid) {
+    half_edges_[opposite] = edge;
+  }
+}
+
+// Flips edges until the triangles around the newly inserted point are
+// Delaunay. With a = edge, its triangle is (p0, pr, pl) where p0 is the new
+// point, and the triangle across a is (pl, pr, p1). Returns the half-edge
+// leaving p0 of the last triangle checked, which is the new hull edge.
+auto Delaunay::Legalize(uint32_t edge) -> uint32_t {
+  edge_stack_.clear();
+  auto current{edge};
+  uint32_t result{0};
+  while (true) {
+    const auto kOpposite{half_edges_[current]};
+    result = PreviousHalfEdge(current);
+
+    if (kOpposite == kInvalid) {
+      if (edge_stack_.empty()) {
+        break;
+      }
+      current = edge_stack_.back();
+      edge_stack_.pop_back();
+      continue;
+    }
+
+    const auto kLeft{NextHalfEdge(current)};
+    const auto kOppositeLeft{PreviousHalfEdge(kOpposite)};
+    const auto kP0{triangles_[result]};
+    const auto kPr{triangles_[current]};
+    const auto kPl{triangles_[kLeft]};
+    const auto kP1{triangles_[kOppositeLeft]};
+
+    if (InCircle(x_values_[kP0], y_values_[kP0], x_values_[kPr],
+                 y_values_[kPr], x_values_[kPl], y_values_[kPl],
+                 x_values_[kP1], y_values_[kP1]) > 0.0) {
+      triangles_[current] = kP1;
+      triangles_[kOpposite] = kP0;
+
+      const auto kOuter{half_edges_[kOppositeLeft]};
+      if (kOuter == kInvalid) {
+        // The flipped edge was on the hull on the far side; repoint it.
+        auto vertex{hull_start_};
+        do {
+          if (hull_edges_[vertex] == kOppositeLeft) {
+            hull_edges_[vertex] = current;
+            break;
+          }
+          vertex = hull_previous_[vertex];
+        } while (vertex != hull_start_);
+      }
+      Link(current, kOuter);
+      Link(kOpposite, half_edges_[result]);
+      Link(result, kOppositeLeft);
+      edge_stack_.push_back(NextHalfEdge(kOpposite));
+    } else {
+      if (edge_stack_.empty()) {
+        break;
+      }
+      current = edge_stack_.back();
+      edge_stack_.pop_back();
+    }
+  }
+  return result;
+}
+
+auto Delaunay::GetHashKey(double input_x, double input_y) const
+    -> std::size_t {
+  const auto kSize{hull_hash_.size()};
+  const auto kKey{static_cast<std::size_t>(std::floor(
+      CalculatePseudoAngle(input_x - center_x_, input_y - center_y_) *
+      static_cast<double>(kSize)))};
+  return kKey % kSize;
+}
+}  // namespace zozibush::geometry
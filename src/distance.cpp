@@ -8,6 +8,8 @@
 #include <stdexcept>
 #include <tuple>
 
+#include "geometry/hash.hpp"
+
 namespace {
 constexpr int64_t kKilometerToNanometer{static_cast<int64_t>(1.0e+12)};
 constexpr int64_t kMeterToNanometer{static_cast<int64_t>(1.0e+9)};
@@ -60,6 +62,14 @@ auto Distance::GetValue(const Type &input_type) const -> double {
   return result;
 }
 
+auto Distance::GetNanometer() const -> int64_t { return nanometer_; }
+
+auto Distance::FromNanometer(int64_t nanometer) -> Distance {
+  Distance result;
+  result.nanometer_ = nanometer;
+  return result;
+}
+
 auto Distance::SetValue(double input_value, const Type &input_type) -> void {
   nanometer_ = ScaleDistanceToNanometer(input_value, input_type);
 }
@@ -127,4 +137,13 @@ auto Distance::operator/=(double scale) -> void {
 
   (*this).SetValue(static_cast<double>(nanometer_) / scale, Type::kNanometer);
 }
-}  // namespace zozibush::geometry
\ No newline at end of file
+}  // namespace zozibush::geometry
+
+namespace std {
+auto hash<zozibush::geometry::Distance>::operator()(
+    const zozibush::geometry::Distance &distance) const noexcept
+    -> std::size_t {
+  return static_cast<std::size_t>(zozibush::geometry::internal::MixHash(
+      static_cast<uint64_t>(distance.GetNanometer())));
+}
+}  // namespace std
@@ -0,0 +1,191 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/distance_array.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace {
+#if defined(_WIN32) || (defined(__BYTE_ORDER__) && \
+                        __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+constexpr bool kIsLittleEndian{true};
+#else
+constexpr bool kIsLittleEndian{false};
+#endif
+
+constexpr std::size_t kNanometerBytes{sizeof(int64_t)};
+constexpr std::size_t kBlockSize{256};
+
+// Indexed by Distance::Type. Every factor is an exact power of ten, so
+// dividing by it rounds correctly and multiplying by it is exact until the
+// result leaves the 53-bit mantissa.
+constexpr std::array<double, 6> kNanometerScales{1.0e+12, 1.0e+9, 1.0e+7,
+                                                 1.0e+6,  1.0e+3, 1.0};
+
+// 2^63 is exactly representable, so [-2^63, 2^63) is the int64_t range.
+constexpr double kInt64Limit{9223372036854775808.0};
+
+// Adding 1.5 * 2^52 to a value under 2^51 in magnitude rounds it to an
+// integer, half to even like nearbyint, and leaves that integer in the low
+// mantissa bits: subtracting the constant's bit pattern yields the int64_t.
+// The subtraction is unsigned, so out-of-range values, redone below, wrap
+// instead of overflowing.
+constexpr double kRoundingMagic{6755399441055744.0};
+constexpr uint64_t kRoundingMagicBits{0x4338000000000000};
+constexpr double kRoundingLimit{2251799813685248.0};  // 2^51
+// Added to the magnitude bits of a double, sets the top bit exactly when the
+// value is at least kRoundingLimit, infinity or nan: a flag computed with
+// integer adds, which SSE2 vectorizes where 64-bit compares do not.
+constexpr uint64_t kMagnitudeMask{0x7FFFFFFFFFFFFFFF};
+constexpr uint64_t kRoundingLimitOffset{0x8000000000000000 -
+                                        0x4320000000000000};
+constexpr uint64_t kSignBit{0x8000000000000000};
+
+auto GetNanometerScale(zozibush::geometry::Distance::Type type) -> double {
+  const auto kIndex{static_cast<std::size_t>(type)};
+  if (kIndex >= kNanometerScales.size()) {
+    throw std::invalid_argument("unknown distance type");
+  }
+  return kNanometerScales[kIndex];
+}
+
+auto ByteSwap(uint64_t value) -> uint64_t {
+  uint64_t result{0};
+  for (std::size_t i = 0; i < kNanometerBytes; ++i) {
+    result = (result << 8U) | (value & 0xFFU);
+    value >>= 8U;
+  }
+  return result;
+}
+}  // namespace
+
+namespace zozibush::geometry {
+static_assert(std::is_trivially_copyable_v<Distance> &&
+                  sizeof(Distance) == sizeof(int64_t),
+              "Distance must be a bare int64_t nanometer value");
+
+auto ConvertToNanometers(const double* values, std::size_t count,
+                         Distance::Type input_type, int64_t* nanometers)
+    -> void {
+  const auto kScale{GetNanometerScale(input_type)};
+
+  // Plain adds, bit copies and masks, so the common case vectorizes even
+  // without SSE4.1 rounding or 64-bit conversion instructions. The magic
+  // constant relies on strict float semantics, i.e. no -ffast-math.
+  uint64_t large{0};
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto kScaled{values[i] * kScale};
+    const auto kShifted{kScaled + kRoundingMagic};
+    uint64_t scaled_bits{0};
+    std::memcpy(&scaled_bits, &kScaled, sizeof(scaled_bits));
+    uint64_t shifted_bits{0};
+    std::memcpy(&shifted_bits, &kShifted, sizeof(shifted_bits));
+    nanometers[i] = static_cast<int64_t>(shifted_bits - kRoundingMagicBits);
+    large |= (scaled_bits & kMagnitudeMask) + kRoundingLimitOffset;
+  }
+  if ((large & kSignBit) == 0) {
+    return;
+  }
+
+  // Redo the values beyond 2^51 nanometers, nan and infinities included.
+  bool in_range{true};
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto kScaled{values[i] * kScale};
+    if (std::fabs(kScaled) < kRoundingLimit) {
+      continue;
+    }
+    const auto kRounded{std::nearbyint(kScaled)};
+    const bool kValid{kRounded >= -kInt64Limit && kRounded < kInt64Limit};
+    nanometers[i] = static_cast<int64_t>(kValid ? kRounded : 0.0);
+    in_range = in_range && kValid;
+  }
+
+  if (!in_range) {
+    throw std::out_of_range("value is nan or out of nanometer range");
+  }
+}
+
+auto ConvertFromNanometers(const int64_t* nanometers, std::size_t count,
+                           Distance::Type output_type, double* values)
+    -> void {
+  const auto kScale{GetNanometerScale(output_type)};
+  for (std::size_t i = 0; i < count; ++i) {
+    values[i] = static_cast<double>(nanometers[i]) / kScale;
+  }
+}
+
+auto ConvertToDistances(const double* values, std::size_t count,
+                        Distance::Type input_type, Distance* distances)
+    -> void {
+  // Distance is layout compatible with int64_t (see the static_assert above),
+  // so convert through a small stack block and copy it over in one go.
+  std::array<int64_t, kBlockSize> block{};
+  for (std::size_t offset = 0; offset < count; offset += kBlockSize) {
+    const auto kLength{std::min(kBlockSize, count - offset)};
+    ConvertToNanometers(values + offset, kLength, input_type, block.data());
+    std::memcpy(static_cast<void*>(distances + offset), block.data(),
+                kLength * kNanometerBytes);
+  }
+}
+
+auto ConvertFromDistances(const Distance* distances, std::size_t count,
+                          Distance::Type output_type, double* values) -> void {
+  std::array<int64_t, kBlockSize> block{};
+  for (std::size_t offset = 0; offset < count; offset += kBlockSize) {
+    const auto kLength{std::min(kBlockSize, count - offset)};
+    std::memcpy(block.data(), static_cast<const void*>(distances + offset),
+                kLength * kNanometerBytes);
+    ConvertFromNanometers(block.data(), kLength, output_type, values + offset);
+  }
+}
+
+auto DumpDistances(const std::vector<Distance>& distances)
+    -> std::vector<uint8_t> {
+  std::vector<uint8_t> result(distances.size() * kNanometerBytes);
+  if (distances.empty()) {
+    return result;
+  }
+
+  if constexpr (kIsLittleEndian) {
+    std::memcpy(result.data(), distances.data(), result.size());
+  } else {
+    for (std::size_t i = 0; i < distances.size(); ++i) {
+      const auto kSwapped{
+          ByteSwap(static_cast<uint64_t>(distances[i].GetNanometer()))};
+      std::memcpy(result.data() + i * kNanometerBytes, &kSwapped,
+                  kNanometerBytes);
+    }
+  }
+  return result;
+}
+
+auto LoadDistances(const uint8_t* bytes, std::size_t size)
+    -> std::vector<Distance> {
+  if (size % kNanometerBytes != 0) {
+    throw std::invalid_argument("size is not a multiple of 8 bytes");
+  }
+
+  std::vector<Distance> result(size / kNanometerBytes);
+  if (result.empty()) {
+    return result;
+  }
+
+  if constexpr (kIsLittleEndian) {
+    std::memcpy(static_cast<void*>(result.data()), bytes, size);
+  } else {
+    for (std::size_t i = 0; i < result.size(); ++i) {
+      uint64_t value{0};
+      std::memcpy(&value, bytes + i * kNanometerBytes, kNanometerBytes);
+      result[i] = Distance::FromNanometer(static_cast<int64_t>(ByteSwap(value)));
+    }
+  }
+  return result;
+}
+}  // namespace zozibush::geometry
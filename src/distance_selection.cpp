@@ -0,0 +1,192 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/distance_selection.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <utility>
+
+#include "geometry/parallel.hpp"
+#include "geometry/tuning.hpp"
+
+namespace {
+constexpr std::size_t kDigitBits{11};
+constexpr std::size_t kBuckets{std::size_t{1} << kDigitBits};
+constexpr uint64_t kDigitMask{kBuckets - 1};
+constexpr std::size_t kPasses{(64 + kDigitBits - 1) / kDigitBits};
+// Selecting more than 1/kSortShare of the input is done by a full sort.
+constexpr std::size_t kSortShare{8};
+constexpr uint64_t kSignBit{uint64_t{1} << 63U};
+
+// (key, index), so ties go to the lower index.
+using Candidate = std::pair<uint64_t, std::size_t>;
+
+// Non-negative doubles order like their bit patterns; nan ranks last.
+auto ToKey(double squared_distance) -> uint64_t {
+  uint64_t key{0};
+  std::memcpy(&key, &squared_distance, sizeof(key));
+  return key;
+}
+
+auto ToKey(int64_t nanometer) -> uint64_t {
+  return static_cast<uint64_t>(nanometer) ^ kSignBit;
+}
+
+// Stable LSD radix sort of the indices by key.
+template <typename Key>
+auto SortByKeys(std::size_t count, const Key& key, std::size_t thread_count)
+    -> std::vector<std::size_t> {
+  std::vector<uint64_t> keys(count);
+  zozibush::geometry::ParallelFor(
+      count, zozibush::geometry::GetTuningParameters().selection_grain,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          keys[i] = key(i);
+        }
+      },
+      thread_count);
+  std::vector<std::size_t> indices(count);
+  std::iota(indices.begin(), indices.end(), std::size_t{0});
+  if (count < 2) {
+    return indices;
+  }
+
+  // All digit histograms in one read of the keys.
+  std::vector<std::array<std::size_t, kBuckets>> histograms(kPasses);
+  for (const auto kKey : keys) {
+    for (std::size_t pass = 0; pass < kPasses; ++pass) {
+      ++histograms[pass][(kKey >> (pass * kDigitBits)) & kDigitMask];
+    }
+  }
+  std::vector<uint64_t> key_buffer(count);
+  std::vector<std::size_t> index_buffer(count);
+  for (std::size_t pass = 0; pass < kPasses; ++pass) {
+    const auto kShift{pass * kDigitBits};
+    auto& histogram{histograms[pass]};
+    // Every key has this digit, e.g. the exponent of similar distances.
+    if (histogram[(keys[0] >> kShift) & kDigitMask] == count) {
+      continue;
+    }
+    std::size_t offset{0};
+    for (auto& bucket : histogram) {
+      const auto kSize{bucket};
+      bucket = offset;
+      offset += kSize;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+      const auto kTarget{histogram[(keys[i] >> kShift) & kDigitMask]++};
+      key_buffer[kTarget] = keys[i];
+      index_buffer[kTarget] = indices[i];
+    }
+    keys.swap(key_buffer);
+    indices.swap(index_buffer);
+  }
+  return indices;
+}
+
+template <typename Key>
+auto SelectByKeys(std::size_t count, std::size_t k, const Key& key,
+                  std::size_t thread_count) -> std::vector<std::size_t> {
+  k = std::min(k, count);
+  if (k == 0) {
+    return {};
+  }
+  if (k * kSortShare >= count) {
+    auto sorted{SortByKeys(count, key, thread_count)};
+    sorted.resize(k);
+    return sorted;
+  }
+
+  // Fixed ranges, one bounded max-heap of the k best each.
+  const auto kThreads{(thread_count == 0)
+                          ? zozibush::geometry::GetDefaultThreadCount()
+                          : thread_count};
+  const auto kPointGrain{
+      zozibush::geometry::GetTuningParameters().selection_grain};
+  const auto kRanges{std::clamp((count + kPointGrain - 1) / kPointGrain,
+                                std::size_t{1}, kThreads)};
+  std::vector<std::vector<Candidate>> heaps(kRanges);
+  zozibush::geometry::ParallelFor(
+      kRanges, 1,
+      [&](std::size_t first, std::size_t last) {
+        for (auto range = first; range < last; ++range) {
+          auto& heap{heaps[range]};
+          heap.reserve(k);
+          const auto kEnd{count * (range + 1) / kRanges};
+          for (auto i = count * range / kRanges; i < kEnd; ++i) {
+            const Candidate kCandidate{key(i), i};
+            if (heap.size() < k) {
+              heap.push_back(kCandidate);
+              std::push_heap(heap.begin(), heap.end());
+            } else if (kCandidate < heap.front()) {
+              std::pop_heap(heap.begin(), heap.end());
+              heap.back() = kCandidate;
+              std::push_heap(heap.begin(), heap.end());
+            }
+          }
+        }
+      },
+      thread_count);
+
+  std::vector<Candidate> candidates;
+  candidates.reserve(kRanges * k);
+  for (const auto& kHeap : heaps) {
+    candidates.insert(candidates.end(), kHeap.begin(), kHeap.end());
+  }
+  std::partial_sort(candidates.begin(),
+                    candidates.begin() + static_cast<std::ptrdiff_t>(k),
+                    candidates.end());
+  std::vector<std::size_t> result(k);
+  for (std::size_t i = 0; i < k; ++i) {
+    result[i] = candidates[i].second;
+  }
+  return result;
+}
+
+auto GetSquaredDistanceKey(const zozibush::geometry::PointCloud<2, double>&
+                               cloud,
+                           const zozibush::geometry::Point2D& query) {
+  return [x_values = cloud.Data(0), y_values = cloud.Data(1),
+          query_x = query.GetX(), query_y = query.GetY()](std::size_t index) {
+    const auto kDx{x_values[index] - query_x};
+    const auto kDy{y_values[index] - query_y};
+    return ToKey(kDx * kDx + kDy * kDy);
+  };
+}
+
+auto GetNanometerKey(const zozibush::geometry::Distance* distances) {
+  return [distances](std::size_t index) {
+    return ToKey(distances[index].GetNanometer());
+  };
+}
+}  // namespace
+
+namespace zozibush::geometry {
+auto SelectNearest(const PointCloud<2, double>& cloud, const Point2D& query,
+                   std::size_t k, std::size_t thread_count)
+    -> std::vector<std::size_t> {
+  return SelectByKeys(cloud.Size(), k, GetSquaredDistanceKey(cloud, query),
+                      thread_count);
+}
+
+auto SortByDistance(const PointCloud<2, double>& cloud, const Point2D& query,
+                    std::size_t thread_count) -> std::vector<std::size_t> {
+  return SortByKeys(cloud.Size(), GetSquaredDistanceKey(cloud, query),
+                    thread_count);
+}
+
+auto SelectSmallest(const Distance* distances, std::size_t count,
+                    std::size_t k, std::size_t thread_count)
+    -> std::vector<std::size_t> {
+  return SelectByKeys(count, k, GetNanometerKey(distances), thread_count);
+}
+
+auto SortByDistance(const Distance* distances, std::size_t count,
+                    std::size_t thread_count) -> std::vector<std::size_t> {
+  return SortByKeys(count, GetNanometerKey(distances), thread_count);
+}
+}  // namespace zozibush::geometry
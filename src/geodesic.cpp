@@ -0,0 +1,483 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/geodesic.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include "geometry/distance_array.hpp"
+
+namespace {
+constexpr double kPi{3.14159265358979323846};
+constexpr double kDegreeToRadian{kPi / 180.0};
+constexpr double kTwoOverPi{2.0 / kPi};
+constexpr double kInverseTwoPi{0.5 / kPi};
+constexpr double kTwoPi{kPi * 2.0};
+// pi / 2 split for Cody-Waite reduction; the high part has trailing zero bits
+// so k * kHalfPiHigh is exact for the quadrant counts seen here.
+constexpr double kHalfPiHigh{1.57079632673412561417e+00};
+constexpr double kHalfPiLow{6.07710050650619224932e-11};
+// Adding and subtracting 1.5 * 2^52 rounds to nearest integer without a call.
+constexpr double kRoundMagic{6755399441055744.0};
+// First guess of 1 / sqrt(x) from the bits of x, within 3.5% of the root.
+constexpr uint64_t kInverseSqrtMagic{0x5FE6EB50C7B537A9};
+constexpr uint64_t kSignBit{uint64_t{1} << 63U};
+
+constexpr double kEarthRadius{zozibush::geometry::Geodesic::kEarthRadius};
+constexpr double kEllipsoidA{6378137.0};
+constexpr double kEllipsoidF{1.0 / 298.257223563};
+constexpr double kEllipsoidB{(1.0 - kEllipsoidF) * kEllipsoidA};
+constexpr int32_t kVincentyMaxIteration{200};
+constexpr double kVincentyEpsilon{1.0e-12};
+
+constexpr std::size_t kBlockSize{256};
+
+auto RoundToNearest(double value) -> double {
+  return (value + kRoundMagic) - kRoundMagic;
+}
+
+auto ToBits(double value) -> uint64_t {
+  uint64_t bits{0};
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+auto FromBits(uint64_t bits) -> double {
+  double value{0.0};
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// Square root by three Newton steps on 1 / sqrt and one on sqrt itself, so
+// that the loops using it vectorize without the errno check of std::sqrt.
+// Normal inputs are within a few ulp; subnormal ones give far less than a
+// nanometer, and inf gives nan, which the nanometer conversion rejects alike.
+inline auto FastSqrt(double value) -> double {
+  auto inverse{FromBits(kInverseSqrtMagic - (ToBits(value) >> 1U))};
+  inverse *= 1.5 - 0.5 * value * inverse * inverse;
+  inverse *= 1.5 - 0.5 * value * inverse * inverse;
+  inverse *= 1.5 - 0.5 * value * inverse * inverse;
+  const auto kRoot{value * inverse};
+  return kRoot + 0.5 * inverse * (value - kRoot * kRoot);
+}
+
+// sin and cos on [-pi/4, pi/4] by Taylor polynomials after quadrant
+// reduction. The truncation error is below 2e-14 on the reduced range, and
+// the reduction keeps |x| < 1e5 accurate to a few ulp, which covers any
+// angle in radians produced from degrees here. The quadrant picks and signs
+// the results with bit masks rather than branches.
+inline auto FastSinCos(double value, double& sine, double& cosine)
+    -> void {
+  const auto kShifted{value * kTwoOverPi + kRoundMagic};
+  const auto kQuadrant{kShifted - kRoundMagic};
+  const auto kReduced{(value - kQuadrant * kHalfPiHigh) -
+                      kQuadrant * kHalfPiLow};
+  const auto kSquare{kReduced * kReduced};
+
+  const auto kSine{
+      kReduced +
+      kReduced * kSquare *
+          (-1.0 / 6.0 +
+           kSquare *
+               (1.0 / 120.0 +
+                kSquare *
+                    (-1.0 / 5040.0 +
+                     kSquare * (1.0 / 362880.0 +
+                                kSquare * (-1.0 / 39916800.0 +
+                                           kSquare / 6227020800.0)))))};
+  const auto kCosine{
+      1.0 +
+      kSquare *
+          (-0.5 +
+           kSquare *
+               (1.0 / 24.0 +
+                kSquare *
+                    (-1.0 / 720.0 +
+                     kSquare *
+                         (1.0 / 40320.0 +
+                          kSquare * (-1.0 / 3628800.0 +
+                                     kSquare * (1.0 / 479001600.0 -
+                                                kSquare / 87178291200.0))))))};
+
+  // The low mantissa bits of kShifted are the quadrant modulo 4.
+  const auto kIndex{ToBits(kShifted)};
+  const auto kSwapMask{uint64_t{0} - (kIndex & 1U)};
+  const auto kSineBits{ToBits(kSine)};
+  const auto kCosineBits{ToBits(kCosine)};
+  sine = FromBits(((kCosineBits & kSwapMask) | (kSineBits & ~kSwapMask)) ^
+                  ((kIndex & 2U) != 0U ? kSignBit : 0U));
+  cosine = FromBits(((kSineBits & kSwapMask) | (kCosineBits & ~kSwapMask)) ^
+                    (((kIndex + 1U) & 2U) != 0U ? kSignBit : 0U));
+}
+
+inline auto FastCos(double value) -> double {
+  double sine{0.0};
+  double cosine{0.0};
+  FastSinCos(value, sine, cosine);
+  return cosine;
+}
+
+// atan2 for y and x in [0, 1] only. Halving the angle twice, by
+// atan2(y, x) = 2 * atan(y / (x + hypot(y, x))) and
+// atan(t) = 2 * atan(t / (1 + sqrt(1 + t * t))), brings it to
+// [0, tan(pi / 8)], where the alternating series up to t^27 is off by less
+// than 1e-12 radian. Neither step needs a branch; denorm_min only keeps
+// y = x = 0 from dividing 0 by 0. A nan input stays nan so that the caller
+// can reject it.
+inline auto FastAtan2Positive(double input_y, double input_x) -> double {
+  const auto kHalf{
+      input_y / (input_x + FastSqrt(input_x * input_x + input_y * input_y) +
+                 std::numeric_limits<double>::denorm_min())};
+  const auto kValue{kHalf / (1.0 + FastSqrt(1.0 + kHalf * kHalf))};
+  const auto kSquare{kValue * kValue};
+
+  // Horner steps written out, from the t^27 term down to the t^3 term.
+  auto series{1.0 / 25.0 - kSquare / 27.0};
+  series = -1.0 / 23.0 + kSquare * series;
+  series = 1.0 / 21.0 + kSquare * series;
+  series = -1.0 / 19.0 + kSquare * series;
+  series = 1.0 / 17.0 + kSquare * series;
+  series = -1.0 / 15.0 + kSquare * series;
+  series = 1.0 / 13.0 + kSquare * series;
+  series = -1.0 / 11.0 + kSquare * series;
+  series = 1.0 / 9.0 + kSquare * series;
+  series = -1.0 / 7.0 + kSquare * series;
+  series = 1.0 / 5.0 + kSquare * series;
+  series = -1.0 / 3.0 + kSquare * series;
+  return 4.0 * (kValue + kValue * kSquare * series);
+}
+
+auto WrapLongitude(double radian) -> double {
+  return radian - kTwoPi * RoundToNearest(radian * kInverseTwoPi);
+}
+
+auto HaversineMeters(double lhs_longitude, double lhs_latitude,
+                     double rhs_longitude, double rhs_latitude) -> double {
+  const auto kLhsLatitude{lhs_latitude * kDegreeToRadian};
+  const auto kRhsLatitude{rhs_latitude * kDegreeToRadian};
+  const auto kHalfDeltaLatitude{(kRhsLatitude - kLhsLatitude) * 0.5};
+  const auto kHalfDeltaLongitude{(rhs_longitude - lhs_longitude) *
+                                 kDegreeToRadian * 0.5};
+  const auto kSineLatitude{std::sin(kHalfDeltaLatitude)};
+  const auto kSineLongitude{std::sin(kHalfDeltaLongitude)};
+  const auto kHaversine{std::clamp(
+      kSineLatitude * kSineLatitude + std::cos(kLhsLatitude) *
+                                          std::cos(kRhsLatitude) *
+                                          kSineLongitude * kSineLongitude,
+      0.0, 1.0)};
+  return 2.0 * kEarthRadius *
+         std::atan2(std::sqrt(kHaversine), std::sqrt(1.0 - kHaversine));
+}
+
+inline auto FastHaversineMeters(double lhs_longitude,
+                                double lhs_cos_latitude, double lhs_latitude,
+                                double rhs_longitude, double rhs_latitude)
+    -> double {
+  double sine_latitude{0.0};
+  double sine_longitude{0.0};
+  double rhs_sin_latitude{0.0};
+  double rhs_cos_latitude{0.0};
+  double unused{0.0};
+  const auto kRhsLatitude{rhs_latitude * kDegreeToRadian};
+  FastSinCos(kRhsLatitude, rhs_sin_latitude, rhs_cos_latitude);
+  FastSinCos((kRhsLatitude - lhs_latitude * kDegreeToRadian) * 0.5,
+             sine_latitude, unused);
+  FastSinCos((rhs_longitude - lhs_longitude) * kDegreeToRadian * 0.5,
+             sine_longitude, unused);
+  const auto kHaversine{sine_latitude * sine_latitude +
+                        lhs_cos_latitude * rhs_cos_latitude * sine_longitude *
+                            sine_longitude};
+  // Rounding can push kHaversine just outside [0, 1]. The roots clamp at
+  // kZero = 0 * kHaversine, a signed zero or nan: a literal 0 would let the
+  // compiler specialize the code after each clamp into branches.
+  const auto kZero{0.0 * kHaversine};
+  return 2.0 * kEarthRadius *
+         FastAtan2Positive(FastSqrt(std::max(kHaversine, kZero)),
+                           FastSqrt(std::max(1.0 - kHaversine, kZero)));
+}
+
+inline auto EquirectangularMeters(double lhs_longitude, double lhs_latitude,
+                                  double rhs_longitude, double rhs_latitude)
+    -> double {
+  const auto kDeltaLongitude{
+      WrapLongitude((rhs_longitude - lhs_longitude) * kDegreeToRadian)};
+  const auto kDeltaLatitude{(rhs_latitude - lhs_latitude) * kDegreeToRadian};
+  const auto kMeanLatitude{(rhs_latitude + lhs_latitude) * 0.5 *
+                           kDegreeToRadian};
+  const auto kX{kDeltaLongitude * FastCos(kMeanLatitude)};
+  return kEarthRadius * FastSqrt(kX * kX + kDeltaLatitude * kDeltaLatitude);
+}
+
+// Returns false, with meters left at 0, if the iteration does not converge.
+// Non-finite coordinates give nan meters without iterating.
+auto VincentyMeters(double lhs_longitude, double lhs_latitude,
+                    double rhs_longitude, double rhs_latitude, double& meters)
+    -> bool {
+  meters = 0.0;
+  if (!std::isfinite(lhs_longitude) || !std::isfinite(lhs_latitude) ||
+      !std::isfinite(rhs_longitude) || !std::isfinite(rhs_latitude)) {
+    meters = std::numeric_limits<double>::quiet_NaN();
+    return true;
+  }
+  const auto kL{(rhs_longitude - lhs_longitude) * kDegreeToRadian};
+  const auto kU1{std::atan((1.0 - kEllipsoidF) *
+                           std::tan(lhs_latitude * kDegreeToRadian))};
+  const auto kU2{std::atan((1.0 - kEllipsoidF) *
+                           std::tan(rhs_latitude * kDegreeToRadian))};
+  const auto kSinU1{std::sin(kU1)};
+  const auto kCosU1{std::cos(kU1)};
+  const auto kSinU2{std::sin(kU2)};
+  const auto kCosU2{std::cos(kU2)};
+
+  auto lambda{kL};
+  double sin_sigma{0.0};
+  double cos_sigma{0.0};
+  double sigma{0.0};
+  double cos_square_alpha{0.0};
+  double cos_2_sigma_m{0.0};
+  for (int32_t iteration = 0;; ++iteration) {
+    if (iteration == kVincentyMaxIteration) {
+      return false;
+    }
+    const auto kSinLambda{std::sin(lambda)};
+    const auto kCosLambda{std::cos(lambda)};
+    const auto kCrossA{kCosU2 * kSinLambda};
+    const auto kCrossB{kCosU1 * kSinU2 - kSinU1 * kCosU2 * kCosLambda};
+    sin_sigma = std::sqrt(kCrossA * kCrossA + kCrossB * kCrossB);
+    if (sin_sigma == 0.0) {
+      return true;
+    }
+    cos_sigma = kSinU1 * kSinU2 + kCosU1 * kCosU2 * kCosLambda;
+    sigma = std::atan2(sin_sigma, cos_sigma);
+    const auto kSinAlpha{kCosU1 * kCosU2 * kSinLambda / sin_sigma};
+    cos_square_alpha = 1.0 - kSinAlpha * kSinAlpha;
+    cos_2_sigma_m = (cos_square_alpha != 0.0)
+                        ? cos_sigma - 2.0 * kSinU1 * kSinU2 / cos_square_alpha
+                        : 0.0;
+    const auto kC{kEllipsoidF / 16.0 * cos_square_alpha *
+                  (4.0 + kEllipsoidF * (4.0 - 3.0 * cos_square_alpha))};
+    const auto kPreviousLambda{lambda};
+    lambda = kL + (1.0 - kC) * kEllipsoidF * kSinAlpha *
+                      (sigma + kC * sin_sigma *
+                                   (cos_2_sigma_m +
+                                    kC * cos_sigma *
+                                        (-1.0 + 2.0 * cos_2_sigma_m *
+                                                    cos_2_sigma_m)));
+    if (std::abs(lambda - kPreviousLambda) < kVincentyEpsilon) {
+      break;
+    }
+  }
+
+  const auto kUSquare{cos_square_alpha *
+                      (kEllipsoidA * kEllipsoidA - kEllipsoidB * kEllipsoidB) /
+                      (kEllipsoidB * kEllipsoidB)};
+  const auto kA{1.0 +
+                kUSquare / 16384.0 *
+                    (4096.0 +
+                     kUSquare *
+                         (-768.0 + kUSquare * (320.0 - 175.0 * kUSquare)))};
+  const auto kB{kUSquare / 1024.0 *
+                (256.0 +
+                 kUSquare * (-128.0 + kUSquare * (74.0 - 47.0 * kUSquare)))};
+  const auto kCos2SigmaMSquare{cos_2_sigma_m * cos_2_sigma_m};
+  const auto kDeltaSigma{
+      kB * sin_sigma *
+      (cos_2_sigma_m +
+       kB / 4.0 *
+           (cos_sigma * (-1.0 + 2.0 * kCos2SigmaMSquare) -
+            kB / 6.0 * cos_2_sigma_m * (-3.0 + 4.0 * sin_sigma * sin_sigma) *
+                (-3.0 + 4.0 * kCos2SigmaMSquare)))};
+  meters = kEllipsoidB * kA * (sigma - kDeltaSigma);
+  return true;
+}
+
+// Fills meters[i] with meter(lhs, rhs[i]); lhs is the i-th lhs point for a
+// stride of 1 and the first one for a stride of 0. The two cases are separate
+// loops, so that neither indexes lhs through a runtime stride. The fast
+// kernels are declared inline so that both loops vectorize with them.
+template <typename Function>
+auto FillMeters(const double* lhs_longitudes, const double* lhs_latitudes,
+                std::size_t lhs_stride, const double* rhs_longitudes,
+                const double* rhs_latitudes, std::size_t count,
+                const Function& meter, double* meters) -> void {
+  if (lhs_stride == 0U) {
+    const auto kLhsLongitude{lhs_longitudes[0]};
+    const auto kLhsLatitude{lhs_latitudes[0]};
+    for (std::size_t i = 0; i < count; ++i) {
+      meters[i] = meter(kLhsLongitude, kLhsLatitude, rhs_longitudes[i],
+                        rhs_latitudes[i]);
+    }
+    return;
+  }
+  for (std::size_t i = 0; i < count; ++i) {
+    meters[i] = meter(lhs_longitudes[i], lhs_latitudes[i], rhs_longitudes[i],
+                      rhs_latitudes[i]);
+  }
+}
+
+// Fills meters[0, count) for pairs (lhs[i], rhs[i]); a stride of 0 repeats
+// the first lhs point for the one-to-many case. Returns false if Vincenty
+// did not converge for a pair, whose meters are then 0.
+auto CalculateMeters(const double* lhs_longitudes, const double* lhs_latitudes,
+                     std::size_t lhs_stride, const double* rhs_longitudes,
+                     const double* rhs_latitudes, std::size_t count,
+                     zozibush::geometry::Geodesic::Method method,
+                     double* meters) -> bool {
+  bool converged{true};
+  using Method = zozibush::geometry::Geodesic::Method;
+  switch (method) {
+    case Method::kEquirectangular:
+      FillMeters(lhs_longitudes, lhs_latitudes, lhs_stride, rhs_longitudes,
+                 rhs_latitudes, count, EquirectangularMeters, meters);
+      break;
+    case Method::kFastHaversine:
+      FillMeters(lhs_longitudes, lhs_latitudes, lhs_stride, rhs_longitudes,
+                 rhs_latitudes, count,
+                 [](double lhs_longitude, double lhs_latitude,
+                    double rhs_longitude, double rhs_latitude) {
+                   return FastHaversineMeters(
+                       lhs_longitude, FastCos(lhs_latitude * kDegreeToRadian),
+                       lhs_latitude, rhs_longitude, rhs_latitude);
+                 },
+                 meters);
+      break;
+    case Method::kHaversine:
+      FillMeters(lhs_longitudes, lhs_latitudes, lhs_stride, rhs_longitudes,
+                 rhs_latitudes, count, HaversineMeters, meters);
+      break;
+    case Method::kVincenty:
+      for (std::size_t i = 0; i < count; ++i) {
+        converged =
+            VincentyMeters(lhs_longitudes[i * lhs_stride],
+                           lhs_latitudes[i * lhs_stride], rhs_longitudes[i],
+                           rhs_latitudes[i], meters[i]) &&
+            converged;
+      }
+      break;
+    default:
+      throw std::invalid_argument("unknown geodesic method");
+  }
+  return converged;
+}
+
+// Converts a block like ConvertToDistances, but writes the whole block even
+// when it throws; nan and out of range meters become 0. Returns false then.
+auto StoreMeters(const double* meters, std::size_t count,
+                 zozibush::geometry::Distance* distances) -> bool {
+  std::array<int64_t, kBlockSize> nanometers{};
+  bool in_range{true};
+  try {
+    zozibush::geometry::ConvertToNanometers(
+        meters, count, zozibush::geometry::Distance::Type::kMeter,
+        nanometers.data());
+  } catch (const std::out_of_range&) {
+    in_range = false;
+  }
+  for (std::size_t i = 0; i < count; ++i) {
+    distances[i] = zozibush::geometry::Distance::FromNanometer(nanometers[i]);
+  }
+  return in_range;
+}
+
+// Reports the failures of a whole batch once every element is written.
+auto ThrowIfFailed(bool in_range, bool converged) -> void {
+  if (!in_range) {
+    throw std::out_of_range("coordinate is nan or inf");
+  }
+  if (!converged) {
+    throw std::domain_error("vincenty formula did not converge");
+  }
+}
+
+// Same rounding as the batch paths, so scalar and batch results are equal.
+auto MakeDistance(double meter) -> zozibush::geometry::Distance {
+  zozibush::geometry::Distance result;
+  zozibush::geometry::ConvertToDistances(
+      &meter, 1, zozibush::geometry::Distance::Type::kMeter, &result);
+  return result;
+}
+}  // namespace
+
+namespace zozibush::geometry {
+auto Geodesic::CalculateHaversineDistance(const Point2D& lhs,
+                                          const Point2D& rhs) -> Distance {
+  return MakeDistance(
+      HaversineMeters(lhs.GetX(), lhs.GetY(), rhs.GetX(), rhs.GetY()));
+}
+
+auto Geodesic::CalculateVincentyDistance(const Point2D& lhs,
+                                         const Point2D& rhs) -> Distance {
+  return CalculateDistance(lhs, rhs, Method::kVincenty);
+}
+
+auto Geodesic::CalculateEquirectangularDistance(const Point2D& lhs,
+                                                const Point2D& rhs)
+    -> Distance {
+  return MakeDistance(
+      EquirectangularMeters(lhs.GetX(), lhs.GetY(), rhs.GetX(), rhs.GetY()));
+}
+
+auto Geodesic::CalculateDistance(const Point2D& lhs, const Point2D& rhs,
+                                 Method method) -> Distance {
+  const auto kLhsLongitude{lhs.GetX()};
+  const auto kLhsLatitude{lhs.GetY()};
+  const auto kRhsLongitude{rhs.GetX()};
+  const auto kRhsLatitude{rhs.GetY()};
+  double meters{0.0};
+  if (!CalculateMeters(&kLhsLongitude, &kLhsLatitude, 0, &kRhsLongitude,
+                       &kRhsLatitude, 1, method, &meters)) {
+    throw std::domain_error("vincenty formula did not converge");
+  }
+  return MakeDistance(meters);
+}
+
+auto Geodesic::CalculateDistances(const PointCloud<2, double>& points,
+                                  const Point2D& origin, Distance* distances,
+                                  Method method) -> void {
+  const auto kOriginLongitude{origin.GetX()};
+  const auto kOriginLatitude{origin.GetY()};
+  std::array<double, kBlockSize> meters{};
+  bool in_range{true};
+  bool converged{true};
+  for (std::size_t offset = 0; offset < points.Size(); offset += kBlockSize) {
+    const auto kLength{std::min(kBlockSize, points.Size() - offset)};
+    converged = CalculateMeters(&kOriginLongitude, &kOriginLatitude, 0,
+                                points.Data(0) + offset,
+                                points.Data(1) + offset, kLength, method,
+                                meters.data()) &&
+                converged;
+    in_range = StoreMeters(meters.data(), kLength, distances + offset) &&
+               in_range;
+  }
+  ThrowIfFailed(in_range, converged);
+}
+
+auto Geodesic::CalculatePairwiseDistances(const PointCloud<2, double>& lhs,
+                                          const PointCloud<2, double>& rhs,
+                                          Distance* distances, Method method)
+    -> void {
+  if (lhs.Size() != rhs.Size()) {
+    throw std::invalid_argument("point clouds differ in size");
+  }
+
+  std::array<double, kBlockSize> meters{};
+  bool in_range{true};
+  bool converged{true};
+  for (std::size_t offset = 0; offset < lhs.Size(); offset += kBlockSize) {
+    const auto kLength{std::min(kBlockSize, lhs.Size() - offset)};
+    converged = CalculateMeters(lhs.Data(0) + offset, lhs.Data(1) + offset, 1,
+                                rhs.Data(0) + offset, rhs.Data(1) + offset,
+                                kLength, method, meters.data()) &&
+                converged;
+    in_range = StoreMeters(meters.data(), kLength, distances + offset) &&
+               in_range;
+  }
+  ThrowIfFailed(in_range, converged);
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,207 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/grid_index.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "geometry/parallel.hpp"
+#include "geometry/tuning.hpp"
+
+namespace {
+constexpr double kMaxCellsPerPoint{4.0};
+constexpr double kMinCellCount{1024.0};
+}  // namespace
+
+namespace zozibush::geometry {
+GridIndex::GridIndex(const PointCloud<2, double>& points, double cell_size,
+                     std::size_t thread_count)
+    : cell_size_(cell_size) {
+  Build(points, thread_count);
+}
+GridIndex::GridIndex(const PointCloud<2, float>& points, double cell_size,
+                     std::size_t thread_count)
+    : cell_size_(cell_size) {
+  Build(points, thread_count);
+}
+
+auto GridIndex::EstimateCellSize(const PointCloud<2, double>& points)
+    -> double {
+  const auto kCount{points.Size()};
+  if (kCount == 0) {
+    return 1.0;
+  }
+  const auto* x_values{points.Data(0)};
+  const auto* y_values{points.Data(1)};
+  const auto [kMinX, kMaxX] = std::minmax_element(x_values, x_values + kCount);
+  const auto [kMinY, kMaxY] = std::minmax_element(y_values, y_values + kCount);
+  const auto kWidth{*kMaxX - *kMinX};
+  const auto kHeight{*kMaxY - *kMinY};
+  auto cell_size{std::sqrt(kWidth * kHeight / static_cast<double>(kCount))};
+  if (!(cell_size > 0.0)) {
+    cell_size = std::max(kWidth, kHeight) / static_cast<double>(kCount);
+  }
+  return (std::isfinite(cell_size) && cell_size > 0.0) ? cell_size : 1.0;
+}
+
+template <typename T>
+auto GridIndex::Build(const PointCloud<2, T>& points, std::size_t thread_count)
+    -> void {
+  if (!std::isfinite(cell_size_) || cell_size_ <= 0.0) {
+    throw std::invalid_argument("cell size is not a positive finite value");
+  }
+
+  const auto kCount{points.Size()};
+  const auto* x_values{points.Data(0)};
+  const auto* y_values{points.Data(1)};
+  auto max_x{0.0};
+  auto max_y{0.0};
+  if (kCount > 0) {
+    min_x_ = max_x = static_cast<double>(x_values[0]);
+    min_y_ = max_y = static_cast<double>(y_values[0]);
+  }
+  for (std::size_t i = 0; i < kCount; ++i) {
+    if (!std::isfinite(x_values[i]) || !std::isfinite(y_values[i])) {
+      throw std::out_of_range("point is nan or inf");
+    }
+    const auto kX{static_cast<double>(x_values[i])};
+    const auto kY{static_cast<double>(y_values[i])};
+    min_x_ = std::min(min_x_, kX);
+    max_x = std::max(max_x, kX);
+    min_y_ = std::min(min_y_, kY);
+    max_y = std::max(max_y, kY);
+  }
+
+  // Count cells in double, the requested size may be tiny against the extent.
+  const auto kMaxCellCount{
+      std::max(kMinCellCount, kMaxCellsPerPoint * static_cast<double>(kCount))};
+  auto columns{std::floor((max_x - min_x_) / cell_size_) + 1.0};
+  auto rows{std::floor((max_y - min_y_) / cell_size_) + 1.0};
+  while (columns * rows > kMaxCellCount) {
+    cell_size_ *= 2.0;
+    columns = std::floor((max_x - min_x_) / cell_size_) + 1.0;
+    rows = std::floor((max_y - min_y_) / cell_size_) + 1.0;
+  }
+  column_count_ = static_cast<std::size_t>(columns);
+  row_count_ = static_cast<std::size_t>(rows);
+
+  std::vector<std::size_t> cells(kCount);
+  ParallelFor(
+      kCount, GetTuningParameters().cell_grain,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          cells[i] = GetRow(y_values[i]) * column_count_ +
+                     GetColumn(x_values[i]);
+        }
+      },
+      thread_count);
+
+  // Counting sort, stable so indices stay ascending inside a cell.
+  cell_offsets_.assign(column_count_ * row_count_ + 1, 0);
+  for (const auto kCell : cells) {
+    ++cell_offsets_[kCell + 1];
+  }
+  for (std::size_t cell = 1; cell < cell_offsets_.size(); ++cell) {
+    cell_offsets_[cell] += cell_offsets_[cell - 1];
+  }
+  indices_.resize(kCount);
+  x_values_.resize(kCount);
+  y_values_.resize(kCount);
+  std::vector<std::size_t> cursors(cell_offsets_.begin(),
+                                   cell_offsets_.end() - 1);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    const auto kSlot{cursors[cells[i]]++};
+    indices_[kSlot] = i;
+    x_values_[kSlot] = x_values[i];
+    y_values_[kSlot] = y_values[i];
+  }
+}
+
+auto GridIndex::Size() const -> std::size_t { return indices_.size(); }
+auto GridIndex::GetCellSize() const -> double { return cell_size_; }
+
+auto GridIndex::CountRadius(const Point2D& center, double radius,
+                            std::size_t limit) const -> std::size_t {
+  std::size_t result{0};
+  if (limit == 0) {
+    return result;
+  }
+  VisitRadius(center.GetX(), center.GetY(), radius, [&](std::size_t) {
+    return ++result < limit;
+  });
+  return result;
+}
+
+auto GridIndex::SearchRadius(const Point2D& center, double radius,
+                             std::vector<std::size_t>& indices) const
+    -> std::size_t {
+  indices.clear();
+  VisitRadius(center.GetX(), center.GetY(), radius, [&](std::size_t index) {
+    indices.push_back(index);
+    return true;
+  });
+  std::sort(indices.begin(), indices.end());
+  return indices.size();
+}
+
+auto GridIndex::FindNearest(const Point2D& query) const -> std::size_t {
+  if (indices_.empty()) {
+    throw std::out_of_range("grid index is empty");
+  }
+
+  const auto kQueryX{query.GetX()};
+  const auto kQueryY{query.GetY()};
+  const auto kColumn{GetColumn(kQueryX)};
+  const auto kRow{GetRow(kQueryY)};
+  const auto kMaxRing{std::max(column_count_, row_count_)};
+  auto best_index{indices_.size()};
+  auto best_distance{std::numeric_limits<double>::infinity()};
+
+  const auto kVisitCells = [&](std::size_t row, std::size_t first_column,
+                               std::size_t last_column) {
+    const auto kBegin{cell_offsets_[row * column_count_ + first_column]};
+    const auto kEnd{cell_offsets_[row * column_count_ + last_column + 1]};
+    for (auto i = kBegin; i < kEnd; ++i) {
+      const auto kDeltaX{x_values_[i] - kQueryX};
+      const auto kDeltaY{y_values_[i] - kQueryY};
+      const auto kDistance{kDeltaX * kDeltaX + kDeltaY * kDeltaY};
+      if (kDistance < best_distance ||
+          (kDistance == best_distance && indices_[i] < best_index)) {
+        best_distance = kDistance;
+        best_index = indices_[i];
+      }
+    }
+  };
+
+  for (std::size_t ring = 0; ring <= kMaxRing; ++ring) {
+    // Cells of ring r are at Chebyshev distance r from the query cell.
+    const auto kFirstColumn{kColumn >= ring ? kColumn - ring : 0};
+    const auto kLastColumn{std::min(kColumn + ring, column_count_ - 1)};
+    const auto kFirstRow{kRow >= ring ? kRow - ring : 0};
+    const auto kLastRow{std::min(kRow + ring, row_count_ - 1)};
+    for (auto row = kFirstRow; row <= kLastRow; ++row) {
+      if (row + ring == kRow || row == kRow + ring) {
+        kVisitCells(row, kFirstColumn, kLastColumn);
+        continue;
+      }
+      if (kColumn >= ring) {
+        kVisitCells(row, kColumn - ring, kColumn - ring);
+      }
+      if (ring > 0 && kColumn + ring < column_count_) {
+        kVisitCells(row, kColumn + ring, kColumn + ring);
+      }
+    }
+    // Any point beyond this ring is at least ring cells away.
+    const auto kReach{static_cast<double>(ring) * cell_size_};
+    if (best_index < indices_.size() && best_distance <= kReach * kReach) {
+      break;
+    }
+  }
+  return best_index;
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,463 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/kmeans.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "geometry/parallel.hpp"
+
+namespace {
+constexpr std::size_t kBlockSize{256};
+constexpr std::size_t kMinChunkSize{kBlockSize * 16};
+constexpr std::size_t kMaxChunkCount{256};
+constexpr std::size_t kSumStride{3};  // x sum, y sum, count
+constexpr double kInfinity{std::numeric_limits<double>::infinity()};
+
+// Chunk boundaries depend on the number of points only, never on threads.
+struct Chunking {
+  std::size_t size{kMinChunkSize};
+  std::size_t count{0};
+};
+
+auto MakeChunking(std::size_t point_count) -> Chunking {
+  Chunking result;
+  const auto kSpread{(point_count + kMaxChunkCount - 1) / kMaxChunkCount};
+  result.size = std::max(kMinChunkSize,
+                         (kSpread + kBlockSize - 1) / kBlockSize * kBlockSize);
+  result.count = (point_count + result.size - 1) / result.size;
+  return result;
+}
+
+auto CalculateSquaredDistance(double lhs_x, double lhs_y, double rhs_x,
+                              double rhs_y) -> double {
+  const auto kDeltaX{lhs_x - rhs_x};
+  const auto kDeltaY{lhs_y - rhs_y};
+  return kDeltaX * kDeltaX + kDeltaY * kDeltaY;
+}
+
+// Nearest and second nearest centroid of count points by squared distance.
+// The centroid loops are outside so the point loops have no branch to
+// vectorize. The first pass keeps the two smallest distances with min and
+// max only; the second, walking the centroids backwards, finds the first
+// centroid at the smallest distance. nearest is held as double, so that
+// every lane of the second pass has the width of the distances.
+auto FindNearestBlock(const double* x_values, const double* y_values,
+                      std::size_t count, const double* centroid_x,
+                      const double* centroid_y, std::size_t cluster_count,
+                      double* nearest, double* best, double* second) -> void {
+  std::fill(nearest, nearest + count, 0.0);
+  std::fill(best, best + count, kInfinity);
+  std::fill(second, second + count, kInfinity);
+  for (std::size_t cluster = 0; cluster < cluster_count; ++cluster) {
+    const auto kCentroidX{centroid_x[cluster]};
+    const auto kCentroidY{centroid_y[cluster]};
+    for (std::size_t i = 0; i < count; ++i) {
+      const auto kDistance{CalculateSquaredDistance(x_values[i], y_values[i],
+                                                    kCentroidX, kCentroidY)};
+      second[i] = std::min(second[i], std::max(best[i], kDistance));
+      best[i] = std::min(best[i], kDistance);
+    }
+  }
+  for (auto cluster = cluster_count; cluster-- > 0;) {
+    const auto kCentroidX{centroid_x[cluster]};
+    const auto kCentroidY{centroid_y[cluster]};
+    const auto kCluster{static_cast<double>(cluster)};
+    for (std::size_t i = 0; i < count; ++i) {
+      const auto kDistance{CalculateSquaredDistance(x_values[i], y_values[i],
+                                                    kCentroidX, kCentroidY)};
+      nearest[i] = (kDistance == best[i]) ? kCluster : nearest[i];
+    }
+  }
+}
+
+// Totals of one cluster over all chunks, combined in chunk order.
+auto CombineSums(const std::vector<double>& sums, std::size_t cluster_count,
+                 std::size_t cluster) -> std::array<double, kSumStride> {
+  std::array<double, kSumStride> result{};
+  for (auto offset = cluster * kSumStride; offset < sums.size();
+       offset += cluster_count * kSumStride) {
+    for (std::size_t i = 0; i < kSumStride; ++i) {
+      result[i] += sums[offset + i];
+    }
+  }
+  return result;
+}
+}  // namespace
+
+namespace zozibush::geometry {
+KMeans::KMeans(std::size_t cluster_count, uint64_t seed)
+    : cluster_count_(cluster_count), seed_(seed) {
+  if (cluster_count_ == 0 ||
+      cluster_count_ > std::numeric_limits<uint32_t>::max()) {
+    throw std::invalid_argument("cluster count is 0 or exceeds uint32_t");
+  }
+}
+
+auto KMeans::GetClusterCount() const -> std::size_t { return cluster_count_; }
+
+auto KMeans::GetCentroids() const -> std::vector<Point2D> {
+  std::vector<Point2D> result;
+  result.reserve(centroid_x_.size());
+  for (std::size_t i = 0; i < centroid_x_.size(); ++i) {
+    result.emplace_back(centroid_x_[i], centroid_y_[i]);
+  }
+  return result;
+}
+
+auto KMeans::SetCentroids(const std::vector<Point2D>& centroids) -> void {
+  if (centroids.size() != cluster_count_) {
+    throw std::invalid_argument("number of centroids differs");
+  }
+  centroid_x_.resize(cluster_count_);
+  centroid_y_.resize(cluster_count_);
+  for (std::size_t i = 0; i < cluster_count_; ++i) {
+    centroid_x_[i] = centroids[i].GetX();
+    centroid_y_[i] = centroids[i].GetY();
+  }
+  weights_.assign(cluster_count_, 0.0);
+}
+
+auto KMeans::Seed(const PointCloud<2, double>& points,
+                  std::size_t thread_count) -> void {
+  const auto kCount{points.Size()};
+  if (kCount < cluster_count_) {
+    throw std::invalid_argument("fewer points than clusters");
+  }
+
+  const auto* x_values{points.Data(0)};
+  const auto* y_values{points.Data(1)};
+  const auto kChunking{MakeChunking(kCount)};
+  std::vector<double> nearest(kCount);
+  std::vector<double> chunk_sums(kChunking.count);
+  std::mt19937_64 engine(seed_);
+  centroid_x_.clear();
+  centroid_y_.clear();
+
+  auto add_centroid = [&](std::size_t index) {
+    const auto kCentroidX{x_values[index]};
+    const auto kCentroidY{y_values[index]};
+    const auto kFirst{centroid_x_.empty()};
+    centroid_x_.push_back(kCentroidX);
+    centroid_y_.push_back(kCentroidY);
+    ParallelFor(
+        kChunking.count, 1,
+        [&](std::size_t begin, std::size_t end) {
+          for (auto chunk = begin; chunk < end; ++chunk) {
+            const auto kBegin{chunk * kChunking.size};
+            const auto kEnd{std::min(kBegin + kChunking.size, kCount)};
+            auto sum{0.0};
+            for (auto i = kBegin; i < kEnd; ++i) {
+              const auto kDistance{CalculateSquaredDistance(
+                  x_values[i], y_values[i], kCentroidX, kCentroidY)};
+              nearest[i] = kFirst ? kDistance : std::min(nearest[i], kDistance);
+              sum += nearest[i];
+            }
+            chunk_sums[chunk] = sum;
+          }
+        },
+        thread_count);
+  };
+
+  add_centroid(std::uniform_int_distribution<std::size_t>(0, kCount - 1)(
+      engine));
+  while (centroid_x_.size() < cluster_count_) {
+    auto total{0.0};
+    for (const auto kSum : chunk_sums) {
+      total += kSum;
+    }
+    if (!(total > 0.0)) {
+      // Every point coincides with a centroid; any choice is as good.
+      add_centroid(std::uniform_int_distribution<std::size_t>(0, kCount - 1)(
+          engine));
+      continue;
+    }
+
+    auto target{std::uniform_real_distribution<double>(0.0, total)(engine)};
+    std::size_t chunk{0};
+    while (chunk + 1 < kChunking.count && target >= chunk_sums[chunk]) {
+      target -= chunk_sums[chunk++];
+    }
+    const auto kBegin{chunk * kChunking.size};
+    const auto kEnd{std::min(kBegin + kChunking.size, kCount)};
+    auto chosen{kBegin};
+    for (auto i = kBegin; i < kEnd; ++i) {
+      if (nearest[i] > 0.0) {
+        // Falls back to the last candidate if rounding overshoots the chunk.
+        chosen = i;
+        if (target < nearest[i]) {
+          break;
+        }
+        target -= nearest[i];
+      }
+    }
+    add_centroid(chosen);
+  }
+  weights_.assign(cluster_count_, 0.0);
+}
+
+auto KMeans::Fit(const PointCloud<2, double>& points, uint32_t* labels,
+                 std::size_t max_iteration, Method method,
+                 std::size_t thread_count) -> std::size_t {
+  if (max_iteration == 0) {
+    throw std::invalid_argument("max iteration is 0");
+  }
+  if (centroid_x_.empty()) {
+    Seed(points, thread_count);
+  }
+
+  const auto kCount{points.Size()};
+  const auto* x_values{points.Data(0)};
+  const auto* y_values{points.Data(1)};
+  const auto kChunking{MakeChunking(kCount)};
+  const auto kHamerly{method == Method::kHamerly};
+  std::vector<double> sums(kChunking.count * cluster_count_ * kSumStride);
+  std::vector<std::size_t> changes(kChunking.count);
+  // Hamerly state: distance to the assigned centroid is at most upper, to
+  // every other centroid at least lower.
+  std::vector<double> upper(kHamerly ? kCount : 0);
+  std::vector<double> lower(kHamerly ? kCount : 0);
+  std::vector<double> moves(cluster_count_);
+  std::vector<double> half_separations(cluster_count_);
+  std::size_t max_move_cluster{0};
+  auto max_move{0.0};
+  auto second_move{0.0};
+
+  auto assign_all = [&](std::size_t begin, std::size_t end, bool first,
+                        double* chunk_sums) -> std::size_t {
+    std::array<double, kBlockSize> nearest{};
+    std::array<double, kBlockSize> best{};
+    std::array<double, kBlockSize> second{};
+    std::size_t changed{0};
+    for (auto offset = begin; offset < end; offset += kBlockSize) {
+      const auto kLength{std::min(kBlockSize, end - offset)};
+      FindNearestBlock(x_values + offset, y_values + offset, kLength,
+                       centroid_x_.data(), centroid_y_.data(), cluster_count_,
+                       nearest.data(), best.data(), second.data());
+      for (std::size_t j = 0; j < kLength; ++j) {
+        const auto kIndex{offset + j};
+        const auto kLabel{static_cast<uint32_t>(nearest[j])};
+        changed += (first || labels[kIndex] != kLabel) ? 1 : 0;
+        labels[kIndex] = kLabel;
+        if (kHamerly) {
+          upper[kIndex] = std::sqrt(best[j]);
+          lower[kIndex] = std::sqrt(second[j]);
+        }
+        chunk_sums[kLabel * kSumStride] += x_values[kIndex];
+        chunk_sums[kLabel * kSumStride + 1] += y_values[kIndex];
+        chunk_sums[kLabel * kSumStride + 2] += 1.0;
+      }
+    }
+    return changed;
+  };
+
+  auto assign_bounded = [&](std::size_t begin, std::size_t end,
+                            double* chunk_sums) -> std::size_t {
+    std::size_t changed{0};
+    for (auto i = begin; i < end; ++i) {
+      auto label{labels[i]};
+      upper[i] += moves[label];
+      lower[i] -= (label == max_move_cluster) ? second_move : max_move;
+      const auto kBound{std::max(half_separations[label], lower[i])};
+      if (upper[i] > kBound) {
+        upper[i] = std::sqrt(CalculateSquaredDistance(
+            x_values[i], y_values[i], centroid_x_[label], centroid_y_[label]));
+        if (upper[i] > kBound) {
+          double nearest{0.0};
+          double best{0.0};
+          double second{0.0};
+          FindNearestBlock(x_values + i, y_values + i, 1, centroid_x_.data(),
+                           centroid_y_.data(), cluster_count_, &nearest, &best,
+                           &second);
+          upper[i] = std::sqrt(best);
+          lower[i] = std::sqrt(second);
+          const auto kLabel{static_cast<uint32_t>(nearest)};
+          changed += (kLabel != label) ? 1 : 0;
+          label = kLabel;
+          labels[i] = label;
+        }
+      }
+      chunk_sums[label * kSumStride] += x_values[i];
+      chunk_sums[label * kSumStride + 1] += y_values[i];
+      chunk_sums[label * kSumStride + 2] += 1.0;
+    }
+    return changed;
+  };
+
+  std::size_t iteration{0};
+  while (iteration < max_iteration) {
+    const auto kFirst{iteration == 0};
+    std::fill(sums.begin(), sums.end(), 0.0);
+    ParallelFor(
+        kChunking.count, 1,
+        [&](std::size_t begin, std::size_t end) {
+          for (auto chunk = begin; chunk < end; ++chunk) {
+            const auto kBegin{chunk * kChunking.size};
+            const auto kEnd{std::min(kBegin + kChunking.size, kCount)};
+            auto* chunk_sums{sums.data() + chunk * cluster_count_ * kSumStride};
+            changes[chunk] = (kHamerly && !kFirst)
+                                 ? assign_bounded(kBegin, kEnd, chunk_sums)
+                                 : assign_all(kBegin, kEnd, kFirst, chunk_sums);
+          }
+        },
+        thread_count);
+    ++iteration;
+
+    std::size_t changed{0};
+    for (const auto kChanged : changes) {
+      changed += kChanged;
+    }
+    if (!kFirst && changed == 0) {
+      break;
+    }
+
+    const auto kPreviousX{centroid_x_};
+    const auto kPreviousY{centroid_y_};
+    UpdateCentroids(sums);
+    if (!kHamerly) {
+      continue;
+    }
+    max_move = 0.0;
+    second_move = 0.0;
+    for (std::size_t cluster = 0; cluster < cluster_count_; ++cluster) {
+      moves[cluster] = std::sqrt(CalculateSquaredDistance(
+          centroid_x_[cluster], centroid_y_[cluster], kPreviousX[cluster],
+          kPreviousY[cluster]));
+      if (moves[cluster] > max_move) {
+        second_move = max_move;
+        max_move = moves[cluster];
+        max_move_cluster = cluster;
+      } else {
+        second_move = std::max(second_move, moves[cluster]);
+      }
+    }
+    for (std::size_t cluster = 0; cluster < cluster_count_; ++cluster) {
+      auto closest{kInfinity};
+      for (std::size_t other = 0; other < cluster_count_; ++other) {
+        if (other != cluster) {
+          closest = std::min(
+              closest, CalculateSquaredDistance(
+                           centroid_x_[cluster], centroid_y_[cluster],
+                           centroid_x_[other], centroid_y_[other]));
+        }
+      }
+      half_separations[cluster] = 0.5 * std::sqrt(closest);
+    }
+  }
+  return iteration;
+}
+
+auto KMeans::PartialFit(const PointCloud<2, double>& batch,
+                        std::size_t thread_count) -> void {
+  if (centroid_x_.empty()) {
+    Seed(batch, thread_count);
+  }
+
+  const auto kCount{batch.Size()};
+  const auto* x_values{batch.Data(0)};
+  const auto* y_values{batch.Data(1)};
+  const auto kChunking{MakeChunking(kCount)};
+  std::vector<double> sums(kChunking.count * cluster_count_ * kSumStride);
+  ParallelFor(
+      kChunking.count, 1,
+      [&](std::size_t begin, std::size_t end) {
+        std::array<double, kBlockSize> nearest{};
+        std::array<double, kBlockSize> best{};
+        std::array<double, kBlockSize> second{};
+        for (auto chunk = begin; chunk < end; ++chunk) {
+          const auto kBegin{chunk * kChunking.size};
+          const auto kEnd{std::min(kBegin + kChunking.size, kCount)};
+          auto* chunk_sums{sums.data() + chunk * cluster_count_ * kSumStride};
+          for (auto offset = kBegin; offset < kEnd; offset += kBlockSize) {
+            const auto kLength{std::min(kBlockSize, kEnd - offset)};
+            FindNearestBlock(x_values + offset, y_values + offset, kLength,
+                             centroid_x_.data(), centroid_y_.data(),
+                             cluster_count_, nearest.data(), best.data(),
+                             second.data());
+            for (std::size_t j = 0; j < kLength; ++j) {
+              const auto kLabel{static_cast<std::size_t>(nearest[j])};
+              chunk_sums[kLabel * kSumStride] += x_values[offset + j];
+              chunk_sums[kLabel * kSumStride + 1] += y_values[offset + j];
+              chunk_sums[kLabel * kSumStride + 2] += 1.0;
+            }
+          }
+        }
+      },
+      thread_count);
+
+  for (std::size_t cluster = 0; cluster < cluster_count_; ++cluster) {
+    const auto [kSumX, kSumY, kCount] =
+        CombineSums(sums, cluster_count_, cluster);
+    if (kCount > 0.0) {
+      weights_[cluster] += kCount;
+      centroid_x_[cluster] +=
+          (kSumX - kCount * centroid_x_[cluster]) / weights_[cluster];
+      centroid_y_[cluster] +=
+          (kSumY - kCount * centroid_y_[cluster]) / weights_[cluster];
+    }
+  }
+}
+
+auto KMeans::Assign(const PointCloud<2, double>& points, uint32_t* labels,
+                    std::size_t thread_count) const -> void {
+  if (centroid_x_.empty()) {
+    throw std::logic_error("k-means has no centroids");
+  }
+
+  const auto* x_values{points.Data(0)};
+  const auto* y_values{points.Data(1)};
+  ParallelFor(
+      points.Size(), kBlockSize,
+      [&](std::size_t begin, std::size_t end) {
+        std::array<double, kBlockSize> nearest{};
+        std::array<double, kBlockSize> best{};
+        std::array<double, kBlockSize> second{};
+        for (auto offset = begin; offset < end; offset += kBlockSize) {
+          const auto kLength{std::min(kBlockSize, end - offset)};
+          FindNearestBlock(x_values + offset, y_values + offset, kLength,
+                           centroid_x_.data(), centroid_y_.data(),
+                           cluster_count_, nearest.data(), best.data(),
+                           second.data());
+          for (std::size_t j = 0; j < kLength; ++j) {
+            labels[offset + j] = static_cast<uint32_t>(nearest[j]);
+          }
+        }
+      },
+      thread_count);
+}
+
+auto KMeans::CalculateInertia(const PointCloud<2, double>& points,
+                              const uint32_t* labels) const -> double {
+  if (centroid_x_.empty()) {
+    throw std::logic_error("k-means has no centroids");
+  }
+
+  const auto* x_values{points.Data(0)};
+  const auto* y_values{points.Data(1)};
+  auto result{0.0};
+  for (std::size_t i = 0; i < points.Size(); ++i) {
+    result += CalculateSquaredDistance(x_values[i], y_values[i],
+                                       centroid_x_[labels[i]],
+                                       centroid_y_[labels[i]]);
+  }
+  return result;
+}
+
+auto KMeans::UpdateCentroids(const std::vector<double>& sums) -> void {
+  for (std::size_t cluster = 0; cluster < cluster_count_; ++cluster) {
+    const auto [kSumX, kSumY, kCount] =
+        CombineSums(sums, cluster_count_, cluster);
+    if (kCount > 0.0) {
+      centroid_x_[cluster] = kSumX / kCount;
+      centroid_y_[cluster] = kSumY / kCount;
+    }
+  }
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,64 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/parallel.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace zozibush::geometry {
+auto GetDefaultThreadCount() -> std::size_t {
+  const auto kHardwareThreads{std::thread::hardware_concurrency()};
+  return (kHardwareThreads == 0U) ? 1U : kHardwareThreads;
+}
+
+auto ParallelFor(std::size_t count, std::size_t grain, RangeFunction body,
+                 std::size_t thread_count) -> void {
+  if (count == 0U) {
+    return;
+  }
+  grain = std::max<std::size_t>(grain, 1U);
+  if (thread_count == 0U) {
+    thread_count = GetDefaultThreadCount();
+  }
+
+  const auto kGrainCount{(count + grain - 1) / grain};
+  const auto kRangeCount{std::min(thread_count, kGrainCount)};
+  if (kRangeCount <= 1U) {
+    body(0, count);
+    return;
+  }
+
+  const auto kRangeSize{((kGrainCount + kRangeCount - 1) / kRangeCount) *
+                        grain};
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  auto run_range = [&](std::size_t begin) {
+    try {
+      body(begin, std::min(begin + kRangeSize, count));
+    } catch (...) {
+      const std::lock_guard<std::mutex> kLock(error_mutex);
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(kRangeCount - 1);
+  for (std::size_t begin = kRangeSize; begin < count; begin += kRangeSize) {
+    workers.emplace_back(run_range, begin);
+  }
+  run_range(0);
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+}  // namespace zozibush::geometry
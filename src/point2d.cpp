@@ -4,74 +4,139 @@
 #include "geometry/point2d.hpp"
 
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <stdexcept>
+#include <type_traits>
 
-namespace zozibush::geometry {
-Point2D::Point2D(double input_x, double input_y) : x_(input_x), y_(input_y) {}
+#include "geometry/hash.hpp"
 
-auto Point2D::CalculateDistance(const Point2D& target) const -> double {
-  return Point2D::CalculateDistance(*this, target);
-}
+namespace {
+using Add = std::plus<>;
+using Sub = std::minus<>;
+using Mul = std::multiplies<>;
+using Div = std::divides<>;
 
-auto Point2D::CalculateDistance(const Point2D& lhs,
-                                const Point2D& rhs) -> double {
-  return std::sqrt(std::pow((lhs.x_ - rhs.x_), 2) +
-                   std::pow((lhs.y_ - rhs.y_), 2));
+// Adding +0 turns -0 into +0, so points equal under operator== share bits.
+template <typename T>
+auto GetHashBits(T value) -> uint64_t {
+  if constexpr (std::is_floating_point_v<T>) {
+    value += T{0};
+  }
+  std::conditional_t<sizeof(T) == sizeof(uint64_t), uint64_t, uint32_t> bits{
+      0};
+  std::memcpy(&bits, &value, sizeof(value));
+  return bits;
 }
+}  // namespace
+
+namespace zozibush::geometry {
+template <typename T>
+template <typename U>
+Point2<T>::Point2(const Point2<U>& other)
+    : x_(internal::CheckedConvert<T>(other.GetX())),
+      y_(internal::CheckedConvert<T>(other.GetY())) {}
 
-auto Point2D::GetX() const -> double { return x_; }
-auto Point2D::GetY() const -> double { return y_; }
+template <typename T>
+auto Point2<T>::CalculateDistance(const Point2& target) const -> DistanceType {
+  return Point2::CalculateDistance(*this, target);
+}
 
-auto Point2D::SetX(double input_x) -> void { x_ = input_x; }
-auto Point2D::SetY(double input_y) -> void { y_ = input_y; }
+template <typename T>
+auto Point2<T>::CalculateDistance(const Point2& lhs, const Point2& rhs)
+    -> DistanceType {
+  const auto kDeltaX{static_cast<DistanceType>(lhs.x_) -
+                     static_cast<DistanceType>(rhs.x_)};
+  const auto kDeltaY{static_cast<DistanceType>(lhs.y_) -
+                     static_cast<DistanceType>(rhs.y_)};
+  return std::sqrt(kDeltaX * kDeltaX + kDeltaY * kDeltaY);
+}
 
-auto Point2D::operator+(const Point2D& rhs) const -> Point2D {
-  auto kX = this->GetX() + rhs.GetX();
-  auto kY = this->GetY() + rhs.GetY();
-  return Point2D(kX, kY);
+template <typename T>
+auto Point2<T>::SetX(T input_x) -> void {
+  x_ = input_x;
 }
-auto Point2D::operator-(const Point2D& rhs) const -> Point2D {
-  auto kX = this->GetX() - rhs.GetX();
-  auto kY = this->GetY() - rhs.GetY();
-  return Point2D(kX, kY);
+template <typename T>
+auto Point2<T>::SetY(T input_y) -> void {
+  y_ = input_y;
 }
-auto Point2D::operator+=(const Point2D& other) -> Point2D& {
-  auto kNewX = (*this).GetX() + other.GetX();
-  auto kNewY = (*this).GetY() + other.GetY();
 
-  (*this).SetX(kNewX);
-  (*this).SetY(kNewY);
+template <typename T>
+auto Point2<T>::operator+(const Point2& rhs) const -> Point2 {
+  auto kX = internal::CombineCoordinates(this->GetX(), rhs.GetX(), Add{});
+  auto kY = internal::CombineCoordinates(this->GetY(), rhs.GetY(), Add{});
+  return Point2(kX, kY);
+}
+template <typename T>
+auto Point2<T>::operator-(const Point2& rhs) const -> Point2 {
+  auto kX = internal::CombineCoordinates(this->GetX(), rhs.GetX(), Sub{});
+  auto kY = internal::CombineCoordinates(this->GetY(), rhs.GetY(), Sub{});
+  return Point2(kX, kY);
+}
+template <typename T>
+auto Point2<T>::operator+=(const Point2& other) -> Point2& {
+  *this = *this + other;
   return *this;
 }
-auto Point2D::operator-=(const Point2D& other) -> Point2D& {
-  auto kNewX = (*this).GetX() - other.GetX();
-  auto kNewY = (*this).GetY() - other.GetY();
-
-  (*this).SetX(kNewX);
-  (*this).SetY(kNewY);
+template <typename T>
+auto Point2<T>::operator-=(const Point2& other) -> Point2& {
+  *this = *this - other;
   return *this;
 }
-auto Point2D::operator*(double scalar) const -> Point2D {
-  auto kX = this->GetX() * scalar;
-  auto kY = this->GetY() * scalar;
-  return Point2D(kX, kY);
+template <typename T>
+auto Point2<T>::operator*(T scalar) const -> Point2 {
+  auto kX = internal::CombineCoordinates(this->GetX(), scalar, Mul{});
+  auto kY = internal::CombineCoordinates(this->GetY(), scalar, Mul{});
+  return Point2(kX, kY);
 }
-auto Point2D::operator/(double scalar) const -> Point2D {
-  if (std::isnan(scalar) || std::isinf(scalar)) {
-    throw std::invalid_argument("scalar is nan or inf");
+template <typename T>
+auto Point2<T>::operator/(T scalar) const -> Point2 {
+  if constexpr (std::is_floating_point_v<T>) {
+    if (std::isnan(scalar) || std::isinf(scalar)) {
+      throw std::invalid_argument("scalar is nan or inf");
+    }
   }
-  if (scalar == 0.0) {
+  if (scalar == T{0}) {
     throw std::invalid_argument("scalar is 0, don't divide 0.");
   }
 
-  auto kX = this->GetX() / scalar;
-  auto kY = this->GetY() / scalar;
-  return Point2D(kX, kY);
+  auto kX = internal::CombineCoordinates(this->GetX(), scalar, Div{});
+  auto kY = internal::CombineCoordinates(this->GetY(), scalar, Div{});
+  return Point2(kX, kY);
 }
-auto Point2D::operator==(const Point2D& other) const -> bool {
+template <typename T>
+auto Point2<T>::operator==(const Point2& other) const -> bool {
   return ((*this).GetX() == other.GetX()) && ((*this).GetY() == other.GetY());
 }
-auto Point2D::operator!=(const Point2D& other) const -> bool {
+template <typename T>
+auto Point2<T>::operator!=(const Point2& other) const -> bool {
   return ((*this).GetX() != other.GetX()) && ((*this).GetY() != other.GetY());
 }
-}  // namespace zozibush::geometry
\ No newline at end of file
+
+template class Point2<double>;
+template class Point2<float>;
+template class Point2<int32_t>;
+
+template Point2<double>::Point2(const Point2<float>& other);
+template Point2<double>::Point2(const Point2<int32_t>& other);
+template Point2<float>::Point2(const Point2<double>& other);
+template Point2<float>::Point2(const Point2<int32_t>& other);
+template Point2<int32_t>::Point2(const Point2<double>& other);
+template Point2<int32_t>::Point2(const Point2<float>& other);
+}  // namespace zozibush::geometry
+
+namespace std {
+template <typename T>
+auto hash<zozibush::geometry::Point2<T>>::operator()(
+    const zozibush::geometry::Point2<T>& point) const noexcept
+    -> std::size_t {
+  return static_cast<std::size_t>(zozibush::geometry::internal::HashCombine(
+      zozibush::geometry::internal::MixHash(GetHashBits(point.GetX())),
+      GetHashBits(point.GetY())));
+}
+
+template struct hash<zozibush::geometry::Point2<double>>;
+template struct hash<zozibush::geometry::Point2<float>>;
+template struct hash<zozibush::geometry::Point2<int32_t>>;
+}  // namespace std
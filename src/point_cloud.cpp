@@ -0,0 +1,120 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/point_cloud.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace zozibush::geometry {
+template <std::size_t D, typename T>
+PointCloud<D, T>::PointCloud(const std::vector<PointType>& points) {
+  Resize(points.size());
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    internal::ForEachAxis(
+        [&](auto axis) { std::get<axis>(axes_)[i] = points[i][axis]; },
+        std::make_index_sequence<D>{});
+  }
+}
+
+template <std::size_t D, typename T>
+auto PointCloud<D, T>::Size() const -> std::size_t {
+  return axes_[0].size();
+}
+template <std::size_t D, typename T>
+auto PointCloud<D, T>::Empty() const -> bool {
+  return axes_[0].empty();
+}
+template <std::size_t D, typename T>
+auto PointCloud<D, T>::Reserve(std::size_t capacity) -> void {
+  for (auto& axis : axes_) {
+    axis.reserve(capacity);
+  }
+}
+template <std::size_t D, typename T>
+auto PointCloud<D, T>::Resize(std::size_t size) -> void {
+  // Allocate for every axis before resizing any, so a bad_alloc cannot
+  // leave the axes with different lengths.
+  if (size > Size()) {
+    Reserve(size);
+  }
+  for (auto& axis : axes_) {
+    axis.resize(size);
+  }
+}
+template <std::size_t D, typename T>
+auto PointCloud<D, T>::Clear() -> void {
+  for (auto& axis : axes_) {
+    axis.clear();
+  }
+}
+
+template <std::size_t D, typename T>
+auto PointCloud<D, T>::PushBack(const PointType& point) -> void {
+  // Grow every full axis first, geometrically as push_back would; the
+  // appends below then cannot throw.
+  const auto kSize{Size()};
+  for (auto& axis : axes_) {
+    if (axis.capacity() == kSize) {
+      axis.reserve(std::max<std::size_t>(2 * kSize, 1));
+    }
+  }
+  internal::ForEachAxis(
+      [&](auto axis) { std::get<axis>(axes_).push_back(point[axis]); },
+      std::make_index_sequence<D>{});
+}
+template <std::size_t D, typename T>
+auto PointCloud<D, T>::Get(std::size_t index) const -> PointType {
+  if (index >= Size()) {
+    throw std::out_of_range("index is out of point cloud range");
+  }
+  PointType result;
+  internal::ForEachAxis(
+      [&](auto axis) { result[axis] = std::get<axis>(axes_)[index]; },
+      std::make_index_sequence<D>{});
+  return result;
+}
+template <std::size_t D, typename T>
+auto PointCloud<D, T>::Set(std::size_t index, const PointType& point) -> void {
+  if (index >= Size()) {
+    throw std::out_of_range("index is out of point cloud range");
+  }
+  internal::ForEachAxis(
+      [&](auto axis) { std::get<axis>(axes_)[index] = point[axis]; },
+      std::make_index_sequence<D>{});
+}
+
+template <std::size_t D, typename T>
+auto PointCloud<D, T>::Data(std::size_t axis) const -> const T* {
+  return axes_[axis].data();
+}
+template <std::size_t D, typename T>
+auto PointCloud<D, T>::Data(std::size_t axis) -> T* {
+  return axes_[axis].data();
+}
+
+template <typename T>
+auto MakePointCloud(const std::vector<Point2<T>>& points) -> PointCloud<2, T> {
+  PointCloud<2, T> result;
+  result.Resize(points.size());
+  auto* x_values{result.Data(0)};
+  auto* y_values{result.Data(1)};
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    x_values[i] = points[i].GetX();
+    y_values[i] = points[i].GetY();
+  }
+  return result;
+}
+
+template class PointCloud<2, float>;
+template class PointCloud<2, double>;
+template class PointCloud<3, float>;
+template class PointCloud<3, double>;
+
+template auto MakePointCloud(const std::vector<Point2<float>>& points)
+    -> PointCloud<2, float>;
+template auto MakePointCloud(const std::vector<Point2<double>>& points)
+    -> PointCloud<2, double>;
+}  // namespace zozibush::geometry
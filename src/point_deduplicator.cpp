@@ -0,0 +1,153 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/point_deduplicator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "geometry/hash.hpp"
+#include "geometry/parallel.hpp"
+#include "geometry/point_hash_map.hpp"
+
+namespace {
+constexpr std::size_t kBlockSize{std::size_t{1} << 16U};
+// About 16K points per partition keeps its table within the L2 cache.
+constexpr std::size_t kPartitionSize{std::size_t{1} << 14U};
+constexpr std::size_t kMaxPartitionBits{12};
+}  // namespace
+
+namespace zozibush::geometry {
+PointDeduplicator::PointDeduplicator(const Distance& tolerance,
+                                     Distance::Type unit)
+    : tolerance_(tolerance.GetValue(unit)) {
+  if (!(tolerance_ >= 0.0)) {
+    throw std::invalid_argument("tolerance is negative");
+  }
+}
+
+auto PointDeduplicator::Snap(const Point2D& point) const -> Point2D {
+  return Snap(point.GetX(), point.GetY());
+}
+auto PointDeduplicator::Snap(double input_x, double input_y) const
+    -> Point2D {
+  if (tolerance_ == 0.0) {
+    return {input_x, input_y};
+  }
+  return {std::floor(input_x / tolerance_), std::floor(input_y / tolerance_)};
+}
+
+auto PointDeduplicator::Deduplicate(const PointCloud<2, double>& points,
+                                    std::vector<std::size_t>& indices,
+                                    std::size_t* representatives,
+                                    std::size_t thread_count) const
+    -> std::size_t {
+  const auto kCount{points.Size()};
+  if (kCount > std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error("too many points to deduplicate");
+  }
+  const auto* x_values{points.Data(0)};
+  const auto* y_values{points.Data(1)};
+  indices.clear();
+
+  std::size_t bits{0};
+  while ((kCount >> bits) > kPartitionSize && bits < kMaxPartitionBits) {
+    ++bits;
+  }
+  const auto kPartitions{std::size_t{1} << bits};
+  const auto kBlocks{(kCount + kBlockSize - 1) / kBlockSize};
+
+  // The partition comes from a second mix of the hash, so the points of a
+  // partition still spread over all slots of its table.
+  std::vector<uint16_t> partitions(kCount);
+  std::vector<uint32_t> offsets(kBlocks * kPartitions);
+  ParallelFor(
+      kBlocks, 1,
+      [&](std::size_t first_block, std::size_t last_block) {
+        for (auto block = first_block; block < last_block; ++block) {
+          auto* counts{&offsets[block * kPartitions]};
+          const auto kEnd{std::min(kCount, (block + 1) * kBlockSize)};
+          for (auto i = block * kBlockSize; i < kEnd; ++i) {
+            if (!std::isfinite(x_values[i]) || !std::isfinite(y_values[i])) {
+              throw std::out_of_range("point coordinate is nan or inf");
+            }
+            const auto kHash{internal::MixHash(std::hash<Point2D>{}(
+                Snap(x_values[i], y_values[i])))};
+            const auto kPartition{
+                (bits == 0) ? 0 : static_cast<uint16_t>(kHash >> (64 - bits))};
+            partitions[i] = kPartition;
+            ++counts[kPartition];
+          }
+        }
+      },
+      thread_count);
+
+  // Partition major, block minor, so every partition lists its points in
+  // index order and the lowest index of a cell is inserted first.
+  std::vector<std::size_t> partition_offsets(kPartitions + 1);
+  uint32_t running{0};
+  for (std::size_t partition = 0; partition < kPartitions; ++partition) {
+    partition_offsets[partition] = running;
+    for (std::size_t block = 0; block < kBlocks; ++block) {
+      const auto kSize{offsets[block * kPartitions + partition]};
+      offsets[block * kPartitions + partition] = running;
+      running += kSize;
+    }
+  }
+  partition_offsets[kPartitions] = kCount;
+
+  // The cells travel with the indices, so that the partitions are read
+  // sequentially instead of gathering coordinates from all over the cloud.
+  std::vector<uint32_t> order(kCount);
+  std::vector<Point2D> cells(kCount);
+  ParallelFor(
+      kBlocks, 1,
+      [&](std::size_t first_block, std::size_t last_block) {
+        for (auto block = first_block; block < last_block; ++block) {
+          auto* next{&offsets[block * kPartitions]};
+          const auto kEnd{std::min(kCount, (block + 1) * kBlockSize)};
+          for (auto i = block * kBlockSize; i < kEnd; ++i) {
+            const auto kPosition{next[partitions[i]]++};
+            order[kPosition] = static_cast<uint32_t>(i);
+            cells[kPosition] = Snap(x_values[i], y_values[i]);
+          }
+        }
+      },
+      thread_count);
+
+  std::vector<uint8_t> kept(kCount);
+  ParallelFor(
+      kPartitions, 1,
+      [&](std::size_t first_partition, std::size_t last_partition) {
+        PointHashMap<uint32_t> firsts;
+        for (auto partition = first_partition; partition < last_partition;
+             ++partition) {
+          const auto kBegin{partition_offsets[partition]};
+          const auto kEnd{partition_offsets[partition + 1]};
+          firsts.Clear();
+          firsts.Reserve(kEnd - kBegin);
+          for (auto j = kBegin; j < kEnd; ++j) {
+            const auto kIndex{order[j]};
+            const auto [kFirst, kInserted] = firsts.Insert(cells[j], kIndex);
+            kept[kIndex] = static_cast<uint8_t>(kInserted);
+            if (representatives != nullptr) {
+              representatives[kIndex] = *kFirst;
+            }
+          }
+        }
+      },
+      thread_count);
+
+  for (std::size_t i = 0; i < kCount; ++i) {
+    if (kept[i] != 0) {
+      indices.push_back(i);
+    }
+  }
+  return indices.size();
+}
+}  // namespace zozibush::geometry
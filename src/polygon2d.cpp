@@ -0,0 +1,317 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/polygon2d.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "geometry/parallel.hpp"
+#include "geometry/tuning.hpp"
+
+namespace {
+constexpr std::size_t kMinVertexCount{3};
+constexpr std::size_t kMaskBits{64};
+constexpr std::size_t kParallelEdgeCount{std::size_t{1} << 16U};
+constexpr std::size_t kMaxSlabCount{std::size_t{1} << 20U};
+constexpr std::size_t kMaxEntriesPerEdge{64};
+
+using EdgeSums = std::array<double, 3>;
+
+// Runs accumulate(begin, end, sums) over all edges, split over threads once
+// the polygon is large enough to pay for them.
+template <typename Function>
+auto ReduceEdges(std::size_t edge_count, const Function& accumulate)
+    -> EdgeSums {
+  EdgeSums result{};
+  if (edge_count < kParallelEdgeCount) {
+    accumulate(0, edge_count, result);
+    return result;
+  }
+
+  const auto kChunkCount{zozibush::geometry::GetDefaultThreadCount()};
+  const auto kChunkSize{(edge_count + kChunkCount - 1) / kChunkCount};
+  std::vector<EdgeSums> partials(kChunkCount);
+  zozibush::geometry::ParallelFor(
+      kChunkCount, 1, [&](std::size_t begin, std::size_t end) {
+        for (auto chunk = begin; chunk < end; ++chunk) {
+          const auto kBegin{std::min(chunk * kChunkSize, edge_count)};
+          const auto kEnd{std::min(kBegin + kChunkSize, edge_count)};
+          accumulate(kBegin, kEnd, partials[chunk]);
+        }
+      });
+  for (const auto& partial : partials) {
+    for (std::size_t i = 0; i < result.size(); ++i) {
+      result[i] += partial[i];
+    }
+  }
+  return result;
+}
+}  // namespace
+
+namespace zozibush::geometry {
+Polygon2D::Polygon2D(const std::vector<Point2D>& vertices)
+    : vertices_(vertices) {
+  if (vertices.size() < kMinVertexCount) {
+    throw std::invalid_argument("polygon needs at least 3 vertices");
+  }
+
+  const auto kCount{vertices.size()};
+  edge_x_.resize(kCount);
+  edge_y_.resize(kCount);
+  edge_end_y_.resize(kCount);
+  edge_slope_.resize(kCount);
+  min_y_ = vertices.front().GetY();
+  max_y_ = min_y_;
+  for (std::size_t i = 0; i < kCount; ++i) {
+    const auto& kStart{vertices[i]};
+    const auto& kEnd{vertices[(i + 1 == kCount) ? 0 : i + 1]};
+    const auto kDeltaY{kEnd.GetY() - kStart.GetY()};
+    edge_x_[i] = kStart.GetX();
+    edge_y_[i] = kStart.GetY();
+    edge_end_y_[i] = kEnd.GetY();
+    edge_slope_[i] =
+        (kDeltaY == 0.0) ? 0.0 : (kEnd.GetX() - kStart.GetX()) / kDeltaY;
+    min_y_ = std::min(min_y_, kStart.GetY());
+    max_y_ = std::max(max_y_, kStart.GetY());
+  }
+}
+
+auto Polygon2D::GetVertexCount() const -> std::size_t {
+  return vertices_.size();
+}
+auto Polygon2D::GetVertices() const -> const std::vector<Point2D>& {
+  return vertices_;
+}
+
+auto Polygon2D::BuildIndex(std::size_t slab_count) -> void {
+  const auto kEdgeCount{edge_y_.size()};
+  if (kEdgeCount > std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error("polygon has too many edges to index");
+  }
+  if (slab_count == 0U) {
+    slab_count = vertices_.size();
+  }
+  slab_count = std::min(slab_count, kMaxSlabCount);
+  const auto kHeight{max_y_ - min_y_};
+  const auto kSlabOf = [&](double input_y) {
+    const auto kSlab{static_cast<std::size_t>((input_y - min_y_) *
+                                              slab_scale_)};
+    return std::min(kSlab, slab_count - 1);
+  };
+  const auto kEntryCount = [&]() {
+    std::size_t result{0};
+    for (std::size_t i = 0; i < kEdgeCount; ++i) {
+      result += kSlabOf(std::max(edge_y_[i], edge_end_y_[i])) -
+                kSlabOf(std::min(edge_y_[i], edge_end_y_[i])) + 1;
+    }
+    return result;
+  };
+
+  // Edges spanning many slabs (a comb, a zigzag) make the index quadratic;
+  // halve the slabs until it is linear in the edges again. One slab always
+  // fits, as it lists every edge once.
+  const auto kMaxEntryCount{std::min<std::size_t>(
+      kEdgeCount * kMaxEntriesPerEdge, std::numeric_limits<uint32_t>::max())};
+  while (true) {
+    slab_scale_ = (kHeight > 0.0) ? static_cast<double>(slab_count) / kHeight
+                                  : 0.0;
+    if (slab_count == 1U || kEntryCount() <= kMaxEntryCount) {
+      break;
+    }
+    slab_count /= 2U;
+  }
+
+  // Counting pass, then fill, so every slab is one contiguous run.
+  slab_offsets_.assign(slab_count + 1, 0U);
+  for (std::size_t i = 0; i < edge_y_.size(); ++i) {
+    const auto kFirst{kSlabOf(std::min(edge_y_[i], edge_end_y_[i]))};
+    const auto kLast{kSlabOf(std::max(edge_y_[i], edge_end_y_[i]))};
+    for (auto slab = kFirst; slab <= kLast; ++slab) {
+      ++slab_offsets_[slab + 1];
+    }
+  }
+  for (std::size_t slab = 0; slab < slab_count; ++slab) {
+    slab_offsets_[slab + 1] += slab_offsets_[slab];
+  }
+
+  slab_edges_.resize(slab_offsets_.back());
+  auto cursors{slab_offsets_};
+  for (std::size_t i = 0; i < edge_y_.size(); ++i) {
+    const auto kFirst{kSlabOf(std::min(edge_y_[i], edge_end_y_[i]))};
+    const auto kLast{kSlabOf(std::max(edge_y_[i], edge_end_y_[i]))};
+    for (auto slab = kFirst; slab <= kLast; ++slab) {
+      slab_edges_[cursors[slab]++] = static_cast<uint32_t>(i);
+    }
+  }
+}
+
+auto Polygon2D::HasIndex() const -> bool { return !slab_offsets_.empty(); }
+auto Polygon2D::GetIndexSize() const -> std::size_t {
+  return slab_edges_.size();
+}
+
+auto Polygon2D::ContainsIndexed(double input_x, double input_y) const
+    -> bool {
+  if (!(input_y >= min_y_ && input_y <= max_y_)) {
+    return false;
+  }
+  const auto kSlabCount{slab_offsets_.size() - 1};
+  const auto kSlab{std::min(
+      static_cast<std::size_t>((input_y - min_y_) * slab_scale_),
+      kSlabCount - 1)};
+
+  bool inside{false};
+  for (auto i = slab_offsets_[kSlab]; i < slab_offsets_[kSlab + 1]; ++i) {
+    const auto kEdge{slab_edges_[i]};
+    const bool kCrosses{(edge_y_[kEdge] > input_y) !=
+                        (edge_end_y_[kEdge] > input_y)};
+    if (kCrosses && input_x < edge_x_[kEdge] + (input_y - edge_y_[kEdge]) *
+                                                   edge_slope_[kEdge]) {
+      inside = !inside;
+    }
+  }
+  return inside;
+}
+
+template <typename T>
+auto Polygon2D::ContainsBlock(const T* x_values, const T* y_values,
+                              std::size_t count, uint64_t* mask) const
+    -> void {
+  std::array<uint8_t, kMaskBits> parity{};
+  if (HasIndex()) {
+    for (std::size_t j = 0; j < count; ++j) {
+      parity[j] = ContainsIndexed(x_values[j], y_values[j]) ? 1U : 0U;
+    }
+  } else {
+    for (std::size_t i = 0; i < edge_x_.size(); ++i) {
+      const auto kStartX{edge_x_[i]};
+      const auto kStartY{edge_y_[i]};
+      const auto kEndY{edge_end_y_[i]};
+      const auto kSlope{edge_slope_[i]};
+      for (std::size_t j = 0; j < count; ++j) {
+        const auto kX{static_cast<double>(x_values[j])};
+        const auto kY{static_cast<double>(y_values[j])};
+        const bool kCrosses{(kStartY > kY) != (kEndY > kY)};
+        const bool kLeft{kX < kStartX + (kY - kStartY) * kSlope};
+        parity[j] ^= static_cast<uint8_t>(kCrosses && kLeft);
+      }
+    }
+  }
+
+  uint64_t word{0};
+  for (std::size_t j = 0; j < count; ++j) {
+    word |= static_cast<uint64_t>(parity[j]) << j;
+  }
+  *mask = word;
+}
+
+auto Polygon2D::Contains(const Point2D& point) const -> bool {
+  const auto kX{point.GetX()};
+  const auto kY{point.GetY()};
+  if (HasIndex()) {
+    return ContainsIndexed(kX, kY);
+  }
+  uint64_t word{0};
+  ContainsBlock(&kX, &kY, 1, &word);
+  return word != 0U;
+}
+
+auto Polygon2D::Contains(const PointCloud<2, double>& points, uint64_t* mask,
+                         std::size_t thread_count) const -> void {
+  ContainsCloud(points, mask, thread_count);
+}
+auto Polygon2D::Contains(const PointCloud<2, float>& points, uint64_t* mask,
+                         std::size_t thread_count) const -> void {
+  ContainsCloud(points, mask, thread_count);
+}
+
+template <typename T>
+auto Polygon2D::ContainsCloud(const PointCloud<2, T>& points, uint64_t* mask,
+                              std::size_t thread_count) const -> void {
+  const auto* x_values{points.Data(0)};
+  const auto* y_values{points.Data(1)};
+  const auto kCount{points.Size()};
+  ParallelFor(
+      kCount, GetTuningParameters().contains_grain,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto block = begin; block < end; block += kMaskBits) {
+          ContainsBlock(x_values + block, y_values + block,
+                        std::min(kMaskBits, end - block),
+                        mask + block / kMaskBits);
+        }
+      },
+      thread_count);
+}
+
+auto Polygon2D::GetMaskWordCount(std::size_t point_count) -> std::size_t {
+  return (point_count + kMaskBits - 1) / kMaskBits;
+}
+
+auto Polygon2D::CalculateSignedArea() const -> double {
+  // Shift to the first vertex so the cross products stay small.
+  const auto kOriginX{edge_x_[0]};
+  const auto kOriginY{edge_y_[0]};
+  const auto kCount{edge_x_.size()};
+  const auto kSums{
+      ReduceEdges(kCount, [&](std::size_t begin, std::size_t end,
+                              EdgeSums& sums) {
+        for (auto i = begin; i < end; ++i) {
+          const auto kNext{(i + 1 == kCount) ? 0 : i + 1};
+          sums[0] += (edge_x_[i] - kOriginX) * (edge_y_[kNext] - kOriginY) -
+                     (edge_x_[kNext] - kOriginX) * (edge_y_[i] - kOriginY);
+        }
+      })};
+  return kSums[0] * 0.5;
+}
+
+auto Polygon2D::CalculateArea() const -> double {
+  return std::abs(CalculateSignedArea());
+}
+
+auto Polygon2D::CalculatePerimeter(Distance::Type unit) const -> Distance {
+  const auto kCount{edge_x_.size()};
+  const auto kSums{
+      ReduceEdges(kCount, [&](std::size_t begin, std::size_t end,
+                              EdgeSums& sums) {
+        for (auto i = begin; i < end; ++i) {
+          const auto kNext{(i + 1 == kCount) ? 0 : i + 1};
+          const auto kDeltaX{edge_x_[kNext] - edge_x_[i]};
+          const auto kDeltaY{edge_y_[kNext] - edge_y_[i]};
+          sums[0] += std::sqrt(kDeltaX * kDeltaX + kDeltaY * kDeltaY);
+        }
+      })};
+  return Distance(kSums[0], unit);
+}
+
+auto Polygon2D::CalculateCentroid() const -> Point2D {
+  const auto kOriginX{edge_x_[0]};
+  const auto kOriginY{edge_y_[0]};
+  const auto kCount{edge_x_.size()};
+  const auto kSums{
+      ReduceEdges(kCount, [&](std::size_t begin, std::size_t end,
+                              EdgeSums& sums) {
+        for (auto i = begin; i < end; ++i) {
+          const auto kNext{(i + 1 == kCount) ? 0 : i + 1};
+          const auto kX0{edge_x_[i] - kOriginX};
+          const auto kY0{edge_y_[i] - kOriginY};
+          const auto kX1{edge_x_[kNext] - kOriginX};
+          const auto kY1{edge_y_[kNext] - kOriginY};
+          const auto kCross{kX0 * kY1 - kX1 * kY0};
+          sums[0] += kCross;
+          sums[1] += (kX0 + kX1) * kCross;
+          sums[2] += (kY0 + kY1) * kCross;
+        }
+      })};
+  if (kSums[0] == 0.0) {
+    throw std::invalid_argument("polygon area is 0");
+  }
+  const auto kScale{1.0 / (3.0 * kSums[0])};
+  return Point2D(kOriginX + kSums[1] * kScale, kOriginY + kSums[2] * kScale);
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,316 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/polyline_simplifier.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "geometry/parallel.hpp"
+
+namespace {
+constexpr uint32_t kNotInHeap{std::numeric_limits<uint32_t>::max()};
+constexpr std::size_t kMinWindowCapacity{2};
+
+auto CalculateSegmentDistanceSquared(double point_x, double point_y,
+                                     double start_x, double start_y,
+                                     double end_x, double end_y) -> double {
+  const auto kSegmentX{end_x - start_x};
+  const auto kSegmentY{end_y - start_y};
+  auto delta_x{point_x - start_x};
+  auto delta_y{point_y - start_y};
+  const auto kLengthSquared{kSegmentX * kSegmentX + kSegmentY * kSegmentY};
+  if (kLengthSquared > 0.0) {
+    const auto kRatio{std::clamp(
+        (delta_x * kSegmentX + delta_y * kSegmentY) / kLengthSquared, 0.0,
+        1.0)};
+    delta_x -= kRatio * kSegmentX;
+    delta_y -= kRatio * kSegmentY;
+  }
+  return delta_x * delta_x + delta_y * delta_y;
+}
+
+auto CopyAll(const zozibush::geometry::Point2D* points, std::size_t count,
+             zozibush::geometry::Point2D* output) -> std::size_t {
+  std::copy(points, points + count, output);
+  return count;
+}
+}  // namespace
+
+namespace zozibush::geometry {
+PolylineSimplifier::PolylineSimplifier(const Distance& tolerance,
+                                       Distance::Type unit)
+    : tolerance_(tolerance.GetValue(unit)) {}
+
+auto PolylineSimplifier::Load(const Point2D* points, std::size_t count)
+    -> void {
+  x_values_.resize(count);
+  y_values_.resize(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    x_values_[i] = points[i].GetX();
+    y_values_[i] = points[i].GetY();
+  }
+  keep_.assign(count, 0U);
+  keep_.front() = 1U;
+  keep_.back() = 1U;
+}
+
+auto PolylineSimplifier::Store(const Point2D* points, std::size_t count,
+                               Point2D* output) const -> std::size_t {
+  std::size_t result{0};
+  for (std::size_t i = 0; i < count; ++i) {
+    if (keep_[i] != 0U) {
+      output[result++] = points[i];
+    }
+  }
+  return result;
+}
+
+auto PolylineSimplifier::DouglasPeucker(const Point2D* points,
+                                        std::size_t count, Point2D* output)
+    -> std::size_t {
+  if (count <= 2U) {
+    return CopyAll(points, count, output);
+  }
+  Load(points, count);
+
+  const auto kToleranceSquared{tolerance_ * tolerance_};
+  stack_.clear();
+  stack_.push_back(0U);
+  stack_.push_back(static_cast<uint32_t>(count - 1));
+  while (!stack_.empty()) {
+    const auto kLast{stack_.back()};
+    stack_.pop_back();
+    const auto kFirst{stack_.back()};
+    stack_.pop_back();
+
+    double max_distance{-1.0};
+    auto max_index{kFirst};
+    for (auto i = kFirst + 1; i < kLast; ++i) {
+      const auto kDistance{CalculateSegmentDistanceSquared(
+          x_values_[i], y_values_[i], x_values_[kFirst], y_values_[kFirst],
+          x_values_[kLast], y_values_[kLast])};
+      if (kDistance > max_distance) {
+        max_distance = kDistance;
+        max_index = i;
+      }
+    }
+
+    if (max_distance > kToleranceSquared) {
+      keep_[max_index] = 1U;
+      if (max_index - kFirst > 1U) {
+        stack_.push_back(kFirst);
+        stack_.push_back(max_index);
+      }
+      if (kLast - max_index > 1U) {
+        stack_.push_back(max_index);
+        stack_.push_back(kLast);
+      }
+    }
+  }
+  return Store(points, count, output);
+}
+
+auto PolylineSimplifier::CalculateArea(uint32_t index) const -> double {
+  const auto kPrevious{previous_[index]};
+  const auto kNext{next_[index]};
+  const auto kCross{(x_values_[index] - x_values_[kPrevious]) *
+                        (y_values_[kNext] - y_values_[kPrevious]) -
+                    (x_values_[kNext] - x_values_[kPrevious]) *
+                        (y_values_[index] - y_values_[kPrevious])};
+  return std::abs(kCross) * 0.5;
+}
+
+auto PolylineSimplifier::SwapHeap(std::size_t lhs, std::size_t rhs) -> void {
+  std::swap(heap_[lhs], heap_[rhs]);
+  heap_position_[heap_[lhs]] = static_cast<uint32_t>(lhs);
+  heap_position_[heap_[rhs]] = static_cast<uint32_t>(rhs);
+}
+
+auto PolylineSimplifier::SiftUp(std::size_t position) -> void {
+  while (position > 0U) {
+    const auto kParent{(position - 1) / 2};
+    if (!(areas_[heap_[position]] < areas_[heap_[kParent]])) {
+      break;
+    }
+    SwapHeap(position, kParent);
+    position = kParent;
+  }
+}
+
+auto PolylineSimplifier::SiftDown(std::size_t position) -> void {
+  const auto kSize{heap_.size()};
+  while (true) {
+    const auto kLeft{position * 2 + 1};
+    const auto kRight{kLeft + 1};
+    auto smallest{position};
+    if (kLeft < kSize && areas_[heap_[kLeft]] < areas_[heap_[smallest]]) {
+      smallest = kLeft;
+    }
+    if (kRight < kSize && areas_[heap_[kRight]] < areas_[heap_[smallest]]) {
+      smallest = kRight;
+    }
+    if (smallest == position) {
+      break;
+    }
+    SwapHeap(position, smallest);
+    position = smallest;
+  }
+}
+
+auto PolylineSimplifier::UpdateHeap(uint32_t index, double area) -> void {
+  const auto kOldArea{areas_[index]};
+  areas_[index] = area;
+  if (area < kOldArea) {
+    SiftUp(heap_position_[index]);
+  } else {
+    SiftDown(heap_position_[index]);
+  }
+}
+
+auto PolylineSimplifier::VisvalingamWhyatt(const Point2D* points,
+                                           std::size_t count, Point2D* output)
+    -> std::size_t {
+  if (count <= 2U) {
+    return CopyAll(points, count, output);
+  }
+  Load(points, count);
+
+  const auto kLastIndex{static_cast<uint32_t>(count - 1)};
+  previous_.resize(count);
+  next_.resize(count);
+  areas_.resize(count);
+  heap_position_.assign(count, kNotInHeap);
+  heap_.clear();
+  for (uint32_t i = 1; i < kLastIndex; ++i) {
+    previous_[i] = i - 1;
+    next_[i] = i + 1;
+    keep_[i] = 1U;
+  }
+  previous_[kLastIndex] = kLastIndex - 1;
+  next_[0] = 1U;
+  for (uint32_t i = 1; i < kLastIndex; ++i) {
+    areas_[i] = CalculateArea(i);
+    heap_position_[i] = static_cast<uint32_t>(heap_.size());
+    heap_.push_back(i);
+  }
+  for (auto position = heap_.size() / 2; position-- > 0U;) {
+    SiftDown(position);
+  }
+
+  const auto kThreshold{tolerance_ * tolerance_};
+  while (!heap_.empty()) {
+    const auto kIndex{heap_.front()};
+    const auto kArea{areas_[kIndex]};
+    if (kArea >= kThreshold) {
+      break;
+    }
+
+    SwapHeap(0, heap_.size() - 1);
+    heap_.pop_back();
+    heap_position_[kIndex] = kNotInHeap;
+    if (!heap_.empty()) {
+      SiftDown(0);
+    }
+    keep_[kIndex] = 0U;
+
+    const auto kPrevious{previous_[kIndex]};
+    const auto kNext{next_[kIndex]};
+    next_[kPrevious] = kNext;
+    previous_[kNext] = kPrevious;
+    // A neighbour never drops below the area just removed, so points are
+    // eliminated in non-decreasing area order.
+    if (heap_position_[kPrevious] != kNotInHeap) {
+      UpdateHeap(kPrevious, std::max(CalculateArea(kPrevious), kArea));
+    }
+    if (heap_position_[kNext] != kNotInHeap) {
+      UpdateHeap(kNext, std::max(CalculateArea(kNext), kArea));
+    }
+  }
+  return Store(points, count, output);
+}
+
+auto PolylineSimplifier::Simplify(Method method, const Point2D* points,
+                                  std::size_t count, Point2D* output)
+    -> std::size_t {
+  if (method == Method::kVisvalingamWhyatt) {
+    return VisvalingamWhyatt(points, count, output);
+  }
+  return DouglasPeucker(points, count, output);
+}
+
+auto PolylineSimplifier::SimplifyBatch(const Distance& tolerance,
+                                       Method method, const Point2D* points,
+                                       const std::size_t* offsets,
+                                       std::size_t polyline_count,
+                                       Point2D* output, std::size_t* counts,
+                                       Distance::Type unit,
+                                       std::size_t thread_count) -> void {
+  ParallelFor(
+      polyline_count, 1,
+      [&](std::size_t begin, std::size_t end) {
+        PolylineSimplifier simplifier(tolerance, unit);
+        for (auto i = begin; i < end; ++i) {
+          counts[i] = simplifier.Simplify(method, points + offsets[i],
+                                          offsets[i + 1] - offsets[i],
+                                          output + offsets[i]);
+        }
+      },
+      thread_count);
+}
+
+StreamingSimplifier::StreamingSimplifier(const Distance& tolerance,
+                                         std::size_t window_capacity,
+                                         Distance::Type unit)
+    : tolerance_(tolerance.GetValue(unit)), window_capacity_(window_capacity) {
+  if (window_capacity < kMinWindowCapacity) {
+    throw std::invalid_argument("window capacity is less than 2");
+  }
+  window_.reserve(window_capacity);
+}
+
+auto StreamingSimplifier::Push(const Point2D& point, Point2D* output)
+    -> std::size_t {
+  if (window_.empty()) {
+    window_.push_back(point);
+    *output = point;
+    return 1;
+  }
+
+  const auto kToleranceSquared{tolerance_ * tolerance_};
+  const auto& kAnchor{window_.front()};
+  bool fits{window_.size() < window_capacity_};
+  for (std::size_t i = 1; fits && i < window_.size(); ++i) {
+    fits = CalculateSegmentDistanceSquared(
+               window_[i].GetX(), window_[i].GetY(), kAnchor.GetX(),
+               kAnchor.GetY(), point.GetX(), point.GetY()) <=
+           kToleranceSquared;
+  }
+  if (fits) {
+    window_.push_back(point);
+    return 0;
+  }
+
+  const auto kEmitted{window_.back()};
+  *output = kEmitted;
+  window_.clear();
+  window_.push_back(kEmitted);
+  window_.push_back(point);
+  return 1;
+}
+
+auto StreamingSimplifier::Finish(Point2D* output) -> std::size_t {
+  std::size_t result{0};
+  if (window_.size() >= 2U) {
+    *output = window_.back();
+    result = 1;
+  }
+  window_.clear();
+  return result;
+}
+}  // namespace zozibush::geometry
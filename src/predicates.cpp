@@ -0,0 +1,489 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/predicates.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+#include "geometry/parallel.hpp"
+#include "geometry/tuning.hpp"
+
+namespace {
+using zozibush::geometry::internal::kHalfEpsilon;
+
+// 2^27 + 1, splits a double into two halves of 26 significant bits.
+constexpr double kSplitter{134217729.0};
+// Error bounds of the adaptive stages, from Shewchuk's predicates.c.
+constexpr double kResultErrorBound{(3.0 + 8.0 * kHalfEpsilon) * kHalfEpsilon};
+constexpr double kOrientErrorBoundB{(2.0 + 12.0 * kHalfEpsilon) *
+                                    kHalfEpsilon};
+constexpr double kOrientErrorBoundC{(9.0 + 64.0 * kHalfEpsilon) *
+                                    kHalfEpsilon * kHalfEpsilon};
+constexpr double kInCircleErrorBoundB{(4.0 + 48.0 * kHalfEpsilon) *
+                                      kHalfEpsilon};
+constexpr double kInCircleErrorBoundC{(44.0 + 576.0 * kHalfEpsilon) *
+                                      kHalfEpsilon * kHalfEpsilon};
+// A block of filtered determinants stays in L1.
+constexpr std::size_t kBlockSize{256};
+
+// Nonoverlapping sequence of doubles in increasing magnitude whose exact sum
+// is the represented value (Shewchuk, "Adaptive Precision Floating-Point
+// Arithmetic and Fast Robust Geometric Predicates"). Zero components are
+// dropped, so the last component carries the sign.
+template <std::size_t N>
+struct Expansion {
+  std::array<double, N> components{};
+  std::size_t size{0};
+
+  [[nodiscard]] auto Sign() const -> double { return components[size - 1]; }
+  // Rounded sum, with the sign of the exact value.
+  [[nodiscard]] auto Estimate() const -> double {
+    double sum{0.0};
+    for (std::size_t i = 0; i < size; ++i) {
+      sum += components[i];
+    }
+    return sum;
+  }
+};
+
+auto FastTwoSum(double lhs, double rhs, double& sum, double& error) -> void {
+  sum = lhs + rhs;
+  const auto kVirtual{sum - lhs};
+  error = rhs - kVirtual;
+}
+
+auto TwoSum(double lhs, double rhs, double& sum, double& error) -> void {
+  sum = lhs + rhs;
+  const auto kVirtualRhs{sum - lhs};
+  const auto kVirtualLhs{sum - kVirtualRhs};
+  error = (lhs - kVirtualLhs) + (rhs - kVirtualRhs);
+}
+
+auto Split(double value, double& high, double& low) -> void {
+  const auto kScaled{kSplitter * value};
+  high = kScaled - (kScaled - value);
+  low = value - high;
+}
+
+auto TwoProduct(double lhs, double rhs, double& product, double& error)
+    -> void {
+  product = lhs * rhs;
+  double lhs_high{0.0};
+  double lhs_low{0.0};
+  double rhs_high{0.0};
+  double rhs_low{0.0};
+  Split(lhs, lhs_high, lhs_low);
+  Split(rhs, rhs_high, rhs_low);
+  error = lhs_low * rhs_low - (((product - lhs_high * rhs_high) -
+                                lhs_low * rhs_high) -
+                               lhs_high * rhs_low);
+}
+
+auto Product(double lhs, double rhs) -> Expansion<2> {
+  Expansion<2> result;
+  TwoProduct(lhs, rhs, result.components[1], result.components[0]);
+  result.size = 2;
+  return result;
+}
+
+template <std::size_t N>
+auto Negate(Expansion<N> value) -> Expansion<N> {
+  for (std::size_t i = 0; i < value.size; ++i) {
+    value.components[i] = -value.components[i];
+  }
+  return value;
+}
+
+// fast_expansion_sum_zeroelim; relies on round-to-nearest-even.
+template <std::size_t N, std::size_t M>
+auto Sum(const Expansion<N>& lhs, const Expansion<M>& rhs)
+    -> Expansion<N + M> {
+  Expansion<N + M> result;
+  std::size_t lhs_index{0};
+  std::size_t rhs_index{0};
+  // Merges both inputs by increasing magnitude.
+  auto next = [&]() -> double {
+    if (lhs_index == lhs.size) {
+      return rhs.components[rhs_index++];
+    }
+    if (rhs_index == rhs.size) {
+      return lhs.components[lhs_index++];
+    }
+    const auto kLhs{lhs.components[lhs_index]};
+    const auto kRhs{rhs.components[rhs_index]};
+    if ((kRhs > kLhs) == (kRhs > -kLhs)) {
+      ++lhs_index;
+      return kLhs;
+    }
+    ++rhs_index;
+    return kRhs;
+  };
+  auto push = [&](double component) {
+    if (component != 0.0) {
+      result.components[result.size++] = component;
+    }
+  };
+
+  auto accumulated{next()};
+  double sum{0.0};
+  double error{0.0};
+  if (lhs_index < lhs.size && rhs_index < rhs.size) {
+    FastTwoSum(next(), accumulated, sum, error);
+    accumulated = sum;
+    push(error);
+  }
+  while (lhs_index < lhs.size || rhs_index < rhs.size) {
+    TwoSum(accumulated, next(), sum, error);
+    accumulated = sum;
+    push(error);
+  }
+  if (accumulated != 0.0 || result.size == 0) {
+    result.components[result.size++] = accumulated;
+  }
+  return result;
+}
+
+// scale_expansion_zeroelim
+template <std::size_t N>
+auto Scale(const Expansion<N>& value, double scale) -> Expansion<2 * N> {
+  Expansion<2 * N> result;
+  auto push = [&](double component) {
+    if (component != 0.0) {
+      result.components[result.size++] = component;
+    }
+  };
+
+  double accumulated{0.0};
+  double error{0.0};
+  TwoProduct(value.components[0], scale, accumulated, error);
+  push(error);
+  for (std::size_t i = 1; i < value.size; ++i) {
+    double product{0.0};
+    double product_error{0.0};
+    double sum{0.0};
+    TwoProduct(value.components[i], scale, product, product_error);
+    TwoSum(accumulated, product_error, sum, error);
+    push(error);
+    FastTwoSum(product, sum, accumulated, error);
+    push(error);
+  }
+  if (accumulated != 0.0 || result.size == 0) {
+    result.components[result.size++] = accumulated;
+  }
+  return result;
+}
+
+// lhs_x * rhs_y - rhs_x * lhs_y
+auto Cross(double lhs_x, double lhs_y, double rhs_x, double rhs_y)
+    -> Expansion<4> {
+  return Sum(Product(lhs_x, rhs_y), Product(-rhs_x, lhs_y));
+}
+
+// (a - b) * value, with the difference kept exact
+template <std::size_t N>
+auto ScaleDifference(const Expansion<N>& value, double lhs, double rhs)
+    -> Expansion<4 * N> {
+  double difference{0.0};
+  double error{0.0};
+  TwoSum(lhs, -rhs, difference, error);
+  return Sum(Scale(value, error), Scale(value, difference));
+}
+
+// Orientation determinant of abc as an expansion
+auto Orient(double ax, double ay, double bx, double by, double cx, double cy)
+    -> Expansion<12> {
+  // ab + bc + ca on raw coordinates, so no rounded difference is involved.
+  return Sum(Sum(Cross(ax, ay, bx, by), Cross(bx, by, cx, cy)),
+             Cross(cx, cy, ax, ay));
+}
+
+// determinant * (x * x + y * y)
+template <std::size_t N>
+auto Lift(const Expansion<N>& determinant, double input_x, double input_y)
+    -> Expansion<8 * N> {
+  return Sum(Scale(Scale(determinant, input_x), input_x),
+             Scale(Scale(determinant, input_y), input_y));
+}
+
+auto ToSign(double value) -> int8_t {
+  return static_cast<int8_t>((value > 0.0) - (value < 0.0));
+}
+
+// Runs filter(x, y, determinant, permanent) over a block of points in a loop
+// without branches, so it vectorizes, then decide(index, determinant,
+// permanent) point by point.
+template <typename Filter, typename Decide>
+auto ForEachBlock(const zozibush::geometry::PointCloud<2, double>& points,
+                  std::size_t thread_count, const Filter& filter,
+                  const Decide& decide) -> void {
+  const auto* x_values{points.Data(0)};
+  const auto* y_values{points.Data(1)};
+  zozibush::geometry::ParallelFor(
+      points.Size(), zozibush::geometry::GetTuningParameters().predicate_grain,
+      [&](std::size_t begin, std::size_t end) {
+        std::array<double, kBlockSize> determinants{};
+        std::array<double, kBlockSize> permanents{};
+        for (auto offset = begin; offset < end; offset += kBlockSize) {
+          const auto kCount{std::min(kBlockSize, end - offset)};
+          for (std::size_t i = 0; i < kCount; ++i) {
+            filter(x_values[offset + i], y_values[offset + i],
+                   determinants[i], permanents[i]);
+          }
+          for (std::size_t i = 0; i < kCount; ++i) {
+            decide(offset + i, determinants[i], permanents[i]);
+          }
+        }
+      },
+      thread_count);
+}
+
+// Calls store(index, sign) with the sign of Orient2D(a, b, point).
+template <typename Store>
+auto ForEachOrientation(const zozibush::geometry::Point2D& a,
+                        const zozibush::geometry::Point2D& b,
+                        const zozibush::geometry::PointCloud<2, double>& points,
+                        std::size_t thread_count, const Store& store) -> void {
+  const auto kAx{a.GetX()};
+  const auto kAy{a.GetY()};
+  const auto kBx{b.GetX()};
+  const auto kBy{b.GetY()};
+  const auto* x_values{points.Data(0)};
+  const auto* y_values{points.Data(1)};
+  ForEachBlock(
+      points, thread_count,
+      [&](double x, double y, double& determinant, double& permanent) {
+        const auto kLeft{(kAx - x) * (kBy - y)};
+        const auto kRight{(kAy - y) * (kBx - x)};
+        determinant = kLeft - kRight;
+        permanent = std::abs(kLeft) + std::abs(kRight);
+      },
+      [&](std::size_t index, double determinant, double permanent) {
+        const auto kBound{zozibush::geometry::internal::kOrientErrorBound *
+                          permanent};
+        if (!(determinant >= kBound || -determinant >= kBound)) {
+          determinant = zozibush::geometry::internal::Orient2DAdaptive(
+              kAx, kAy, kBx, kBy, x_values[index], y_values[index],
+              permanent);
+        }
+        store(index, ToSign(determinant));
+      });
+}
+}  // namespace
+
+namespace zozibush::geometry {
+namespace internal {
+auto Orient2DAdaptive(double ax, double ay, double bx, double by, double cx,
+                      double cy, double permanent) -> double {
+  double acx{0.0};
+  double acy{0.0};
+  double bcx{0.0};
+  double bcy{0.0};
+  double acx_tail{0.0};
+  double acy_tail{0.0};
+  double bcx_tail{0.0};
+  double bcy_tail{0.0};
+  TwoSum(ax, -cx, acx, acx_tail);
+  TwoSum(ay, -cy, acy, acy_tail);
+  TwoSum(bx, -cx, bcx, bcx_tail);
+  TwoSum(by, -cy, bcy, bcy_tail);
+
+  // Exact determinant of the rounded differences.
+  auto determinant{Cross(acx, acy, bcx, bcy).Estimate()};
+  auto bound{kOrientErrorBoundB * permanent};
+  if (determinant >= bound || -determinant >= bound) {
+    return determinant;
+  }
+  if (acx_tail == 0.0 && acy_tail == 0.0 && bcx_tail == 0.0 &&
+      bcy_tail == 0.0) {
+    return determinant;
+  }
+
+  // First order correction for the rounding of the differences.
+  bound = kOrientErrorBoundC * permanent +
+          kResultErrorBound * std::abs(determinant);
+  determinant += (acx * bcy_tail + bcy * acx_tail) -
+                 (acy * bcx_tail + bcx * acy_tail);
+  if (determinant >= bound || -determinant >= bound) {
+    return determinant;
+  }
+  return Orient2DExact(ax, ay, bx, by, cx, cy);
+}
+
+auto InCircleAdaptive(double ax, double ay, double bx, double by, double cx,
+                      double cy, double dx, double dy, double permanent)
+    -> double {
+  double adx{0.0};
+  double ady{0.0};
+  double bdx{0.0};
+  double bdy{0.0};
+  double cdx{0.0};
+  double cdy{0.0};
+  double adx_tail{0.0};
+  double ady_tail{0.0};
+  double bdx_tail{0.0};
+  double bdy_tail{0.0};
+  double cdx_tail{0.0};
+  double cdy_tail{0.0};
+  TwoSum(ax, -dx, adx, adx_tail);
+  TwoSum(ay, -dy, ady, ady_tail);
+  TwoSum(bx, -dx, bdx, bdx_tail);
+  TwoSum(by, -dy, bdy, bdy_tail);
+  TwoSum(cx, -dx, cdx, cdx_tail);
+  TwoSum(cy, -dy, cdy, cdy_tail);
+
+  // Exact determinant of the rounded differences.
+  auto determinant{Sum(Sum(Lift(Cross(bdx, bdy, cdx, cdy), adx, ady),
+                           Lift(Cross(cdx, cdy, adx, ady), bdx, bdy)),
+                       Lift(Cross(adx, ady, bdx, bdy), cdx, cdy))
+                       .Estimate()};
+  auto bound{kInCircleErrorBoundB * permanent};
+  if (determinant >= bound || -determinant >= bound) {
+    return determinant;
+  }
+  if (adx_tail == 0.0 && ady_tail == 0.0 && bdx_tail == 0.0 &&
+      bdy_tail == 0.0 && cdx_tail == 0.0 && cdy_tail == 0.0) {
+    return determinant;
+  }
+
+  // First order correction for the rounding of the differences.
+  bound = kInCircleErrorBoundC * permanent +
+          kResultErrorBound * std::abs(determinant);
+  determinant +=
+      ((adx * adx + ady * ady) * ((bdx * cdy_tail + cdy * bdx_tail) -
+                                  (bdy * cdx_tail + cdx * bdy_tail)) +
+       2.0 * (adx * adx_tail + ady * ady_tail) * (bdx * cdy - bdy * cdx)) +
+      ((bdx * bdx + bdy * bdy) * ((cdx * ady_tail + ady * cdx_tail) -
+                                  (cdy * adx_tail + adx * cdy_tail)) +
+       2.0 * (bdx * bdx_tail + bdy * bdy_tail) * (cdx * ady - cdy * adx)) +
+      ((cdx * cdx + cdy * cdy) * ((adx * bdy_tail + bdy * adx_tail) -
+                                  (ady * bdx_tail + bdx * ady_tail)) +
+       2.0 * (cdx * cdx_tail + cdy * cdy_tail) * (adx * bdy - ady * bdx));
+  if (determinant >= bound || -determinant >= bound) {
+    return determinant;
+  }
+  return InCircleExact(ax, ay, bx, by, cx, cy, dx, dy);
+}
+
+auto Orient2DExact(double ax, double ay, double bx, double by, double cx,
+                   double cy) -> double {
+  return Orient(ax, ay, bx, by, cx, cy).Sign();
+}
+
+auto InCircleExact(double ax, double ay, double bx, double by, double cx,
+                   double cy, double dx, double dy) -> double {
+  const auto kAb{Cross(ax, ay, bx, by)};
+  const auto kBc{Cross(bx, by, cx, cy)};
+  const auto kCd{Cross(cx, cy, dx, dy)};
+  const auto kDa{Cross(dx, dy, ax, ay)};
+  const auto kAc{Cross(ax, ay, cx, cy)};
+  const auto kBd{Cross(bx, by, dx, dy)};
+
+  // Orientation determinants of the point triples left after removing one.
+  const auto kBcd{Sum(Sum(kBc, kCd), Negate(kBd))};
+  const auto kCda{Sum(Sum(kCd, kDa), kAc)};
+  const auto kDab{Sum(Sum(kDa, kAb), kBd)};
+  const auto kAbc{Sum(Sum(kAb, kBc), Negate(kAc))};
+
+  return Sum(Sum(Lift(kBcd, ax, ay), Negate(Lift(kCda, bx, by))),
+             Sum(Lift(kDab, cx, cy), Negate(Lift(kAbc, dx, dy))))
+      .Sign();
+}
+
+auto CompareCrossing(double ax, double ay, double bx, double by, double cx,
+                     double cy, double dx, double dy, double px, double py)
+    -> double {
+  // With A = orient(c, d, a) and B = orient(c, d, b), the crossing is
+  // a + (b - a) * A / (A - B), so crossing - p has the sign of
+  // ((b - p) * A - (a - p) * B) * (A - B), and A - B has the sign of A.
+  const auto kA{Orient(cx, cy, dx, dy, ax, ay)};
+  const auto kB{Orient(cx, cy, dx, dy, bx, by)};
+  const auto kSign{kA.Sign() > 0.0 ? 1.0 : -1.0};
+  const auto kX{Sum(ScaleDifference(kA, bx, px),
+                    Negate(ScaleDifference(kB, ax, px)))
+                    .Sign()};
+  if (kX != 0.0) {
+    return kX * kSign;
+  }
+  return Sum(ScaleDifference(kA, by, py), Negate(ScaleDifference(kB, ay, py)))
+             .Sign() *
+         kSign;
+}
+}  // namespace internal
+
+auto Orient2D(const Point2D& a, const Point2D& b,
+              const PointCloud<2, double>& points, int8_t* signs,
+              std::size_t thread_count) -> void {
+  ForEachOrientation(a, b, points, thread_count,
+                     [signs](std::size_t index, int8_t sign) {
+                       signs[index] = sign;
+                     });
+}
+
+auto InCircle(const Point2D& a, const Point2D& b, const Point2D& c,
+              const PointCloud<2, double>& points, int8_t* signs,
+              std::size_t thread_count) -> void {
+  const auto kAx{a.GetX()};
+  const auto kAy{a.GetY()};
+  const auto kBx{b.GetX()};
+  const auto kBy{b.GetY()};
+  const auto kCx{c.GetX()};
+  const auto kCy{c.GetY()};
+  const auto* x_values{points.Data(0)};
+  const auto* y_values{points.Data(1)};
+  ForEachBlock(
+      points, thread_count,
+      [&](double x, double y, double& determinant, double& permanent) {
+        const auto kAdx{kAx - x};
+        const auto kAdy{kAy - y};
+        const auto kBdx{kBx - x};
+        const auto kBdy{kBy - y};
+        const auto kCdx{kCx - x};
+        const auto kCdy{kCy - y};
+        const auto kBdxCdy{kBdx * kCdy};
+        const auto kCdxBdy{kCdx * kBdy};
+        const auto kALift{kAdx * kAdx + kAdy * kAdy};
+        const auto kCdxAdy{kCdx * kAdy};
+        const auto kAdxCdy{kAdx * kCdy};
+        const auto kBLift{kBdx * kBdx + kBdy * kBdy};
+        const auto kAdxBdy{kAdx * kBdy};
+        const auto kBdxAdy{kBdx * kAdy};
+        const auto kCLift{kCdx * kCdx + kCdy * kCdy};
+        determinant = kALift * (kBdxCdy - kCdxBdy) +
+                      kBLift * (kCdxAdy - kAdxCdy) +
+                      kCLift * (kAdxBdy - kBdxAdy);
+        permanent = (std::abs(kBdxCdy) + std::abs(kCdxBdy)) * kALift +
+                    (std::abs(kCdxAdy) + std::abs(kAdxCdy)) * kBLift +
+                    (std::abs(kAdxBdy) + std::abs(kBdxAdy)) * kCLift;
+      },
+      [&](std::size_t index, double determinant, double permanent) {
+        const auto kBound{internal::kInCircleErrorBound * permanent};
+        if (!(determinant > kBound || -determinant > kBound)) {
+          determinant = internal::InCircleAdaptive(
+              kAx, kAy, kBx, kBy, kCx, kCy, x_values[index], y_values[index],
+              permanent);
+        }
+        signs[index] = ToSign(determinant);
+      });
+}
+
+auto GetSegmentSide(const Point2D& a, const Point2D& b,
+                    const PointCloud<2, double>& points, SegmentSide* sides,
+                    std::size_t thread_count) -> void {
+  const auto* x_values{points.Data(0)};
+  const auto* y_values{points.Data(1)};
+  ForEachOrientation(
+      a, b, points, thread_count, [&](std::size_t index, int8_t sign) {
+        if (sign > 0) {
+          sides[index] = SegmentSide::kLeft;
+        } else if (sign < 0) {
+          sides[index] = SegmentSide::kRight;
+        } else {
+          sides[index] = GetSegmentSide(a, b,
+                                        {x_values[index], y_values[index]});
+        }
+      });
+}
+}  // namespace zozibush::geometry
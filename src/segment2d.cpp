@@ -0,0 +1,124 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/segment2d.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "geometry/predicates.hpp"
+
+namespace {
+auto IsLess(double ax, double ay, double bx, double by) -> bool {
+  return ax < bx || (ax == bx && ay < by);
+}
+auto HasSameSign(double lhs, double rhs) -> bool {
+  return (lhs > 0.0 && rhs > 0.0) || (lhs < 0.0 && rhs < 0.0);
+}
+}  // namespace
+
+namespace zozibush::geometry {
+namespace internal {
+auto IntersectSegments(double ax, double ay, double bx, double by, double cx,
+                       double cy, double dx, double dy, double& point_x,
+                       double& point_y) -> bool {
+  const auto kC{Orient2D(ax, ay, bx, by, cx, cy)};
+  const auto kD{Orient2D(ax, ay, bx, by, dx, dy)};
+  if (HasSameSign(kC, kD)) {
+    return false;
+  }
+  const auto kA{Orient2D(cx, cy, dx, dy, ax, ay)};
+  const auto kB{Orient2D(cx, cy, dx, dy, bx, by)};
+  if (HasSameSign(kA, kB)) {
+    return false;
+  }
+
+  if (kA == 0.0 && kB == 0.0 && kC == 0.0 && kD == 0.0) {
+    // Collinear, points included: along the line the lexicographic order is
+    // the order of the points, so compare the two ranges.
+    if (IsLess(bx, by, ax, ay)) {
+      std::swap(ax, bx);
+      std::swap(ay, by);
+    }
+    if (IsLess(dx, dy, cx, cy)) {
+      std::swap(cx, dx);
+      std::swap(cy, dy);
+    }
+    if (IsLess(ax, ay, cx, cy)) {
+      ax = cx;
+      ay = cy;
+    }
+    if (IsLess(dx, dy, bx, by)) {
+      bx = dx;
+      by = dy;
+    }
+    if (IsLess(bx, by, ax, ay)) {
+      return false;
+    }
+    point_x = ax;
+    point_y = ay;
+    return true;
+  }
+
+  // The lines are not the same, so an endpoint on the other line is the
+  // only shared point.
+  if (kA == 0.0) {
+    point_x = ax;
+    point_y = ay;
+  } else if (kB == 0.0) {
+    point_x = bx;
+    point_y = by;
+  } else if (kC == 0.0) {
+    point_x = cx;
+    point_y = cy;
+  } else if (kD == 0.0) {
+    point_x = dx;
+    point_y = dy;
+  } else {
+    // kA and kB are proportional to the distances of a and b from line cd.
+    const auto kDenominator{kA - kB};
+    point_x = std::clamp((bx * kA - ax * kB) / kDenominator,
+                         std::max(std::min(ax, bx), std::min(cx, dx)),
+                         std::min(std::max(ax, bx), std::max(cx, dx)));
+    point_y = std::clamp((by * kA - ay * kB) / kDenominator,
+                         std::max(std::min(ay, by), std::min(cy, dy)),
+                         std::min(std::max(ay, by), std::max(cy, dy)));
+  }
+  return true;
+}
+}  // namespace internal
+
+Segment2D::Segment2D(const Point2D& start, const Point2D& end)
+    : start_(start), end_(end) {}
+
+auto Segment2D::GetStart() const -> const Point2D& { return start_; }
+auto Segment2D::GetEnd() const -> const Point2D& { return end_; }
+auto Segment2D::CalculateLength() const -> double {
+  return start_.CalculateDistance(end_);
+}
+
+auto Segment2D::Intersects(const Segment2D& other) const -> bool {
+  Point2D point;
+  return Intersect(other, point);
+}
+auto Segment2D::Intersect(const Segment2D& other, Point2D& point) const
+    -> bool {
+  double point_x{0.0};
+  double point_y{0.0};
+  if (!internal::IntersectSegments(start_.GetX(), start_.GetY(), end_.GetX(),
+                                   end_.GetY(), other.start_.GetX(),
+                                   other.start_.GetY(), other.end_.GetX(),
+                                   other.end_.GetY(), point_x, point_y)) {
+    return false;
+  }
+  point = Point2D(point_x, point_y);
+  return true;
+}
+
+auto Segment2D::operator==(const Segment2D& other) const -> bool {
+  return start_ == other.start_ && end_ == other.end_;
+}
+auto Segment2D::operator!=(const Segment2D& other) const -> bool {
+  return !(*this == other);
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,702 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/segment_intersector.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <set>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "geometry/parallel.hpp"
+#include "geometry/predicates.hpp"
+
+namespace {
+using zozibush::geometry::Orient2D;
+
+constexpr uint32_t kEndEvent{1};
+constexpr std::size_t kSegmentsPerCell{1024};
+constexpr std::size_t kMaxCellsPerAxis{256};
+
+struct SegmentArrays {
+  const double* start_x;
+  const double* start_y;
+  const double* end_x;
+  const double* end_y;
+};
+
+auto IsLess(double ax, double ay, double bx, double by) -> bool {
+  return ax < bx || (ax == bx && ay < by);
+}
+
+// Sweep order: by point, ends before starts, then by segment. A zero-length
+// segment ends after the starts at its point, so it is inserted first.
+auto SortEvents(const SegmentArrays& segments, uint32_t segment_count)
+    -> std::vector<uint32_t> {
+  std::vector<uint32_t> result(std::size_t{segment_count} * 2);
+  std::iota(result.begin(), result.end(), 0U);
+  const auto kGetX{[&](uint32_t event) {
+    return (event & kEndEvent) ? segments.end_x[event >> 1]
+                               : segments.start_x[event >> 1];
+  }};
+  const auto kGetY{[&](uint32_t event) {
+    return (event & kEndEvent) ? segments.end_y[event >> 1]
+                               : segments.start_y[event >> 1];
+  }};
+  const auto kGetRank{[&](uint32_t event) {
+    const auto kSegment{event >> 1};
+    if (!(event & kEndEvent)) {
+      return 1;
+    }
+    return (segments.start_x[kSegment] == segments.end_x[kSegment] &&
+            segments.start_y[kSegment] == segments.end_y[kSegment])
+               ? 2
+               : 0;
+  }};
+  std::sort(result.begin(), result.end(), [&](uint32_t lhs, uint32_t rhs) {
+    const auto kLhsX{kGetX(lhs)};
+    const auto kRhsX{kGetX(rhs)};
+    if (kLhsX != kRhsX) {
+      return kLhsX < kRhsX;
+    }
+    const auto kLhsY{kGetY(lhs)};
+    const auto kRhsY{kGetY(rhs)};
+    if (kLhsY != kRhsY) {
+      return kLhsY < kRhsY;
+    }
+    const auto kLhsRank{kGetRank(lhs)};
+    const auto kRhsRank{kGetRank(rhs)};
+    return (kLhsRank != kRhsRank) ? kLhsRank < kRhsRank : lhs < rhs;
+  });
+  return result;
+}
+
+// Whether segment lhs is below segment rhs on the sweep line through the
+// start of whichever started last; exact, collinear ties go by index.
+auto IsBelow(const SegmentArrays& segments, uint32_t lhs, uint32_t rhs)
+    -> bool {
+  if (lhs == rhs) {
+    return false;
+  }
+  if (IsLess(segments.start_x[lhs], segments.start_y[lhs],
+             segments.start_x[rhs], segments.start_y[rhs])) {
+    return !IsBelow(segments, rhs, lhs);
+  }
+  const auto kSide{Orient2D(segments.start_x[rhs], segments.start_y[rhs],
+                            segments.end_x[rhs], segments.end_y[rhs],
+                            segments.start_x[lhs], segments.start_y[lhs])};
+  if (kSide != 0.0) {
+    return kSide < 0.0;
+  }
+  const auto kDirection{Orient2D(
+      segments.start_x[rhs], segments.start_y[rhs], segments.end_x[rhs],
+      segments.end_y[rhs], segments.end_x[lhs], segments.end_y[lhs])};
+  if (kDirection != 0.0) {
+    return kDirection < 0.0;
+  }
+  return lhs < rhs;
+}
+
+// Closed interval widened after every operation by more than its rounding
+// error, so it always holds the exact result.
+struct Interval {
+  double low;
+  double high;
+};
+
+auto Widen(double low, double high) -> Interval {
+  constexpr double kRelative{std::numeric_limits<double>::epsilon() * 2.0};
+  constexpr double kAbsolute{std::numeric_limits<double>::min()};
+  return {low - (std::abs(low) * kRelative + kAbsolute),
+          high + (std::abs(high) * kRelative + kAbsolute)};
+}
+auto Subtract(const Interval& lhs, const Interval& rhs) -> Interval {
+  return Widen(lhs.low - rhs.high, lhs.high - rhs.low);
+}
+auto Multiply(const Interval& lhs, const Interval& rhs) -> Interval {
+  const std::array<double, 4> kProducts{lhs.low * rhs.low, lhs.low * rhs.high,
+                                        lhs.high * rhs.low,
+                                        lhs.high * rhs.high};
+  const auto [kMin, kMax] =
+      std::minmax_element(kProducts.begin(), kProducts.end());
+  return Widen(*kMin, *kMax);
+}
+// rhs must not contain 0.
+auto Divide(const Interval& lhs, const Interval& rhs) -> Interval {
+  const std::array<double, 4> kQuotients{lhs.low / rhs.low, lhs.low / rhs.high,
+                                         lhs.high / rhs.low,
+                                         lhs.high / rhs.high};
+  const auto [kMin, kMax] =
+      std::minmax_element(kQuotients.begin(), kQuotients.end());
+  return Widen(*kMin, *kMax);
+}
+
+// A pending swap of neighbours lower and upper where they cross. Its point
+// is only known within bounds; the rounded point orders crossings that are
+// due at the same event.
+struct Crossing {
+  Interval x;
+  Interval y;
+  double point_x;
+  double point_y;
+  uint32_t lower;
+  uint32_t upper;
+};
+
+struct LaterCrossing {
+  auto operator()(const Crossing& lhs, const Crossing& rhs) const -> bool {
+    if (lhs.x.low != rhs.x.low) {
+      return lhs.x.low > rhs.x.low;
+    }
+    return std::make_pair(lhs.lower, lhs.upper) >
+           std::make_pair(rhs.lower, rhs.upper);
+  }
+};
+
+// One Bentley-Ottmann sweep. report(first, second, x, y) is called once per
+// intersecting pair with first < second and returns false to stop.
+//
+// Events at one point run as: ends, crossings, starts. Crossing points are
+// rounded, so whether one comes before an event is decided on bounds of the
+// point and, when those straddle the event, by an exact predicate; the
+// status is then exactly ordered at every event point. An ending segment
+// and the segments it touches at that point are still neighbours when it
+// is removed; segments starting there are paired with the ended ones
+// explicitly. Segments through the event point are contiguous in the
+// status, so both walks stop at the first segment missing it.
+template <typename Function>
+class SweepLine {
+ public:
+  SweepLine(const SegmentArrays& segments, uint32_t segment_count,
+            Function& report)
+      : segments_(segments),
+        report_(report),
+        status_(Compare{&segments_}),
+        nodes_(segment_count, status_.end()) {}
+  SweepLine(const SweepLine&) = delete;
+  auto operator=(const SweepLine&) -> SweepLine& = delete;
+
+  // Returns false if report stopped the sweep.
+  auto Run(const std::vector<uint32_t>& events) -> bool {
+    for (const auto kEvent : events) {
+      const auto kX{GetX(kEvent)};
+      const auto kY{GetY(kEvent)};
+      const auto kSegment{kEvent >> 1};
+      const auto kIsEnd{(kEvent & kEndEvent) != 0};
+      // Crossings at the point itself go after the ends there.
+      const auto kHasLength{segments_.start_x[kSegment] != kX ||
+                            segments_.start_y[kSegment] != kY};
+      if (!ApplyCrossings(kX, kY, !(kIsEnd && kHasLength))) {
+        return false;
+      }
+      MoveTo(kX, kY);
+      if (!(kIsEnd ? Remove(kSegment) : Insert(kSegment))) {
+        return false;
+      }
+    }
+    constexpr auto kInfinity{std::numeric_limits<double>::infinity()};
+    return ApplyCrossings(kInfinity, kInfinity, true);
+  }
+
+ private:
+  struct Entry {
+    mutable uint32_t segment;  ///< Swapped in place at crossings
+  };
+  struct Compare {
+    const SegmentArrays* segments;
+    auto operator()(const Entry& lhs, const Entry& rhs) const -> bool {
+      return IsBelow(*segments, lhs.segment, rhs.segment);
+    }
+  };
+  using Status = std::set<Entry, Compare>;
+  using Node = typename Status::iterator;
+
+  [[nodiscard]] auto GetX(uint32_t event) const -> double {
+    return (event & kEndEvent) ? segments_.end_x[event >> 1]
+                               : segments_.start_x[event >> 1];
+  }
+  [[nodiscard]] auto GetY(uint32_t event) const -> double {
+    return (event & kEndEvent) ? segments_.end_y[event >> 1]
+                               : segments_.start_y[event >> 1];
+  }
+
+  auto MoveTo(double input_x, double input_y) -> void {
+    if (input_x != current_x_ || input_y != current_y_) {
+      current_x_ = input_x;
+      current_y_ = input_y;
+      ended_.clear();
+    }
+  }
+
+  [[nodiscard]] auto Contains(uint32_t segment) const -> bool {
+    const auto kStartX{segments_.start_x[segment]};
+    const auto kStartY{segments_.start_y[segment]};
+    const auto kEndX{segments_.end_x[segment]};
+    const auto kEndY{segments_.end_y[segment]};
+    return !IsLess(current_x_, current_y_, kStartX, kStartY) &&
+           !IsLess(kEndX, kEndY, current_x_, current_y_) &&
+           Orient2D(kStartX, kStartY, kEndX, kEndY, current_x_,
+                    current_y_) == 0.0;
+  }
+
+  // Lower is right below upper now; true if upper is below after they meet.
+  [[nodiscard]] auto NeedsSwap(uint32_t lower, uint32_t upper) const -> bool {
+    return Orient2D(segments_.start_x[upper], segments_.start_y[upper],
+                    segments_.end_x[upper], segments_.end_y[upper],
+                    segments_.end_x[lower], segments_.end_y[lower]) > 0.0;
+  }
+
+  auto Check(uint32_t lower, uint32_t upper) -> bool {
+    double point_x{0.0};
+    double point_y{0.0};
+    if (!zozibush::geometry::internal::IntersectSegments(
+            segments_.start_x[lower], segments_.start_y[lower],
+            segments_.end_x[lower], segments_.end_y[lower],
+            segments_.start_x[upper], segments_.start_y[upper],
+            segments_.end_x[upper], segments_.end_y[upper], point_x,
+            point_y)) {
+      return true;
+    }
+    if (NeedsSwap(lower, upper)) {
+      crossings_.push(BoundCrossing(lower, upper, point_x, point_y));
+    }
+
+    const auto kFirst{std::min(lower, upper)};
+    const auto kSecond{std::max(lower, upper)};
+    if (!reported_.insert((uint64_t{kFirst} << 32U) | kSecond).second) {
+      return true;
+    }
+    return report_(kFirst, kSecond, point_x, point_y);
+  }
+
+  // Checks node against its neighbours through the current point.
+  auto CheckThrough(Node node) -> bool {
+    for (auto above = std::next(node);
+         above != status_.end() && Contains(above->segment); ++above) {
+      if (!Check(node->segment, above->segment)) {
+        return false;
+      }
+    }
+    for (auto below = node; below != status_.begin();) {
+      --below;
+      if (!Contains(below->segment)) {
+        break;
+      }
+      if (!Check(below->segment, node->segment)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  auto Insert(uint32_t segment) -> bool {
+    const auto kNode{status_.insert(Entry{segment}).first};
+    nodes_[segment] = kNode;
+    for (const auto kEnded : ended_) {
+      if (!Check(kEnded, segment)) {
+        return false;
+      }
+    }
+    if (!CheckThrough(kNode)) {
+      return false;
+    }
+    const auto kAbove{std::next(kNode)};
+    if (kAbove != status_.end() && !Check(segment, kAbove->segment)) {
+      return false;
+    }
+    return kNode == status_.begin() ||
+           Check(std::prev(kNode)->segment, segment);
+  }
+
+  auto Remove(uint32_t segment) -> bool {
+    const auto kNode{nodes_[segment]};
+    if (!CheckThrough(kNode)) {
+      return false;
+    }
+    const auto kAbove{std::next(kNode)};
+    const auto kHasBelow{kNode != status_.begin()};
+    const auto kBelow{kHasBelow ? std::prev(kNode) : status_.end()};
+    status_.erase(kNode);
+    nodes_[segment] = status_.end();
+    ended_.push_back(segment);
+    return !kHasBelow || kAbove == status_.end() ||
+           Check(kBelow->segment, kAbove->segment);
+  }
+
+  [[nodiscard]] auto BoundCrossing(uint32_t lower, uint32_t upper,
+                                   double point_x, double point_y) const
+      -> Crossing {
+    const auto kAx{segments_.start_x[lower]};
+    const auto kAy{segments_.start_y[lower]};
+    const auto kBx{segments_.end_x[lower]};
+    const auto kBy{segments_.end_y[lower]};
+    const auto kCx{segments_.start_x[upper]};
+    const auto kCy{segments_.start_y[upper]};
+    const auto kDx{segments_.end_x[upper]};
+    const auto kDy{segments_.end_y[upper]};
+    Crossing result{{point_x, point_x}, {point_y, point_y}, point_x, point_y,
+                    lower, upper};
+    if (Orient2D(kAx, kAy, kBx, kBy, kCx, kCy) == 0.0 ||
+        Orient2D(kAx, kAy, kBx, kBy, kDx, kDy) == 0.0 ||
+        Orient2D(kCx, kCy, kDx, kDy, kAx, kAy) == 0.0 ||
+        Orient2D(kCx, kCy, kDx, kDy, kBx, kBy) == 0.0) {
+      // An endpoint on the other segment, found exactly.
+      return result;
+    }
+
+    // Both bounding boxes hold the crossing.
+    result.x = {std::max(std::min(kAx, kBx), std::min(kCx, kDx)),
+                std::min(std::max(kAx, kBx), std::max(kCx, kDx))};
+    result.y = {std::max(std::min(kAy, kBy), std::min(kCy, kDy)),
+                std::min(std::max(kAy, kBy), std::max(kCy, kDy))};
+    // Tighter: a + (b - a) * A / (A - B) with A, B the orientations of a
+    // and b against cd, in interval arithmetic.
+    const auto kOrient{[&](double input_x, double input_y) {
+      return Subtract(
+          Multiply(Widen(kCx - input_x, kCx - input_x),
+                   Widen(kDy - input_y, kDy - input_y)),
+          Multiply(Widen(kCy - input_y, kCy - input_y),
+                   Widen(kDx - input_x, kDx - input_x)));
+    }};
+    const auto kA{kOrient(kAx, kAy)};
+    const auto kB{kOrient(kBx, kBy)};
+    const auto kDenominator{Subtract(kA, kB)};
+    if (!(kDenominator.low > 0.0 || kDenominator.high < 0.0)) {
+      return result;
+    }
+    const auto kBound{[&](double a_value, double b_value, Interval& bounds) {
+      const auto kValue{Divide(
+          Subtract(Multiply({b_value, b_value}, kA),
+                   Multiply({a_value, a_value}, kB)),
+          kDenominator)};
+      if (std::isfinite(kValue.low) && std::isfinite(kValue.high)) {
+        bounds.low = std::max(bounds.low, kValue.low);
+        bounds.high = std::min(bounds.high, kValue.high);
+      }
+    }};
+    kBound(kAx, kBx, result.x);
+    kBound(kAy, kBy, result.y);
+    return result;
+  }
+
+  // Sign of crossing - (x, y) in lexicographic order, exact.
+  [[nodiscard]] auto CompareCrossing(const Crossing& crossing,
+                                     double input_x, double input_y) const
+      -> double {
+    if (crossing.x.high < input_x) {
+      return -1.0;
+    }
+    if (crossing.x.low > input_x) {
+      return 1.0;
+    }
+    if (crossing.x.low == crossing.x.high) {
+      if (crossing.y.high < input_y) {
+        return -1.0;
+      }
+      if (crossing.y.low > input_y) {
+        return 1.0;
+      }
+      if (crossing.y.low == crossing.y.high) {
+        return 0.0;
+      }
+    }
+    // Only proper crossings have wide bounds.
+    const auto kLower{crossing.lower};
+    const auto kUpper{crossing.upper};
+    return zozibush::geometry::internal::CompareCrossing(
+        segments_.start_x[kLower], segments_.start_y[kLower],
+        segments_.end_x[kLower], segments_.end_y[kLower],
+        segments_.start_x[kUpper], segments_.start_y[kUpper],
+        segments_.end_x[kUpper], segments_.end_y[kUpper], input_x, input_y);
+  }
+
+  // Swaps every pair crossing before (x, y), or at it if inclusive, so the
+  // status is exactly ordered there. Crossings due together run in rounded
+  // order; a swap found out of order is skipped and scheduled again once
+  // the pair is adjacent.
+  auto ApplyCrossings(double input_x, double input_y, bool inclusive)
+      -> bool {
+    deferred_.clear();
+    while (!crossings_.empty() && crossings_.top().x.low <= input_x) {
+      ready_.clear();
+      while (!crossings_.empty() && crossings_.top().x.low <= input_x) {
+        const auto& kCrossing{crossings_.top()};
+        const auto kSign{CompareCrossing(kCrossing, input_x, input_y)};
+        if (kSign < 0.0 || (inclusive && kSign == 0.0)) {
+          ready_.push_back(kCrossing);
+        } else {
+          deferred_.push_back(kCrossing);
+        }
+        crossings_.pop();
+      }
+      std::sort(ready_.begin(), ready_.end(),
+                [](const Crossing& lhs, const Crossing& rhs) {
+                  if (lhs.point_x != rhs.point_x) {
+                    return lhs.point_x < rhs.point_x;
+                  }
+                  if (lhs.point_y != rhs.point_y) {
+                    return lhs.point_y < rhs.point_y;
+                  }
+                  return std::make_pair(lhs.lower, lhs.upper) <
+                         std::make_pair(rhs.lower, rhs.upper);
+                });
+      for (const auto& kCrossing : ready_) {
+        if (!Swap(kCrossing.lower, kCrossing.upper)) {
+          return false;
+        }
+      }
+    }
+    for (const auto& kCrossing : deferred_) {
+      crossings_.push(kCrossing);
+    }
+    return true;
+  }
+
+  auto Swap(uint32_t lower, uint32_t upper) -> bool {
+    const auto kLowerNode{nodes_[lower]};
+    if (kLowerNode == status_.end() || nodes_[upper] == status_.end()) {
+      return true;
+    }
+    const auto kUpperNode{std::next(kLowerNode)};
+    if (kUpperNode == status_.end() || kUpperNode->segment != upper ||
+        !NeedsSwap(lower, upper)) {
+      // No longer neighbours or already swapped; rechecked when adjacent.
+      return true;
+    }
+    kLowerNode->segment = upper;
+    kUpperNode->segment = lower;
+    nodes_[upper] = kLowerNode;
+    nodes_[lower] = kUpperNode;
+
+    const auto kAbove{std::next(kUpperNode)};
+    if (kAbove != status_.end() && !Check(lower, kAbove->segment)) {
+      return false;
+    }
+    return kLowerNode == status_.begin() ||
+           Check(std::prev(kLowerNode)->segment, upper);
+  }
+
+  SegmentArrays segments_;
+  Function& report_;
+  Status status_;
+  std::vector<Node> nodes_;
+  std::priority_queue<Crossing, std::vector<Crossing>, LaterCrossing>
+      crossings_;
+  std::unordered_set<uint64_t> reported_;
+  std::vector<Crossing> ready_;
+  std::vector<Crossing> deferred_;
+  std::vector<uint32_t> ended_;
+  double current_x_{-std::numeric_limits<double>::infinity()};
+  double current_y_{-std::numeric_limits<double>::infinity()};
+};
+
+template <typename Function>
+auto Sweep(const SegmentArrays& segments, uint32_t segment_count,
+           const std::vector<uint32_t>& events, Function&& report) -> bool {
+  SweepLine<Function> sweep_line(segments, segment_count, report);
+  return sweep_line.Run(events);
+}
+
+struct Found {
+  uint32_t first;
+  uint32_t second;
+  double x;
+  double y;
+};
+}  // namespace
+
+namespace zozibush::geometry {
+SegmentIntersector::SegmentIntersector(const std::vector<Segment2D>& segments)
+    : start_x_(segments.size()),
+      start_y_(segments.size()),
+      end_x_(segments.size()),
+      end_y_(segments.size()) {
+  if (segments.size() > (std::numeric_limits<uint32_t>::max() >> 1)) {
+    throw std::length_error("too many segments for 32-bit events");
+  }
+  for (std::size_t i = 0; i < segments.size(); ++i) {
+    auto start{segments[i].GetStart()};
+    auto end{segments[i].GetEnd()};
+    if (!std::isfinite(start.GetX()) || !std::isfinite(start.GetY()) ||
+        !std::isfinite(end.GetX()) || !std::isfinite(end.GetY())) {
+      throw std::out_of_range("segment point is nan or inf");
+    }
+    if (IsLess(end.GetX(), end.GetY(), start.GetX(), start.GetY())) {
+      std::swap(start, end);
+    }
+    start_x_[i] = start.GetX();
+    start_y_[i] = start.GetY();
+    end_x_[i] = end.GetX();
+    end_y_[i] = end.GetY();
+  }
+  events_ = SortEvents(
+      {start_x_.data(), start_y_.data(), end_x_.data(), end_y_.data()},
+      static_cast<uint32_t>(segments.size()));
+}
+
+auto SegmentIntersector::GetSegmentCount() const -> std::size_t {
+  return start_x_.size();
+}
+
+auto SegmentIntersector::HasIntersection() const -> bool {
+  return !Sweep(
+      {start_x_.data(), start_y_.data(), end_x_.data(), end_y_.data()},
+      static_cast<uint32_t>(start_x_.size()), events_,
+      [](uint32_t /*first*/, uint32_t /*second*/, double /*x*/,
+         double /*y*/) { return false; });
+}
+
+auto SegmentIntersector::FindIntersections(uint32_t* pairs, Point2D* points,
+                                           std::size_t capacity) const
+    -> std::size_t {
+  std::size_t result{0};
+  Sweep({start_x_.data(), start_y_.data(), end_x_.data(), end_y_.data()},
+        static_cast<uint32_t>(start_x_.size()), events_,
+        [&](uint32_t first, uint32_t second, double point_x, double point_y) {
+          if (result < capacity) {
+            pairs[2 * result] = first;
+            pairs[2 * result + 1] = second;
+            if (points != nullptr) {
+              points[result] = Point2D(point_x, point_y);
+            }
+          }
+          ++result;
+          return true;
+        });
+  return result;
+}
+
+auto SegmentIntersector::FindIntersectionsParallel(
+    uint32_t* pairs, Point2D* points, std::size_t capacity,
+    std::size_t thread_count) const -> std::size_t {
+  const auto kCount{start_x_.size()};
+  const auto kCellsPerCount{static_cast<double>(kCount) /
+                            static_cast<double>(kSegmentsPerCell)};
+  const auto kCellsPerAxis{std::min(
+      kMaxCellsPerAxis,
+      static_cast<std::size_t>(std::sqrt(kCellsPerCount)))};
+  if (kCellsPerAxis < 2) {
+    return FindIntersections(pairs, points, capacity);
+  }
+
+  // Start points have the minimum x and end points the maximum.
+  const auto kMinX{*std::min_element(start_x_.begin(), start_x_.end())};
+  const auto kMaxX{*std::max_element(end_x_.begin(), end_x_.end())};
+  const auto kMinY{std::min(*std::min_element(start_y_.begin(), start_y_.end()),
+                            *std::min_element(end_y_.begin(), end_y_.end()))};
+  const auto kMaxY{std::max(*std::max_element(start_y_.begin(), start_y_.end()),
+                            *std::max_element(end_y_.begin(), end_y_.end()))};
+  const auto kCells{static_cast<double>(kCellsPerAxis)};
+  const auto kScaleX{(kMaxX > kMinX) ? kCells / (kMaxX - kMinX) : 0.0};
+  const auto kScaleY{(kMaxY > kMinY) ? kCells / (kMaxY - kMinY) : 0.0};
+  const auto kLast{kCellsPerAxis - 1};
+  const auto kGetColumn{[&](double input_x) {
+    return std::min(kLast,
+                    static_cast<std::size_t>((input_x - kMinX) * kScaleX));
+  }};
+  const auto kGetRow{[&](double input_y) {
+    return std::min(kLast,
+                    static_cast<std::size_t>((input_y - kMinY) * kScaleY));
+  }};
+
+  // Cell lists in CSR form, segments ascending within a cell.
+  const auto kCellCount{kCellsPerAxis * kCellsPerAxis};
+  std::vector<std::size_t> cell_offsets(kCellCount + 1, 0);
+  const auto kVisitCells{[&](std::size_t segment, const auto& visit) {
+    const auto kFirstRow{
+        kGetRow(std::min(start_y_[segment], end_y_[segment]))};
+    const auto kLastRow{kGetRow(std::max(start_y_[segment], end_y_[segment]))};
+    for (auto row = kFirstRow; row <= kLastRow; ++row) {
+      for (auto column = kGetColumn(start_x_[segment]);
+           column <= kGetColumn(end_x_[segment]); ++column) {
+        visit(row * kCellsPerAxis + column);
+      }
+    }
+  }};
+  for (std::size_t i = 0; i < kCount; ++i) {
+    kVisitCells(i, [&](std::size_t cell) { ++cell_offsets[cell + 1]; });
+  }
+  std::partial_sum(cell_offsets.begin(), cell_offsets.end(),
+                   cell_offsets.begin());
+  std::vector<uint32_t> cell_segments(cell_offsets.back());
+  {
+    auto cursor{cell_offsets};
+    for (std::size_t i = 0; i < kCount; ++i) {
+      kVisitCells(i, [&](std::size_t cell) {
+        cell_segments[cursor[cell]++] = static_cast<uint32_t>(i);
+      });
+    }
+  }
+
+  std::vector<std::vector<Found>> found(kCellCount);
+  ParallelFor(
+      kCellCount, 1,
+      [&](std::size_t begin, std::size_t end) {
+        std::vector<double> local_start_x;
+        std::vector<double> local_start_y;
+        std::vector<double> local_end_x;
+        std::vector<double> local_end_y;
+        for (auto cell = begin; cell < end; ++cell) {
+          const auto* kSegments{cell_segments.data() + cell_offsets[cell]};
+          const auto kLocalCount{
+              static_cast<uint32_t>(cell_offsets[cell + 1] -
+                                    cell_offsets[cell])};
+          local_start_x.resize(kLocalCount);
+          local_start_y.resize(kLocalCount);
+          local_end_x.resize(kLocalCount);
+          local_end_y.resize(kLocalCount);
+          for (uint32_t i = 0; i < kLocalCount; ++i) {
+            local_start_x[i] = start_x_[kSegments[i]];
+            local_start_y[i] = start_y_[kSegments[i]];
+            local_end_x[i] = end_x_[kSegments[i]];
+            local_end_y[i] = end_y_[kSegments[i]];
+          }
+          const SegmentArrays kLocal{local_start_x.data(),
+                                     local_start_y.data(), local_end_x.data(),
+                                     local_end_y.data()};
+          Sweep(kLocal, kLocalCount, SortEvents(kLocal, kLocalCount),
+                [&](uint32_t first, uint32_t second, double point_x,
+                    double point_y) {
+                  const auto kCornerX{
+                      std::max(local_start_x[first], local_start_x[second])};
+                  const auto kCornerY{std::max(
+                      std::min(local_start_y[first], local_end_y[first]),
+                      std::min(local_start_y[second], local_end_y[second]))};
+                  if (kGetRow(kCornerY) * kCellsPerAxis +
+                          kGetColumn(kCornerX) ==
+                      cell) {
+                    found[cell].push_back({kSegments[first],
+                                           kSegments[second], point_x,
+                                           point_y});
+                  }
+                  return true;
+                });
+        }
+      },
+      thread_count);
+
+  std::size_t result{0};
+  for (const auto& kCell : found) {
+    for (const auto& kFound : kCell) {
+      if (result < capacity) {
+        pairs[2 * result] = kFound.first;
+        pairs[2 * result + 1] = kFound.second;
+        if (points != nullptr) {
+          points[result] = Point2D(kFound.x, kFound.y);
+        }
+      }
+      ++result;
+    }
+  }
+  return result;
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,177 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/transform2d.hpp"
+
+#include <cmath>
+#include <type_traits>
+
+#include "geometry/parallel.hpp"
+#include "geometry/tuning.hpp"
+
+namespace {
+enum class Kind { kTranslation, kAxisAligned, kGeneral };
+
+// Elements copied to locals, so the compiler sees they do not alias the
+// output and keeps them in registers across the vectorized loop.
+struct Matrix {
+  double m00;
+  double m01;
+  double m02;
+  double m10;
+  double m11;
+  double m12;
+};
+
+auto GetMatrix(const zozibush::geometry::Transform2D& transform) -> Matrix {
+  return {transform.Get(0, 0), transform.Get(0, 1), transform.Get(0, 2),
+          transform.Get(1, 0), transform.Get(1, 1), transform.Get(1, 2)};
+}
+
+auto GetKind(const zozibush::geometry::Transform2D& transform) -> Kind {
+  if (transform.IsTranslation()) {
+    return Kind::kTranslation;
+  }
+  return transform.IsAxisAligned() ? Kind::kAxisAligned : Kind::kGeneral;
+}
+
+// Plain multiply-adds rather than std::fma: without FMA in the target ISA
+// std::fma is a library call, and rounding stays the same as Apply(Point2D).
+template <Kind kKind>
+auto MapX(const Matrix& m, double x, double y) -> double {
+  if constexpr (kKind == Kind::kTranslation) {
+    return x + m.m02;
+  } else if constexpr (kKind == Kind::kAxisAligned) {
+    return m.m00 * x + m.m02;
+  } else {
+    return m.m00 * x + m.m01 * y + m.m02;
+  }
+}
+
+template <Kind kKind>
+auto MapY(const Matrix& m, double x, double y) -> double {
+  if constexpr (kKind == Kind::kTranslation) {
+    return y + m.m12;
+  } else if constexpr (kKind == Kind::kAxisAligned) {
+    return m.m11 * y + m.m12;
+  } else {
+    return m.m10 * x + m.m11 * y + m.m12;
+  }
+}
+
+template <Kind kKind>
+auto MapPoints(const Matrix& m, const zozibush::geometry::Point2D* input,
+               zozibush::geometry::Point2D* output, std::size_t begin,
+               std::size_t end) -> void {
+  for (auto i = begin; i < end; ++i) {
+    const auto kX{input[i].GetX()};
+    const auto kY{input[i].GetY()};
+    output[i] = {MapX<kKind>(m, kX, kY), MapY<kKind>(m, kX, kY)};
+  }
+}
+
+// Separate x and y passes are unit-stride streams the loops vectorize.
+template <Kind kKind>
+auto MapCoordinates(const Matrix& m, const double* x_input,
+                    const double* y_input, double* x_output, double* y_output,
+                    std::size_t begin, std::size_t end) -> void {
+  if constexpr (kKind == Kind::kGeneral) {
+    // Both outputs read both inputs, so in place they need one pass.
+    for (auto i = begin; i < end; ++i) {
+      const auto kX{x_input[i]};
+      const auto kY{y_input[i]};
+      x_output[i] = MapX<kKind>(m, kX, kY);
+      y_output[i] = MapY<kKind>(m, kX, kY);
+    }
+  } else {
+    for (auto i = begin; i < end; ++i) {
+      x_output[i] = MapX<kKind>(m, x_input[i], 0.0);
+    }
+    for (auto i = begin; i < end; ++i) {
+      y_output[i] = MapY<kKind>(m, 0.0, y_input[i]);
+    }
+  }
+}
+
+template <typename Body>
+auto Dispatch(Kind kind, const Body& body) -> void {
+  switch (kind) {
+    case Kind::kTranslation:
+      body(std::integral_constant<Kind, Kind::kTranslation>());
+      break;
+    case Kind::kAxisAligned:
+      body(std::integral_constant<Kind, Kind::kAxisAligned>());
+      break;
+    default:
+      body(std::integral_constant<Kind, Kind::kGeneral>());
+      break;
+  }
+}
+}  // namespace
+
+namespace zozibush::geometry {
+auto Transform2D::Rotation(double radians) -> Transform2D {
+  const auto kCos{std::cos(radians)};
+  const auto kSin{std::sin(radians)};
+  return {kCos, -kSin, 0.0, kSin, kCos, 0.0};
+}
+
+auto Transform2D::Apply(const Point2D* input, std::size_t count,
+                        Point2D* output, std::size_t thread_count) const
+    -> void {
+  const auto kMatrix{GetMatrix(*this)};
+  Dispatch(GetKind(*this), [&](auto kind) {
+    ParallelFor(
+        count, GetTuningParameters().transform_grain,
+        [&](std::size_t begin, std::size_t end) {
+          MapPoints<decltype(kind)::value>(kMatrix, input, output, begin, end);
+        },
+        thread_count);
+  });
+}
+
+auto Transform2D::Apply(const PointCloud<2, double>& input,
+                        PointCloud<2, double>& output,
+                        std::size_t thread_count) const -> void {
+  if (&input == &output) {
+    ApplyInPlace(output, thread_count);
+    return;
+  }
+  output.Resize(input.Size());
+  const auto kMatrix{GetMatrix(*this)};
+  const auto* x_input{input.Data(0)};
+  const auto* y_input{input.Data(1)};
+  auto* x_output{output.Data(0)};
+  auto* y_output{output.Data(1)};
+  Dispatch(GetKind(*this), [&](auto kind) {
+    ParallelFor(
+        input.Size(), GetTuningParameters().transform_grain,
+        [&](std::size_t begin, std::size_t end) {
+          MapCoordinates<decltype(kind)::value>(
+              kMatrix, x_input, y_input, x_output, y_output, begin, end);
+        },
+        thread_count);
+  });
+}
+
+auto Transform2D::ApplyInPlace(Point2D* points, std::size_t count,
+                               std::size_t thread_count) const -> void {
+  Apply(points, count, points, thread_count);
+}
+
+auto Transform2D::ApplyInPlace(PointCloud<2, double>& points,
+                               std::size_t thread_count) const -> void {
+  const auto kMatrix{GetMatrix(*this)};
+  auto* x_points{points.Data(0)};
+  auto* y_points{points.Data(1)};
+  Dispatch(GetKind(*this), [&](auto kind) {
+    ParallelFor(
+        points.Size(), GetTuningParameters().transform_grain,
+        [&](std::size_t begin, std::size_t end) {
+          MapCoordinates<decltype(kind)::value>(
+              kMatrix, x_points, y_points, x_points, y_points, begin, end);
+        },
+        thread_count);
+  });
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,382 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/tuning.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "geometry/distance_selection.hpp"
+#include "geometry/grid_index.hpp"
+#include "geometry/parallel.hpp"
+#include "geometry/point_cloud.hpp"
+#include "geometry/polygon2d.hpp"
+#include "geometry/predicates.hpp"
+#include "geometry/transform2d.hpp"
+
+namespace {
+using zozibush::geometry::TuningParameters;
+
+constexpr std::size_t kCalibrationPoints{16384};
+constexpr std::size_t kRepetitions{3};
+constexpr std::size_t kThreadStartSamples{15};
+constexpr double kStartsPerRange{4.0};
+constexpr std::size_t kMinGrain{64};
+constexpr std::size_t kMaxGrain{std::size_t{1} << 20U};
+constexpr std::size_t kMaskBits{64};
+constexpr std::size_t kPolygonVertices{32};
+constexpr double kPi{3.14159265358979323846};
+constexpr std::string_view kCacheVersion{"v2"};
+constexpr std::size_t kCacheFields{9};
+constexpr std::size_t kSelectionCount{16};
+
+// The first GetTuningParameters() call sets initialized before it
+// calibrates, so the kernels it runs, and callers racing with it, read the
+// defaults instead of waiting for themselves.
+struct State {
+  std::mutex mutex;
+  TuningParameters current;
+  bool initialized{false};
+};
+
+auto GetState() -> State& {
+  static State state;
+  return state;
+}
+
+// Shortest of a few runs, the usual micro-benchmark estimate.
+auto MeasureNs(const std::function<void()>& run, std::size_t repetitions)
+    -> double {
+  auto best{std::chrono::nanoseconds::max()};
+  for (std::size_t i = 0; i < repetitions; ++i) {
+    const auto kStart{std::chrono::steady_clock::now()};
+    run();
+    best = std::min(best, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now() - kStart));
+  }
+  return static_cast<double>(best.count());
+}
+
+auto PickGrain(double thread_start_ns, double item_ns) -> std::size_t {
+  const auto kItems{kStartsPerRange * thread_start_ns /
+                    std::max(item_ns, 1e-3)};
+  auto grain{kMinGrain};
+  while (grain < kMaxGrain && static_cast<double>(grain) < kItems) {
+    grain *= 2;
+  }
+  return grain;
+}
+
+auto Calibrate() -> TuningParameters {
+  // ParallelFor(2, 1, ...) starts and joins exactly one extra thread.
+  std::array<double, kThreadStartSamples> starts{};
+  for (auto& start : starts) {
+    start = MeasureNs(
+        [] {
+          zozibush::geometry::ParallelFor(
+              2, 1, [](std::size_t, std::size_t) {}, 2);
+        },
+        1);
+  }
+  std::nth_element(starts.begin(), starts.begin() + starts.size() / 2,
+                   starts.end());
+  const auto kThreadStartNs{starts[starts.size() / 2]};
+
+  std::mt19937 engine(7U);
+  std::uniform_real_distribution<double> coordinate(0.0, 1.0);
+  zozibush::geometry::PointCloud<2, double> points;
+  points.Resize(kCalibrationPoints);
+  for (std::size_t i = 0; i < kCalibrationPoints; ++i) {
+    points.Data(0)[i] = coordinate(engine);
+    points.Data(1)[i] = coordinate(engine);
+  }
+  const auto kCount{static_cast<double>(kCalibrationPoints)};
+  const auto kCellSize{1.0 / std::sqrt(kCount)};
+
+  const auto kCellNs{MeasureNs(
+      [&] {
+        const zozibush::geometry::GridIndex kGrid(points, kCellSize, 1);
+      },
+      kRepetitions)};
+
+  // Dbscan asks for a few neighbours within about a cell.
+  const zozibush::geometry::GridIndex kIndex(points, kCellSize, 1);
+  const auto kQueryNs{MeasureNs(
+      [&] {
+        for (std::size_t i = 0; i < kCalibrationPoints; ++i) {
+          static_cast<void>(kIndex.CountRadius(
+              {points.Data(0)[i], points.Data(1)[i]}, 1.5 * kCellSize, 8));
+        }
+      },
+      kRepetitions)};
+
+  std::vector<zozibush::geometry::Point2D> ring;
+  for (std::size_t i = 0; i < kPolygonVertices; ++i) {
+    const auto kAngle{2.0 * kPi * static_cast<double>(i) /
+                      static_cast<double>(kPolygonVertices)};
+    ring.emplace_back(0.5 + 0.4 * std::cos(kAngle),
+                      0.5 + 0.4 * std::sin(kAngle));
+  }
+  const zozibush::geometry::Polygon2D kPolygon(ring);
+  std::vector<uint64_t> mask(
+      zozibush::geometry::Polygon2D::GetMaskWordCount(kCalibrationPoints));
+  const auto kContainsNs{MeasureNs(
+      [&] { kPolygon.Contains(points, mask.data(), 1); }, kRepetitions)};
+
+  const auto kSelectionNs{MeasureNs(
+      [&] {
+        static_cast<void>(zozibush::geometry::SelectNearest(
+            points, {0.5, 0.5}, kSelectionCount, 1));
+      },
+      kRepetitions)};
+
+  std::vector<int8_t> signs(kCalibrationPoints);
+  const auto kPredicateNs{MeasureNs(
+      [&] {
+        zozibush::geometry::Orient2D({0.1, 0.2}, {0.9, 0.7}, points,
+                                     signs.data(), 1);
+      },
+      kRepetitions)};
+
+  const auto kRotation{zozibush::geometry::Transform2D::Rotation(0.5)};
+  zozibush::geometry::PointCloud<2, double> rotated;
+  const auto kTransformNs{
+      MeasureNs([&] { kRotation.Apply(points, rotated, 1); }, kRepetitions)};
+
+  TuningParameters result;
+  result.query_grain = PickGrain(kThreadStartNs, kQueryNs / kCount);
+  result.cell_grain = PickGrain(kThreadStartNs, kCellNs / kCount);
+  // A power of two of at least 64 is a whole number of mask words.
+  result.contains_grain = PickGrain(kThreadStartNs, kContainsNs / kCount);
+  result.selection_grain = PickGrain(kThreadStartNs, kSelectionNs / kCount);
+  result.predicate_grain = PickGrain(kThreadStartNs, kPredicateNs / kCount);
+  result.transform_grain = PickGrain(kThreadStartNs, kTransformNs / kCount);
+  result.thread_start_ns = static_cast<uint64_t>(kThreadStartNs);
+  result.source = TuningParameters::Source::kCalibration;
+  return result;
+}
+
+auto ParseNumber(std::string_view text, uint64_t& value) -> bool {
+  const auto* end{text.data() + text.size()};
+  const auto [kLast, kError] = std::from_chars(text.data(), end, value);
+  return kError == std::errc() && kLast == end;
+}
+
+auto SplitFields(const std::string& line) -> std::vector<std::string_view> {
+  std::vector<std::string_view> fields;
+  std::string_view rest{line};
+  while (true) {
+    const auto kTab{rest.find('\t')};
+    fields.push_back(rest.substr(0, kTab));
+    if (kTab == std::string_view::npos) {
+      return fields;
+    }
+    rest = rest.substr(kTab + 1);
+  }
+}
+
+auto IsValid(const TuningParameters& parameters) -> bool {
+  return parameters.query_grain > 0 && parameters.cell_grain > 0 &&
+         parameters.contains_grain > 0 &&
+         parameters.contains_grain % kMaskBits == 0 &&
+         parameters.selection_grain > 0 && parameters.predicate_grain > 0 &&
+         parameters.transform_grain > 0;
+}
+}  // namespace
+
+namespace zozibush::geometry {
+auto GetTuningParameters() -> TuningParameters {
+  auto& state{GetState()};
+  {
+    const std::lock_guard kLock(state.mutex);
+    if (state.initialized) {
+      return state.current;
+    }
+    state.initialized = true;
+  }
+
+  const auto kPath{GetTuningCachePath()};
+  const auto kKey{internal::GetTuningKey()};
+  auto parameters{kPath.empty() ? std::nullopt
+                                : internal::ReadTuningCache(kPath, kKey)};
+  if (!parameters) {
+    parameters = Calibrate();
+    if (!kPath.empty()) {
+      internal::WriteTuningCache(kPath, kKey, *parameters);
+    }
+  }
+  const std::lock_guard kLock(state.mutex);
+  // A SetTuningParameters() call made meanwhile wins.
+  if (state.current.source == TuningParameters::Source::kDefault) {
+    state.current = *parameters;
+  }
+  return state.current;
+}
+
+auto CalibrateTuningParameters() -> TuningParameters {
+  auto& state{GetState()};
+  {
+    const std::lock_guard kLock(state.mutex);
+    state.initialized = true;
+  }
+  const auto kParameters{Calibrate()};
+  const auto kPath{GetTuningCachePath()};
+  if (!kPath.empty()) {
+    internal::WriteTuningCache(kPath, internal::GetTuningKey(), kParameters);
+  }
+  const std::lock_guard kLock(state.mutex);
+  state.current = kParameters;
+  return kParameters;
+}
+
+auto SetTuningParameters(const TuningParameters& parameters) -> void {
+  if (!IsValid(parameters)) {
+    throw std::invalid_argument(
+        "grains must be positive and contains_grain a multiple of 64");
+  }
+  auto& state{GetState()};
+  const std::lock_guard kLock(state.mutex);
+  state.initialized = true;
+  state.current = parameters;
+  state.current.source = TuningParameters::Source::kUser;
+}
+
+auto GetCpuModel() -> std::string {
+  std::ifstream file("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(file, line)) {
+    // "model name" on x86, "Model" or "Processor" on some ARM kernels.
+    const auto kColon{line.find(':')};
+    if (kColon == std::string::npos) {
+      continue;
+    }
+    const auto kName{
+        line.substr(0, line.find_last_not_of(" \t", kColon - 1) + 1)};
+    if (kName == "model name" || kName == "Model" || kName == "Processor") {
+      const auto kBegin{line.find_first_not_of(" \t", kColon + 1)};
+      if (kBegin != std::string::npos) {
+        return line.substr(kBegin);
+      }
+    }
+  }
+  return "unknown";
+}
+
+auto GetTuningCachePath() -> std::string {
+  if (const auto* path{std::getenv("GEOMETRY_TUNING_CACHE")}) {
+    return path;
+  }
+  constexpr const char* kFile{"/zozibush_geometry/tuning.txt"};
+  if (const auto* cache{std::getenv("XDG_CACHE_HOME")};
+      cache != nullptr && *cache != '\0') {
+    return std::string(cache) + kFile;
+  }
+  if (const auto* home{std::getenv("HOME")};
+      home != nullptr && *home != '\0') {
+    return std::string(home) + "/.cache" + kFile;
+  }
+  return {};
+}
+
+namespace internal {
+auto GetTuningKey() -> std::string {
+  auto key{GetCpuModel() + " / " + std::to_string(GetDefaultThreadCount()) +
+           " threads"};
+  std::replace_if(
+      key.begin(), key.end(),
+      [](char value) { return value == '\t' || value == '\n'; }, ' ');
+  return key;
+}
+
+auto ReadTuningCache(const std::string& path, const std::string& key)
+    -> std::optional<TuningParameters> {
+  std::ifstream file(path);
+  std::string line;
+  while (std::getline(file, line)) {
+    const auto kFields{SplitFields(line)};
+    if (kFields.size() != kCacheFields || kFields[0] != kCacheVersion ||
+        kFields[1] != key) {
+      continue;
+    }
+    std::array<uint64_t, kCacheFields - 2> values{};
+    bool parsed{true};
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      parsed = parsed && ParseNumber(kFields[i + 2], values[i]);
+    }
+    TuningParameters parameters;
+    parameters.query_grain = values[0];
+    parameters.cell_grain = values[1];
+    parameters.contains_grain = values[2];
+    parameters.selection_grain = values[3];
+    parameters.predicate_grain = values[4];
+    parameters.transform_grain = values[5];
+    parameters.thread_start_ns = values[6];
+    parameters.source = TuningParameters::Source::kCache;
+    if (parsed && IsValid(parameters)) {
+      return parameters;
+    }
+  }
+  return std::nullopt;
+}
+
+auto WriteTuningCache(const std::string& path, const std::string& key,
+                      const TuningParameters& parameters) -> bool {
+  std::error_code error;
+  const std::filesystem::path kPath(path);
+  if (kPath.has_parent_path()) {
+    std::filesystem::create_directories(kPath.parent_path(), error);
+  }
+
+  std::ostringstream content;
+  {
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+      const auto kFields{SplitFields(line)};
+      if (kFields.size() < 2 || kFields[1] != key) {
+        content << line << '\n';
+      }
+    }
+  }
+  content << kCacheVersion << '\t' << key << '\t' << parameters.query_grain
+          << '\t' << parameters.cell_grain << '\t' << parameters.contains_grain
+          << '\t' << parameters.selection_grain << '\t'
+          << parameters.predicate_grain << '\t' << parameters.transform_grain
+          << '\t' << parameters.thread_start_ns << '\n';
+
+  // A random suffix keeps writers in other processes and threads apart.
+  std::random_device device;
+  const std::filesystem::path kTemporary(path + ".tmp" +
+                                         std::to_string(device()));
+  {
+    std::ofstream file(kTemporary, std::ios::trunc);
+    file << content.str();
+    if (!file.flush()) {
+      std::filesystem::remove(kTemporary, error);
+      return false;
+    }
+  }
+  std::filesystem::rename(kTemporary, kPath, error);
+  if (error) {
+    std::filesystem::remove(kTemporary, error);
+    return false;
+  }
+  return true;
+}
+}  // namespace internal
+}  // namespace zozibush::geometry
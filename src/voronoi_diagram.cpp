@@ -0,0 +1,92 @@
+// Copyright (c) 2023 zozibush, All RIghts Reserved
+// Authors: zozibush
+
+#include "geometry/voronoi_diagram.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace zozibush::geometry {
+VoronoiDiagram::VoronoiDiagram(const Delaunay& delaunay) {
+  const auto& kTriangles{delaunay.GetTriangles()};
+  const auto& kHalfEdges{delaunay.GetHalfEdges()};
+  const auto kPointCount{delaunay.GetPointCount()};
+  const auto kEdgeCount{static_cast<uint32_t>(kTriangles.size())};
+
+  vertices_.reserve(delaunay.GetTriangleCount());
+  for (uint32_t edge = 0; edge < kEdgeCount; edge += 3) {
+    const auto kA{delaunay.GetPoint(kTriangles[edge])};
+    const auto kB{delaunay.GetPoint(kTriangles[edge + 1])};
+    const auto kC{delaunay.GetPoint(kTriangles[edge + 2])};
+    const auto kDx{kB.GetX() - kA.GetX()};
+    const auto kDy{kB.GetY() - kA.GetY()};
+    const auto kEx{kC.GetX() - kA.GetX()};
+    const auto kEy{kC.GetY() - kA.GetY()};
+    const auto kBl{kDx * kDx + kDy * kDy};
+    const auto kCl{kEx * kEx + kEy * kEy};
+    const auto kScale{0.5 / (kDx * kEy - kDy * kEx)};
+    vertices_.emplace_back(kA.GetX() + (kEy * kBl - kDy * kCl) * kScale,
+                           kA.GetY() + (kDx * kCl - kEx * kBl) * kScale);
+  }
+
+  // An incoming half-edge per point; for hull points the one on the hull,
+  // so that walking from it sweeps every triangle around the point.
+  std::vector<uint32_t> incoming(kPointCount, Delaunay::kInvalid);
+  for (uint32_t edge = 0; edge < kEdgeCount; ++edge) {
+    const auto kEnd{kTriangles[Delaunay::NextHalfEdge(edge)]};
+    if (incoming[kEnd] == Delaunay::kInvalid ||
+        kHalfEdges[edge] == Delaunay::kInvalid) {
+      incoming[kEnd] = edge;
+    }
+  }
+
+  cell_offsets_.reserve(kPointCount + 1);
+  cell_offsets_.push_back(0);
+  cell_vertices_.reserve(kEdgeCount);
+  bounded_.assign(kPointCount, 0);
+  for (std::size_t point = 0; point < kPointCount; ++point) {
+    const auto kStart{incoming[point]};
+    if (kStart != Delaunay::kInvalid) {
+      const auto kBegin{cell_vertices_.size()};
+      auto edge{kStart};
+      do {
+        cell_vertices_.push_back(edge / 3);
+        edge = kHalfEdges[Delaunay::NextHalfEdge(edge)];
+      } while (edge != Delaunay::kInvalid && edge != kStart);
+      bounded_[point] = static_cast<uint8_t>(edge == kStart);
+      // The walk turns clockwise around the point.
+      std::reverse(cell_vertices_.begin() + static_cast<std::ptrdiff_t>(kBegin),
+                   cell_vertices_.end());
+    }
+    cell_offsets_.push_back(static_cast<uint32_t>(cell_vertices_.size()));
+  }
+}
+
+auto VoronoiDiagram::GetCellCount() const -> std::size_t {
+  return bounded_.size();
+}
+auto VoronoiDiagram::GetVertices() const -> const std::vector<Point2D>& {
+  return vertices_;
+}
+
+auto VoronoiDiagram::IsBounded(uint32_t point) const -> bool {
+  if (point >= bounded_.size()) {
+    throw std::out_of_range("point is out of diagram range");
+  }
+  return bounded_[point] != 0;
+}
+
+auto VoronoiDiagram::GetCell(uint32_t point,
+                             std::vector<Point2D>& vertices) const
+    -> std::size_t {
+  if (point >= bounded_.size()) {
+    throw std::out_of_range("point is out of diagram range");
+  }
+  vertices.clear();
+  for (auto i = cell_offsets_[point]; i < cell_offsets_[point + 1]; ++i) {
+    vertices.push_back(vertices_[cell_vertices_[i]]);
+  }
+  return vertices.size();
+}
+}  // namespace zozibush::geometry
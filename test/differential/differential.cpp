@@ -0,0 +1,212 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+
+#include "differential.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <new>
+
+namespace {
+constexpr double kCoordinateRange{1.0e+3};
+
+auto GetAllocations() -> std::atomic<std::size_t>& {
+  static std::atomic<std::size_t> allocations{0};
+  return allocations;
+}
+
+auto Allocate(std::size_t size) -> void* {
+  GetAllocations().fetch_add(1, std::memory_order_relaxed);
+  return std::malloc(size == 0 ? 1 : size);
+}
+
+// aligned_alloc takes a size that is a multiple of the alignment.
+auto AllocateAligned(std::size_t size, std::align_val_t alignment) -> void* {
+  GetAllocations().fetch_add(1, std::memory_order_relaxed);
+  const auto kAlignment{std::max(static_cast<std::size_t>(alignment),
+                                 sizeof(void*))};
+  const auto kSize{(std::max<std::size_t>(size, 1) + kAlignment - 1) /
+                   kAlignment * kAlignment};
+#ifdef _WIN32
+  return _aligned_malloc(kSize, kAlignment);
+#else
+  return std::aligned_alloc(kAlignment, kSize);
+#endif
+}
+
+auto FreeAligned(void* pointer) -> void {
+#ifdef _WIN32
+  _aligned_free(pointer);
+#else
+  std::free(pointer);
+#endif
+}
+
+// Maps doubles onto integers in the same order, +0 and -0 both onto 0.
+auto ToOrdered(double value) -> int64_t {
+  int64_t bits{0};
+  std::memcpy(&bits, &value, sizeof(bits));
+  return (bits < 0) ? std::numeric_limits<int64_t>::min() - bits : bits;
+}
+}  // namespace
+
+// The sized deletes forward to the unsized ones in libstdc++, but the aligned
+// forms call aligned_alloc themselves, so every form is replaced.
+auto operator new(std::size_t size) -> void* {
+  if (auto* pointer{Allocate(size)}) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+auto operator new[](std::size_t size) -> void* {
+  if (auto* pointer{Allocate(size)}) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+auto operator new(std::size_t size, const std::nothrow_t& /*tag*/) noexcept
+    -> void* {
+  return Allocate(size);
+}
+auto operator new[](std::size_t size, const std::nothrow_t& /*tag*/) noexcept
+    -> void* {
+  return Allocate(size);
+}
+auto operator delete(void* pointer) noexcept -> void { std::free(pointer); }
+auto operator delete[](void* pointer) noexcept -> void { std::free(pointer); }
+auto operator delete(void* pointer, std::size_t /*size*/) noexcept -> void {
+  std::free(pointer);
+}
+auto operator delete[](void* pointer, std::size_t /*size*/) noexcept -> void {
+  std::free(pointer);
+}
+auto operator new(std::size_t size, std::align_val_t alignment) -> void* {
+  if (auto* pointer{AllocateAligned(size, alignment)}) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+auto operator new[](std::size_t size, std::align_val_t alignment) -> void* {
+  if (auto* pointer{AllocateAligned(size, alignment)}) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+auto operator new(std::size_t size, std::align_val_t alignment,
+                  const std::nothrow_t& /*tag*/) noexcept -> void* {
+  return AllocateAligned(size, alignment);
+}
+auto operator new[](std::size_t size, std::align_val_t alignment,
+                    const std::nothrow_t& /*tag*/) noexcept -> void* {
+  return AllocateAligned(size, alignment);
+}
+auto operator delete(void* pointer, std::align_val_t /*alignment*/) noexcept
+    -> void {
+  FreeAligned(pointer);
+}
+auto operator delete[](void* pointer, std::align_val_t /*alignment*/) noexcept
+    -> void {
+  FreeAligned(pointer);
+}
+auto operator delete(void* pointer, std::size_t /*size*/,
+                     std::align_val_t /*alignment*/) noexcept -> void {
+  FreeAligned(pointer);
+}
+auto operator delete[](void* pointer, std::size_t /*size*/,
+                       std::align_val_t /*alignment*/) noexcept -> void {
+  FreeAligned(pointer);
+}
+
+namespace zozibush::geometry::differential {
+AllocationCounter::AllocationCounter() : start_(GetAllocations().load()) {}
+
+auto AllocationCounter::GetCount() const -> std::size_t {
+  return GetAllocations().load() - start_;
+}
+
+auto GetUlpDistance(double lhs, double rhs) -> uint64_t {
+  if (std::isnan(lhs) || std::isnan(rhs)) {
+    return (std::isnan(lhs) && std::isnan(rhs))
+               ? 0
+               : std::numeric_limits<uint64_t>::max();
+  }
+  const auto kLhs{static_cast<uint64_t>(ToOrdered(lhs))};
+  const auto kRhs{static_cast<uint64_t>(ToOrdered(rhs))};
+  // Modular difference, so no signed overflow across the whole range.
+  return (ToOrdered(lhs) < ToOrdered(rhs)) ? kRhs - kLhs : kLhs - kRhs;
+}
+
+auto IsSameValue(double lhs, double rhs) -> bool {
+  return (std::isnan(lhs) && std::isnan(rhs)) ||
+         std::memcmp(&lhs, &rhs, sizeof(lhs)) == 0;
+}
+
+auto GetAdversarialValues() -> std::vector<double> {
+  using Limits = std::numeric_limits<double>;
+  constexpr double kTwoTo53{9007199254740992.0};
+  return {0.0,
+          -0.0,
+          Limits::denorm_min(),
+          -Limits::denorm_min(),
+          Limits::min() - Limits::denorm_min(),
+          Limits::min(),
+          -Limits::min(),
+          Limits::epsilon(),
+          1.0,
+          -1.0,
+          0.1,
+          -0.3,
+          kTwoTo53 - 1.0,
+          kTwoTo53,
+          kTwoTo53 + 2.0,
+          -kTwoTo53,
+          1.0e+150,
+          -1.0e+150,
+          Limits::max(),
+          Limits::lowest(),
+          Limits::infinity(),
+          -Limits::infinity(),
+          Limits::quiet_NaN(),
+          -Limits::quiet_NaN()};
+}
+
+auto MakeRandomValues(std::mt19937_64& engine, std::size_t count,
+                      bool finite) -> std::vector<double> {
+  auto adversarial{GetAdversarialValues()};
+  if (finite) {
+    adversarial.erase(std::remove_if(adversarial.begin(), adversarial.end(),
+                                     [](double value) {
+                                       return !std::isfinite(value);
+                                     }),
+                      adversarial.end());
+  }
+  std::uniform_real_distribution<double> coordinate(-kCoordinateRange,
+                                                    kCoordinateRange);
+  std::uniform_int_distribution<std::size_t> pick(0, adversarial.size() - 1);
+  std::uniform_int_distribution<uint32_t> kind(0, 7);
+  std::vector<double> result(count);
+  for (auto& value : result) {
+    switch (kind(engine)) {
+      case 0:
+        value = adversarial[pick(engine)];
+        break;
+      case 1: {
+        const auto kBits{engine()};
+        std::memcpy(&value, &kBits, sizeof(value));
+        if (finite && !std::isfinite(value)) {
+          value = 0.0;
+        }
+        break;
+      }
+      default:
+        value = coordinate(engine);
+        break;
+    }
+  }
+  return result;
+}
+}  // namespace zozibush::geometry::differential
@@ -0,0 +1,77 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+
+#ifndef ZOZIBUSH__GEOMETRY_TEST_DIFFERENTIAL_HPP_
+#define ZOZIBUSH__GEOMETRY_TEST_DIFFERENTIAL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace zozibush::geometry::differential {
+
+/**
+ * @brief Count of operator new calls on any thread since construction
+ *
+ * The differential test binaries replace the global operator new, so a hot
+ * path can be checked to run without allocating.
+ */
+class AllocationCounter {
+ public:
+  /**
+   * @brief Construct a new AllocationCounter object, starting at 0
+   */
+  AllocationCounter();
+
+  /**
+   * @brief Get the number of allocations since construction
+   * @return std::size_t Number of operator new calls
+   */
+  [[nodiscard]] auto GetCount() const -> std::size_t;
+
+ protected:
+ private:
+  std::size_t start_;  ///< Global count at construction
+};
+
+/**
+ * @brief Get the number of representable doubles between two values
+ * @param lhs Reference value
+ * @param rhs Checked value
+ * @return uint64_t 0 if equal, +0 and -0 alike, or both nan; UINT64_MAX if
+ * only one is nan
+ */
+[[nodiscard]] auto GetUlpDistance(double lhs, double rhs) -> uint64_t;
+
+/**
+ * @brief Check whether two values are the same, bit for bit or both nan
+ * @param lhs Reference value
+ * @param rhs Checked value
+ * @return true If the results of two paths agree exactly
+ * @return false Otherwise
+ */
+[[nodiscard]] auto IsSameValue(double lhs, double rhs) -> bool;
+
+/**
+ * @brief Get the values optimized paths usually get wrong
+ * @return std::vector<double> Signed zeros, denormals, normal and finite
+ * limits, infinities, nan and values around 2^53
+ */
+[[nodiscard]] auto GetAdversarialValues() -> std::vector<double>;
+
+/**
+ * @brief Make random values mixing ordinary coordinates, random bit patterns
+ * and adversarial values
+ * @param engine Random engine
+ * @param count Number of values
+ * @param finite Whether to leave out infinities and nan
+ * @return std::vector<double> Values
+ */
+[[nodiscard]] auto MakeRandomValues(std::mt19937_64& engine,
+                                    std::size_t count, bool finite)
+    -> std::vector<double>;
+
+}  // namespace zozibush::geometry::differential
+
+#endif  // ZOZIBUSH__GEOMETRY_TEST_DIFFERENTIAL_HPP_
@@ -0,0 +1,216 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+//
+// Optimized distance kernels against the scalar Distance implementation.
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "differential.hpp"
+#include "geometry/atomic_distance.hpp"
+#include "geometry/distance.hpp"
+#include "geometry/distance_array.hpp"
+#include "geometry/distance_selection.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+constexpr std::size_t kTestCount{100003};
+constexpr std::size_t kThreadCount{4};
+// Dividing by a power of ten against multiplying by its rounded inverse.
+constexpr uint64_t kConversionUlp{1};
+// Sizes around the 256-element blocks of the Distance array kernels.
+constexpr std::size_t kBlockSizes[] = {0, 1, 255, 256, 257, 1000};
+
+using zozibush::geometry::Distance;
+
+constexpr Distance::Type kTypes[] = {
+    Distance::Type::kKilometer,  Distance::Type::kMeter,
+    Distance::Type::kCentimeter, Distance::Type::kMillimeter,
+    Distance::Type::kMicrometer, Distance::Type::kNanometer};
+
+// Indexed by Distance::Type, as the Distance constructor scales.
+constexpr double kScales[] = {1.0e+12, 1.0e+9, 1.0e+7, 1.0e+6, 1.0e+3, 1.0};
+
+auto MakeNanometers(std::mt19937_64& engine, std::size_t count)
+    -> std::vector<int64_t> {
+  using Limits = std::numeric_limits<int64_t>;
+  std::vector<int64_t> result{Limits::min(), Limits::min() + 1, -1, 0, 1,
+                              Limits::max() - 1, Limits::max()};
+  std::uniform_int_distribution<int64_t> any(Limits::min(), Limits::max());
+  std::uniform_int_distribution<int64_t> small(-1000000, 1000000);
+  while (result.size() < count) {
+    result.push_back((result.size() % 2 == 0) ? any(engine) : small(engine));
+  }
+  return result;
+}
+}  // namespace
+
+namespace zozibush::geometry {
+using differential::AllocationCounter;
+using differential::GetUlpDistance;
+
+TEST(GeometryDifferentialDistance, ToNanometers) {
+  std::mt19937_64 engine(29U);
+  auto values{differential::MakeRandomValues(engine, kTestCount, true)};
+  const auto kAdversarial{differential::GetAdversarialValues()};
+  values.insert(values.end(), kAdversarial.begin(), kAdversarial.end());
+
+  for (const auto kType : kTypes) {
+    const auto kScale{kScales[static_cast<std::size_t>(kType)]};
+    std::vector<int64_t> nanometers(values.size());
+    bool thrown{false};
+    try {
+      ConvertToNanometers(values.data(), values.size(), kType,
+                          nanometers.data());
+    } catch (const std::out_of_range&) {
+      thrown = true;
+    }
+
+    // The constructor truncates where the array kernel rounds; they agree
+    // on whole nanometers and differ by at most one otherwise.
+    bool out_of_range{false};
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      const auto kScaled{values[i] * kScale};
+      if (!(std::abs(kScaled) < 9.2e+18)) {
+        out_of_range = out_of_range || !(std::nearbyint(kScaled) >= -0x1p63 &&
+                                         std::nearbyint(kScaled) < 0x1p63);
+        continue;
+      }
+      const auto kExpected{Distance(values[i], kType).GetNanometer()};
+      ASSERT_LE(std::abs(nanometers[i] - kExpected), 1) << values[i];
+      if (kScaled == std::trunc(kScaled)) {
+        ASSERT_EQ(kExpected, nanometers[i]) << values[i];
+      }
+    }
+    EXPECT_EQ(out_of_range, thrown);
+  }
+
+  // The int64 nanometer limits are exact, one past them is not.
+  const double kLimits[] = {-0x1p63, 0x1p63 - 1024.0};
+  std::vector<int64_t> nanometers(2);
+  ConvertToNanometers(kLimits, 2, Distance::Type::kNanometer,
+                      nanometers.data());
+  EXPECT_EQ(std::numeric_limits<int64_t>::min(), nanometers[0]);
+  EXPECT_EQ(Distance(kLimits[1], Distance::Type::kNanometer).GetNanometer(),
+            nanometers[1]);
+  const double kPastLimit{0x1p63};
+  EXPECT_THROW(ConvertToNanometers(&kPastLimit, 1, Distance::Type::kNanometer,
+                                   nanometers.data()),
+               std::out_of_range);
+  ConvertToNanometers(nullptr, 0, Distance::Type::kMeter, nullptr);
+}
+
+TEST(GeometryDifferentialDistance, FromNanometers) {
+  std::mt19937_64 engine(31U);
+  const auto kNanometers{MakeNanometers(engine, kTestCount)};
+  std::vector<double> values(kNanometers.size());
+  for (const auto kType : kTypes) {
+    ConvertFromNanometers(kNanometers.data(), kNanometers.size(), kType,
+                          values.data());
+    for (std::size_t i = 0; i < kNanometers.size(); ++i) {
+      const auto kExpected{
+          Distance::FromNanometer(kNanometers[i]).GetValue(kType)};
+      ASSERT_LE(GetUlpDistance(kExpected, values[i]), kConversionUlp)
+          << kNanometers[i];
+    }
+  }
+  ConvertFromNanometers(nullptr, 0, Distance::Type::kMeter, nullptr);
+}
+
+TEST(GeometryDifferentialDistance, Arrays) {
+  std::mt19937_64 engine(37U);
+  for (const auto kSize : kBlockSizes) {
+    const auto kValues{differential::MakeRandomValues(engine, kSize, true)};
+    std::vector<double> meters(kSize);
+    std::transform(kValues.begin(), kValues.end(), meters.begin(),
+                   [](double value) { return std::fmod(value, 1.0e+6); });
+
+    std::vector<int64_t> nanometers(kSize);
+    ConvertToNanometers(meters.data(), kSize, Distance::Type::kMeter,
+                        nanometers.data());
+    std::vector<Distance> distances(kSize);
+    ConvertToDistances(meters.data(), kSize, Distance::Type::kMeter,
+                       distances.data());
+    std::vector<double> from_nanometers(kSize);
+    ConvertFromNanometers(nanometers.data(), kSize, Distance::Type::kMeter,
+                          from_nanometers.data());
+    std::vector<double> from_distances(kSize);
+    ConvertFromDistances(distances.data(), kSize, Distance::Type::kMeter,
+                         from_distances.data());
+    for (std::size_t i = 0; i < kSize; ++i) {
+      ASSERT_EQ(nanometers[i], distances[i].GetNanometer()) << kSize;
+      ASSERT_EQ(from_nanometers[i], from_distances[i]) << kSize;
+    }
+  }
+
+  std::vector<Distance> distances;
+  for (const auto kNanometer : MakeNanometers(engine, 1000)) {
+    distances.push_back(Distance::FromNanometer(kNanometer));
+  }
+  const auto kBytes{DumpDistances(distances)};
+  EXPECT_EQ(distances, LoadDistances(kBytes.data(), kBytes.size()));
+  EXPECT_TRUE(DumpDistances({}).empty());
+  EXPECT_TRUE(LoadDistances(nullptr, 0).empty());
+}
+
+TEST(GeometryDifferentialDistance, Selection) {
+  std::mt19937_64 engine(41U);
+  std::vector<Distance> distances;
+  for (const auto kNanometer : MakeNanometers(engine, kTestCount)) {
+    distances.push_back(Distance::FromNanometer(kNanometer));
+  }
+  // Duplicates, which rank by index.
+  std::copy_n(distances.begin(), 100, distances.end() - 100);
+
+  std::vector<std::size_t> expected(distances.size());
+  std::iota(expected.begin(), expected.end(), std::size_t{0});
+  std::stable_sort(expected.begin(), expected.end(),
+                   [&](std::size_t lhs, std::size_t rhs) {
+                     return distances[lhs] < distances[rhs];
+                   });
+  EXPECT_EQ(expected,
+            SortByDistance(distances.data(), distances.size(), kThreadCount));
+  const std::vector<std::size_t> kTop(expected.begin(),
+                                      expected.begin() + 100);
+  EXPECT_EQ(kTop, SelectSmallest(distances.data(), distances.size(), 100,
+                                 kThreadCount));
+  EXPECT_TRUE(SortByDistance(nullptr, 0).empty());
+  EXPECT_TRUE(SelectSmallest(nullptr, 0, 10).empty());
+}
+
+TEST(GeometryDifferentialDistance, HotPathsDoNotAllocate) {
+  std::mt19937_64 engine(43U);
+  const auto kValues{differential::MakeRandomValues(engine, kTestCount, true)};
+  std::vector<double> meters(kTestCount);
+  std::transform(kValues.begin(), kValues.end(), meters.begin(),
+                 [](double value) { return std::fmod(value, 1.0e+6); });
+  std::vector<int64_t> nanometers(kTestCount);
+  std::vector<Distance> distances(kTestCount);
+  std::vector<double> values(kTestCount);
+
+  const AllocationCounter kCounter;
+  ConvertToNanometers(meters.data(), kTestCount, Distance::Type::kMeter,
+                      nanometers.data());
+  ConvertFromNanometers(nanometers.data(), kTestCount,
+                        Distance::Type::kMillimeter, values.data());
+  ConvertToDistances(meters.data(), kTestCount, Distance::Type::kMeter,
+                     distances.data());
+  ConvertFromDistances(distances.data(), kTestCount,
+                       Distance::Type::kKilometer, values.data());
+  auto sum{distances[0] + distances[1]};
+  sum -= distances[2];
+  EXPECT_EQ(distances[0].GetNanometer() + distances[1].GetNanometer() -
+                distances[2].GetNanometer(),
+            sum.GetNanometer());
+  EXPECT_EQ(0U, kCounter.GetCount());
+
+  // The hook sees the over-aligned shard array too.
+  const ShardedAtomicDistance kSharded(2U);
+  EXPECT_EQ(1U, kCounter.GetCount());
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,284 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+//
+// Optimized point kernels against the scalar Point2D operators.
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "differential.hpp"
+#include "geometry/batch_distance.hpp"
+#include "geometry/distance_selection.hpp"
+#include "geometry/point_expression.hpp"
+#include "geometry/predicates.hpp"
+#include "geometry/transform2d.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+// Enough for several ranges and a remainder in every batch kernel.
+constexpr std::size_t kTestCount{150001};
+constexpr std::size_t kThreadCount{4};
+// Batch distances may reassociate or fuse their sums by this much.
+constexpr uint64_t kDistanceUlp{2};
+
+using zozibush::geometry::Point2D;
+using zozibush::geometry::PointCloud;
+
+auto MakeRandomPoints(std::mt19937_64& engine, std::size_t count,
+                      bool finite) -> std::vector<Point2D> {
+  const auto kX{zozibush::geometry::differential::MakeRandomValues(
+      engine, count, finite)};
+  const auto kY{zozibush::geometry::differential::MakeRandomValues(
+      engine, count, finite)};
+  std::vector<Point2D> result;
+  result.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    result.emplace_back(kX[i], kY[i]);
+  }
+  return result;
+}
+
+// Every pair of adversarial values, then random points.
+auto MakeAdversarialPoints(std::mt19937_64& engine, bool finite)
+    -> std::vector<Point2D> {
+  auto values{zozibush::geometry::differential::GetAdversarialValues()};
+  if (finite) {
+    values.erase(std::remove_if(values.begin(), values.end(),
+                                [](double value) {
+                                  return !std::isfinite(value);
+                                }),
+                 values.end());
+  }
+  std::vector<Point2D> result;
+  for (const auto kX : values) {
+    for (const auto kY : values) {
+      result.emplace_back(kX, kY);
+    }
+  }
+  const auto kRandom{MakeRandomPoints(engine, kTestCount, finite)};
+  result.insert(result.end(), kRandom.begin(), kRandom.end());
+  return result;
+}
+
+auto IsSamePoint(const Point2D& lhs, const Point2D& rhs) -> bool {
+  return zozibush::geometry::differential::IsSameValue(lhs.GetX(),
+                                                       rhs.GetX()) &&
+         zozibush::geometry::differential::IsSameValue(lhs.GetY(),
+                                                       rhs.GetY());
+}
+}  // namespace
+
+namespace zozibush::geometry {
+using differential::AllocationCounter;
+using differential::GetUlpDistance;
+using differential::IsSameValue;
+
+TEST(GeometryDifferentialPoint2D, Expressions) {
+  std::mt19937_64 engine(11U);
+  const auto kA{MakeAdversarialPoints(engine, false)};
+  const auto kB{MakeRandomPoints(engine, kA.size(), false)};
+  const auto kCloud{MakePointCloud(MakeRandomPoints(engine, kA.size(), false))};
+  const Point2D kOffset(0.1, -3.0e+300);
+
+  std::vector<Point2D> points;
+  Assign((Lazy(kA) - Lazy(kB) + kOffset) * 3.0 / 7.0, points);
+  PointCloud<2, double> cloud;
+  Assign(Lazy(kCloud) * 0.5 - Lazy(kA), cloud);
+  ASSERT_EQ(kA.size(), points.size());
+  ASSERT_EQ(kA.size(), cloud.Size());
+  for (std::size_t i = 0; i < kA.size(); ++i) {
+    ASSERT_TRUE(IsSamePoint((kA[i] - kB[i] + kOffset) * 3.0 / 7.0, points[i]))
+        << i;
+    const auto kExpected{kCloud.Get(i).ToPoint2() * 0.5 - kA[i]};
+    ASSERT_TRUE(IsSamePoint(kExpected, {cloud.Data(0)[i], cloud.Data(1)[i]}))
+        << i;
+  }
+
+  const std::vector<Point2D> kEmpty;
+  Assign(Lazy(kEmpty) + kOffset, points);
+  EXPECT_TRUE(points.empty());
+
+  // Arrays combine only with arrays of their own size, an empty one
+  // included, whatever the operand kinds and nesting.
+  const std::vector<Point2D> kShorter(kA.begin(), kA.end() - 1);
+  const auto kEmptyCloud{MakePointCloud(kEmpty)};
+  const auto kCheckMismatch{[](const auto& lhs, const auto& rhs) {
+    EXPECT_THROW(static_cast<void>(lhs + rhs), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(rhs - lhs), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>((lhs + Point2D(1.0, 1.0)) * 2.0 - rhs),
+                 std::invalid_argument);
+  }};
+  kCheckMismatch(Lazy(kEmpty), Lazy(kA));
+  kCheckMismatch(Lazy(kEmpty), Lazy(kCloud));
+  kCheckMismatch(Lazy(kEmptyCloud), Lazy(kA));
+  kCheckMismatch(Lazy(kEmptyCloud), Lazy(kCloud));
+  kCheckMismatch(Lazy(kShorter), Lazy(kA));
+  kCheckMismatch(Lazy(kShorter), Lazy(kCloud));
+  kCheckMismatch(Lazy(kShorter) * 2.0, Lazy(kA) - Lazy(kB));
+  Assign(Lazy(kEmpty) - Lazy(kEmptyCloud) * 2.0, cloud);
+  EXPECT_EQ(0U, cloud.Size());
+}
+
+TEST(GeometryDifferentialPoint2D, Transform) {
+  std::mt19937_64 engine(13U);
+  const auto kPoints{MakeAdversarialPoints(engine, false)};
+  const auto kCloud{MakePointCloud(kPoints)};
+  const auto kCount{kPoints.size()};
+  const Point2D kOffset(-2.5, 1.0e+10);
+  const auto kScale{0.75};
+  const auto kCos{std::cos(1.1)};
+  const auto kSin{std::sin(1.1)};
+
+  // Each transform with the same arithmetic spelled in Point2D operators.
+  const auto kTranslation{Transform2D::Translation(-2.5, 1.0e+10)};
+  const auto kScaling{Transform2D::Scale(kScale, kScale).Then(kTranslation)};
+  const auto kRotation{Transform2D(kCos, -kSin, -2.5, kSin, kCos, 1.0e+10)};
+  const auto kTranslated{[&](const Point2D& point) { return point + kOffset; }};
+  const auto kScaled{
+      [&](const Point2D& point) { return point * kScale + kOffset; }};
+  const auto kRotated{[&](const Point2D& point) {
+    return Point2D(point.GetX() * kCos, point.GetX() * kSin) +
+           Point2D(point.GetY() * -kSin, point.GetY() * kCos) + kOffset;
+  }};
+
+  const auto kCheck{[&](const Transform2D& transform, const auto& reference) {
+    std::vector<Point2D> output(kCount);
+    transform.Apply(kPoints.data(), kCount, output.data(), kThreadCount);
+    auto in_place{kPoints};
+    transform.ApplyInPlace(in_place.data(), kCount, kThreadCount);
+    PointCloud<2, double> cloud;
+    transform.Apply(kCloud, cloud, kThreadCount);
+    auto cloud_in_place{kCloud};
+    transform.ApplyInPlace(cloud_in_place, 1);
+    for (std::size_t i = 0; i < kCount; ++i) {
+      const auto kExpected{reference(kPoints[i])};
+      ASSERT_TRUE(IsSamePoint(kExpected, output[i])) << i;
+      ASSERT_TRUE(IsSamePoint(kExpected, in_place[i])) << i;
+      ASSERT_TRUE(IsSamePoint(kExpected, cloud.Get(i).ToPoint2())) << i;
+      ASSERT_TRUE(IsSamePoint(kExpected, cloud_in_place.Get(i).ToPoint2()))
+          << i;
+    }
+  }};
+  kCheck(kTranslation, kTranslated);
+  kCheck(kScaling, kScaled);
+  kCheck(kRotation, kRotated);
+
+  // Empty spans touch nothing.
+  kRotation.Apply(nullptr, 0, nullptr, kThreadCount);
+  kRotation.ApplyInPlace(nullptr, 0, kThreadCount);
+}
+
+TEST(GeometryDifferentialPoint2D, Distances) {
+  std::mt19937_64 engine(17U);
+  const auto kCloud{MakePointCloud(MakeAdversarialPoints(engine, false))};
+  const auto kOther{
+      MakePointCloud(MakeRandomPoints(engine, kCloud.Size(), false))};
+  const auto kCount{kCloud.Size()};
+
+  for (const auto& kQuery : {Point2D(0.0, 0.0), Point2D(-7.5, 1.0e+200)}) {
+    const PointN<2, double> kQueryN(kQuery.GetX(), kQuery.GetY());
+    std::vector<double> squared(kCount);
+    std::vector<double> distances(kCount);
+    CalculateSquaredDistances(kCloud, kQueryN, squared.data());
+    CalculateDistances(kCloud, kQueryN, distances.data());
+    for (std::size_t i = 0; i < kCount; ++i) {
+      const auto kPoint{kCloud.Get(i).ToPoint2()};
+      const auto kDelta{kPoint - kQuery};
+      const auto kSquared{kDelta.GetX() * kDelta.GetX() +
+                          kDelta.GetY() * kDelta.GetY()};
+      ASSERT_LE(GetUlpDistance(kSquared, squared[i]), kDistanceUlp) << i;
+      ASSERT_LE(GetUlpDistance(kPoint.CalculateDistance(kQuery), distances[i]),
+                kDistanceUlp)
+          << i;
+    }
+  }
+
+  std::vector<double> pairwise(kCount);
+  CalculatePairwiseDistances(kCloud, kOther, pairwise.data());
+  for (std::size_t i = 0; i < kCount; ++i) {
+    const auto kExpected{
+        kCloud.Get(i).ToPoint2().CalculateDistance(kOther.Get(i).ToPoint2())};
+    ASSERT_LE(GetUlpDistance(kExpected, pairwise[i]), kDistanceUlp) << i;
+  }
+
+  const PointCloud<2, double> kEmpty;
+  CalculateDistances(kEmpty, PointN<2, double>(0.0, 0.0),
+                     static_cast<double*>(nullptr));
+}
+
+TEST(GeometryDifferentialPoint2D, Selection) {
+  // Finite coordinates; huge ones still give infinite distances.
+  std::mt19937_64 engine(19U);
+  const auto kCloud{MakePointCloud(MakeAdversarialPoints(engine, true))};
+  const auto kCount{kCloud.Size()};
+  const Point2D kQuery(3.0, -1.0);
+  std::vector<double> expected(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    expected[i] = kCloud.Get(i).ToPoint2().CalculateDistance(kQuery);
+  }
+  auto sorted{expected};
+  std::sort(sorted.begin(), sorted.end());
+
+  // Squared keys order like CalculateDistance, up to its rounding ties.
+  const auto kOrder{SortByDistance(kCloud, kQuery, kThreadCount)};
+  ASSERT_EQ(kCount, kOrder.size());
+  std::vector<bool> seen(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    ASSERT_FALSE(seen[kOrder[i]]);
+    seen[kOrder[i]] = true;
+    ASSERT_EQ(sorted[i], expected[kOrder[i]]) << i;
+  }
+  for (const std::size_t kK : {1U, 50U, 5000U}) {
+    const auto kTop{SelectNearest(kCloud, kQuery, kK, kThreadCount)};
+    ASSERT_EQ(kK, kTop.size());
+    for (std::size_t i = 0; i < kK; ++i) {
+      ASSERT_EQ(sorted[i], expected[kTop[i]]) << kK << ", " << i;
+    }
+  }
+
+  const PointCloud<2, double> kEmpty;
+  EXPECT_TRUE(SortByDistance(kEmpty, kQuery).empty());
+  EXPECT_TRUE(SelectNearest(kEmpty, kQuery, 10).empty());
+}
+
+TEST(GeometryDifferentialPoint2D, HotPathsDoNotAllocate) {
+  std::mt19937_64 engine(23U);
+  const auto kPoints{MakeRandomPoints(engine, kTestCount, true)};
+  const auto kCloud{MakePointCloud(kPoints)};
+  const auto kRotation{Transform2D::Rotation(0.5)};
+  const PointN<2, double> kQuery(1.0, 2.0);
+  auto points{kPoints};
+  auto cloud{kCloud};
+  std::vector<double> distances(kTestCount);
+  std::vector<int8_t> signs(kTestCount);
+  std::vector<SegmentSide> sides(kTestCount);
+
+  const AllocationCounter kCounter;
+  const auto kSum{kPoints[0] + kPoints[1] * 2.0 - kPoints[2] / 3.0};
+  static_cast<void>(kPoints[0].CalculateDistance(kSum));
+  static_cast<void>(kRotation.Apply(kSum));
+  kRotation.Apply(kPoints.data(), kTestCount, points.data(), 1);
+  kRotation.ApplyInPlace(points.data(), kTestCount, 1);
+  kRotation.Apply(kCloud, cloud, 1);
+  kRotation.ApplyInPlace(cloud, 1);
+  Assign(Lazy(kPoints) * 2.0 + kSum, points);
+  Assign(Lazy(kCloud) - Lazy(kPoints), cloud);
+  CalculateSquaredDistances(kCloud, kQuery, distances.data());
+  CalculateDistances(kCloud, kQuery, distances.data());
+  CalculatePairwiseDistances(kCloud, cloud, distances.data());
+  static_cast<void>(Orient2D(kPoints[0], kPoints[1], kPoints[2]));
+  static_cast<void>(InCircle(kPoints[0], kPoints[1], kPoints[2], kSum));
+  Orient2D(kPoints[0], kPoints[1], kCloud, signs.data(), 1);
+  InCircle(kPoints[0], kPoints[1], kPoints[2], kCloud, signs.data(), 1);
+  GetSegmentSide(kPoints[0], kPoints[1], kCloud, sides.data(), 1);
+  EXPECT_EQ(0U, kCounter.GetCount());
+
+  // The hook does see allocations.
+  const std::vector<double> kAllocated(1);
+  EXPECT_EQ(1U, kCounter.GetCount());
+}
+}  // namespace zozibush::geometry
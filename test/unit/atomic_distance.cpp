@@ -0,0 +1,123 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/atomic_distance.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+constexpr uint32_t kThreadCount = 4U;
+}  // namespace
+
+namespace zozibush::geometry {
+TEST(GeometryAtomicDistance, Constructor) {
+  AtomicDistance distance1;
+  AtomicDistance distance2(Distance(2023.0, Distance::Type::kKilometer));
+
+  EXPECT_EQ(Distance(), distance1.Load());
+  EXPECT_EQ(Distance(2023.0, Distance::Type::kKilometer), distance2.Load());
+}
+TEST(GeometryAtomicDistance, StoreAndExchange) {
+  AtomicDistance distance;
+  distance.Store(Distance(1.0));
+  EXPECT_EQ(Distance(1.0), distance.Exchange(Distance(2.0)));
+  EXPECT_EQ(Distance(2.0), distance.Load());
+}
+TEST(GeometryAtomicDistance, FetchAddAndSub) {
+  AtomicDistance distance(Distance(10.0));
+
+  EXPECT_EQ(Distance(10.0), distance.FetchAdd(Distance(5.0)));
+  EXPECT_EQ(Distance(15.0), distance.FetchSub(Distance(20.0)));
+  EXPECT_EQ(Distance(-5.0), distance.Load());
+
+  distance += Distance(1.0, Distance::Type::kNanometer);
+  distance -= Distance(2.0, Distance::Type::kNanometer);
+  EXPECT_EQ(Distance(-5.0).GetNanometer() - 1,
+            distance.Load().GetNanometer());
+}
+TEST(GeometryAtomicDistance, CompareExchange) {
+  AtomicDistance distance(Distance(1.0));
+
+  Distance expected(2.0);
+  EXPECT_FALSE(distance.CompareExchange(expected, Distance(3.0)));
+  EXPECT_EQ(Distance(1.0), expected);
+
+  EXPECT_TRUE(distance.CompareExchange(expected, Distance(3.0)));
+  EXPECT_EQ(Distance(3.0), distance.Load());
+}
+TEST(GeometryAtomicDistance, FetchMinAndMax) {
+  AtomicDistance distance(Distance(10.0));
+
+  EXPECT_EQ(Distance(10.0), distance.FetchMin(Distance(20.0)));
+  EXPECT_EQ(Distance(10.0), distance.FetchMin(Distance(5.0)));
+  EXPECT_EQ(Distance(5.0), distance.Load());
+
+  EXPECT_EQ(Distance(5.0), distance.FetchMax(Distance(1.0)));
+  EXPECT_EQ(Distance(5.0), distance.FetchMax(Distance(7.0)));
+  EXPECT_EQ(Distance(7.0), distance.Load());
+}
+TEST(GeometryAtomicDistance, ConcurrentAccumulate) {
+  AtomicDistance total;
+  AtomicDistance minimum(Distance(1.0, Distance::Type::kKilometer));
+  AtomicDistance maximum;
+
+  std::vector<std::thread> workers;
+  for (uint32_t t = 0; t < kThreadCount; ++t) {
+    workers.emplace_back([&, t]() {
+      for (uint32_t i = 0; i < kTestCount; ++i) {
+        const Distance kStep(static_cast<double>(t * kTestCount + i),
+                             Distance::Type::kMillimeter);
+        total.FetchAdd(kStep);
+        minimum.FetchMin(kStep);
+        maximum.FetchMax(kStep);
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  const uint64_t kCount = kThreadCount * kTestCount;
+  EXPECT_EQ(Distance(static_cast<double>(kCount * (kCount - 1) / 2),
+                     Distance::Type::kMillimeter),
+            total.Load());
+  EXPECT_EQ(Distance(), minimum.Load());
+  EXPECT_EQ(
+      Distance(static_cast<double>(kCount - 1), Distance::Type::kMillimeter),
+      maximum.Load());
+}
+TEST(GeometryShardedAtomicDistance, Constructor) {
+  ShardedAtomicDistance distance1;
+  ShardedAtomicDistance distance2(8U);
+
+  EXPECT_LE(1U, distance1.GetShardCount());
+  EXPECT_EQ(8U, distance2.GetShardCount());
+  EXPECT_EQ(Distance(), distance2.Load());
+  EXPECT_THROW(ShardedAtomicDistance(0U), std::invalid_argument);
+}
+TEST(GeometryShardedAtomicDistance, ConcurrentAccumulate) {
+  ShardedAtomicDistance total(kThreadCount);
+
+  std::vector<std::thread> workers;
+  for (uint32_t t = 0; t < kThreadCount; ++t) {
+    workers.emplace_back([&total]() {
+      for (uint32_t i = 0; i < kTestCount; ++i) {
+        total += Distance(3.0);
+        total -= Distance(1.0);
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  EXPECT_EQ(Distance(2.0 * kThreadCount * kTestCount), total.Load());
+  EXPECT_EQ(Distance(2.0 * kThreadCount * kTestCount), total.Drain());
+  EXPECT_EQ(Distance(), total.Load());
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,72 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/batch_distance.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+template <std::size_t D, typename T>
+auto MakeRandomCloud() -> zozibush::geometry::PointCloud<D, T> {
+  zozibush::geometry::PointCloud<D, T> result;
+  result.Resize(kTestCount);
+  for (std::size_t axis = 0; axis < D; ++axis) {
+    for (uint32_t i = 0; i < kTestCount; ++i) {
+      result.Data(axis)[i] = static_cast<T>(std::rand() % 10000);
+    }
+  }
+  return result;
+}
+}  // namespace
+
+namespace zozibush::geometry {
+TEST(GeometryBatchDistance, CalculateDistances2D) {
+  const auto kCloud = MakeRandomCloud<2, double>();
+  const PointN<2> kQuery(123.0, 456.0);
+  std::vector<double> distances(kCloud.Size());
+
+  CalculateDistances(kCloud, kQuery, distances.data());
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    EXPECT_DOUBLE_EQ(kCloud.Get(i).ToPoint2().CalculateDistance(
+                         kQuery.ToPoint2()),
+                     distances[i]);
+  }
+}
+TEST(GeometryBatchDistance, CalculateDistances3F) {
+  const auto kCloud = MakeRandomCloud<3, float>();
+  const Point3F kQuery(1.0F, 2.0F, 3.0F);
+  std::vector<float> distances(kCloud.Size());
+  std::vector<float> squared_distances(kCloud.Size());
+
+  CalculateDistances(kCloud, kQuery, distances.data());
+  CalculateSquaredDistances(kCloud, kQuery, squared_distances.data());
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    EXPECT_FLOAT_EQ(kCloud.Get(i).CalculateDistance(kQuery), distances[i]);
+    EXPECT_FLOAT_EQ(Point3F::CalculateSquaredDistance(kCloud.Get(i), kQuery),
+                    squared_distances[i]);
+  }
+}
+TEST(GeometryBatchDistance, CalculatePairwiseDistances) {
+  const auto kLhs = MakeRandomCloud<3, double>();
+  const auto kRhs = MakeRandomCloud<3, double>();
+  std::vector<double> distances(kLhs.Size());
+
+  CalculatePairwiseDistances(kLhs, kRhs, distances.data());
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    EXPECT_DOUBLE_EQ(kLhs.Get(i).CalculateDistance(kRhs.Get(i)), distances[i]);
+  }
+
+  EXPECT_THROW(
+      CalculatePairwiseDistances(kLhs, PointCloud<3>(), distances.data()),
+      std::invalid_argument);
+}
+TEST(GeometryBatchDistance, Empty) {
+  EXPECT_NO_THROW(CalculateDistances(PointCloud<2>(), PointN<2>(),
+                                     static_cast<double*>(nullptr)));
+}
+}  // namespace zozibush::geometry
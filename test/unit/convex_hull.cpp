@@ -0,0 +1,92 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/convex_hull.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "geometry/predicates.hpp"
+#include "gtest/gtest.h"
+
+namespace zozibush::geometry {
+TEST(GeometryConvexHull, Square) {
+  const PointCloud<2> kCloud({{1.0, 1.0},
+                              {0.0, 0.0},
+                              {2.0, 0.0},
+                              {1.0, 0.0},
+                              {2.0, 2.0},
+                              {0.0, 2.0},
+                              {2.0, 2.0},
+                              {0.0, 1.0}});
+  std::vector<std::size_t> indices{9U};
+
+  EXPECT_EQ(4U, FindConvexHull(kCloud, indices));
+  EXPECT_EQ(std::vector<std::size_t>({1, 2, 4, 5}), indices);
+}
+TEST(GeometryConvexHull, Degenerate) {
+  std::vector<std::size_t> indices;
+
+  EXPECT_EQ(0U, FindConvexHull(PointCloud<2>(), indices));
+  EXPECT_EQ(1U, FindConvexHull(PointCloud<2>({{3.0, 4.0}, {3.0, 4.0}}),
+                               indices));
+  EXPECT_EQ(std::vector<std::size_t>({0}), indices);
+  EXPECT_EQ(2U, FindConvexHull(PointCloud<2>({{1.0, 1.0},
+                                              {3.0, 3.0},
+                                              {0.0, 0.0},
+                                              {2.0, 2.0}}),
+                               indices));
+  EXPECT_EQ(std::vector<std::size_t>({2, 1}), indices);
+}
+TEST(GeometryConvexHull, Random) {
+  // Integer coordinates give many duplicates and points on hull edges, and
+  // more than one block is hulled in parallel.
+  std::mt19937 engine(38U);
+  std::uniform_int_distribution<int32_t> coordinate(-300, 300);
+  PointCloud<2> cloud;
+  std::map<std::pair<double, double>, std::size_t> first;
+  for (std::size_t i = 0; i < 150000U; ++i) {
+    const auto kX{static_cast<double>(coordinate(engine))};
+    const auto kY{static_cast<double>(coordinate(engine)) * 0.1};
+    cloud.PushBack(PointN<2>(kX, kY));
+    first.emplace(std::make_pair(kX, kY), i);
+  }
+
+  std::vector<std::size_t> expected;
+  FindConvexHull(cloud, expected, 1);
+  std::vector<std::size_t> indices;
+  FindConvexHull(cloud, indices, 3);
+  EXPECT_EQ(expected, indices);
+
+  ASSERT_LE(3U, indices.size());
+  const auto kPoint{
+      [&](std::size_t index) { return cloud.Get(index).ToPoint2(); }};
+  for (std::size_t i = 0; i < indices.size(); ++i) {
+    const auto kPrevious{kPoint(indices[(i + indices.size() - 1) %
+                                        indices.size()])};
+    const auto kCurrent{kPoint(indices[i])};
+    const auto kNext{kPoint(indices[(i + 1) % indices.size()])};
+    EXPECT_LT(0.0, Orient2D(kPrevious, kCurrent, kNext));
+    EXPECT_EQ(first.at({kCurrent.GetX(), kCurrent.GetY()}), indices[i]);
+    for (std::size_t j = 0; j < cloud.Size(); j += 7) {
+      ASSERT_LE(0.0, Orient2D(kCurrent, kNext, kPoint(j)));
+    }
+  }
+}
+TEST(GeometryConvexHull, Exception) {
+  std::vector<std::size_t> indices;
+
+  EXPECT_THROW(FindConvexHull(PointCloud<2>({{0.0, std::nan("")}}), indices),
+               std::out_of_range);
+  EXPECT_THROW(
+      FindConvexHull(
+          PointCloud<2>({{std::numeric_limits<double>::infinity(), 0.0}}),
+          indices),
+      std::out_of_range);
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,120 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/dbscan.hpp"
+
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+// Reference DBSCAN with O(n^2) neighbourhoods and the same labelling rules:
+// clusters numbered by lowest core index, border points join the cluster of
+// their lowest index core neighbour.
+auto ClusterBruteForce(const zozibush::geometry::PointCloud<2, double>& cloud,
+                       double eps, std::size_t min_points)
+    -> std::vector<int64_t> {
+  const auto kCount{cloud.Size()};
+  std::vector<std::vector<std::size_t>> neighbours(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    for (std::size_t j = 0; j < kCount; ++j) {
+      if (cloud.Get(i).CalculateDistance(cloud.Get(j)) <= eps) {
+        neighbours[i].push_back(j);
+      }
+    }
+  }
+  std::vector<int64_t> labels(kCount, zozibush::geometry::Dbscan::kNoise);
+  int64_t next{0};
+  for (std::size_t i = 0; i < kCount; ++i) {
+    if (neighbours[i].size() < min_points || labels[i] != -1) {
+      continue;
+    }
+    std::vector<std::size_t> stack{i};
+    labels[i] = next;
+    while (!stack.empty()) {
+      const auto kPoint{stack.back()};
+      stack.pop_back();
+      for (const auto kNeighbour : neighbours[kPoint]) {
+        if (neighbours[kNeighbour].size() >= min_points &&
+            labels[kNeighbour] == -1) {
+          labels[kNeighbour] = next;
+          stack.push_back(kNeighbour);
+        }
+      }
+    }
+    ++next;
+  }
+  for (std::size_t i = 0; i < kCount; ++i) {
+    if (neighbours[i].size() >= min_points) {
+      continue;
+    }
+    for (const auto kNeighbour : neighbours[i]) {
+      if (neighbours[kNeighbour].size() >= min_points) {
+        labels[i] = labels[kNeighbour];
+        break;
+      }
+    }
+  }
+  return labels;
+}
+}  // namespace
+
+namespace zozibush::geometry {
+TEST(GeometryDbscan, Cluster) {
+  const PointCloud<2> kCloud({{0.0, 0.0},
+                              {0.5, 0.0},
+                              {0.0, 0.5},
+                              {1.4, 0.0},
+                              {10.0, 10.0},
+                              {10.5, 10.0},
+                              {10.0, 10.5},
+                              {50.0, 50.0}});
+  const Dbscan kDbscan(Distance(1.0), 3);
+  std::vector<int64_t> labels(kCloud.Size());
+
+  EXPECT_EQ(2U, kDbscan.Cluster(kCloud, labels.data()));
+  EXPECT_EQ(std::vector<int64_t>({0, 0, 0, 0, 1, 1, 1, Dbscan::kNoise}),
+            labels);
+}
+TEST(GeometryDbscan, Random) {
+  std::mt19937 engine(19U);
+  std::uniform_real_distribution<double> center(0.0, 1000.0);
+  std::normal_distribution<double> spread(0.0, 8.0);
+  std::uniform_real_distribution<double> noise(0.0, 1000.0);
+  PointCloud<2> cloud;
+  for (uint32_t blob = 0; blob < 20U; ++blob) {
+    const auto kX{center(engine)};
+    const auto kY{center(engine)};
+    for (uint32_t i = 0; i < 60U; ++i) {
+      cloud.PushBack(PointN<2>(kX + spread(engine), kY + spread(engine)));
+    }
+  }
+  for (uint32_t i = 0; i < 400U; ++i) {
+    cloud.PushBack(PointN<2>(noise(engine), noise(engine)));
+  }
+
+  const auto kExpected{ClusterBruteForce(cloud, 5.0, 4)};
+  const Dbscan kDbscan(Distance(5.0), 4);
+  std::vector<int64_t> labels(cloud.Size());
+  for (const std::size_t kThreadCount : {1U, 4U}) {
+    kDbscan.Cluster(cloud, labels.data(), kThreadCount);
+    EXPECT_EQ(kExpected, labels);
+  }
+}
+TEST(GeometryDbscan, Unit) {
+  const PointCloud<2> kCloud({{0.0, 0.0}, {40.0, 0.0}, {80.0, 0.0}});
+  std::vector<int64_t> labels(kCloud.Size());
+
+  EXPECT_EQ(1U, Dbscan(Distance(0.05), 2, Distance::Type::kMillimeter)
+                    .Cluster(kCloud, labels.data()));
+  EXPECT_EQ(0U, Dbscan(Distance(0.03), 2, Distance::Type::kMillimeter)
+                    .Cluster(kCloud, labels.data()));
+}
+TEST(GeometryDbscan, Exception) {
+  EXPECT_THROW(Dbscan(Distance(0.0), 3), std::invalid_argument);
+  EXPECT_THROW(Dbscan(Distance(1.0), 0), std::invalid_argument);
+  EXPECT_EQ(0U, Dbscan(Distance(1.0), 1).Cluster(PointCloud<2>(), nullptr));
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,143 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/delaunay.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "geometry/predicates.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+auto CalculateHullArea(const zozibush::geometry::Delaunay& delaunay) -> double {
+  const auto& kHull{delaunay.GetHull()};
+  auto result{0.0};
+  for (std::size_t i = 0; i < kHull.size(); ++i) {
+    const auto kA{delaunay.GetPoint(kHull[i])};
+    const auto kB{delaunay.GetPoint(kHull[(i + 1) % kHull.size()])};
+    result += kA.GetX() * kB.GetY() - kB.GetX() * kA.GetY();
+  }
+  return result * 0.5;
+}
+
+// Structure, orientation, local Delaunay property and area coverage.
+auto ExpectValid(const zozibush::geometry::Delaunay& delaunay) -> void {
+  using zozibush::geometry::Delaunay;
+  const auto& kTriangles{delaunay.GetTriangles()};
+  const auto& kHalfEdges{delaunay.GetHalfEdges()};
+  ASSERT_EQ(kTriangles.size(), kHalfEdges.size());
+  ASSERT_EQ(0U, kTriangles.size() % 3);
+
+  auto area{0.0};
+  std::size_t hull_edge_count{0};
+  for (uint32_t edge = 0; edge < kTriangles.size(); ++edge) {
+    const auto kStart{delaunay.GetPoint(kTriangles[edge])};
+    const auto kEnd{
+        delaunay.GetPoint(kTriangles[Delaunay::NextHalfEdge(edge)])};
+    const auto kOther{
+        delaunay.GetPoint(kTriangles[Delaunay::PreviousHalfEdge(edge)])};
+    if (edge % 3 == 0) {
+      const auto kOrientation{zozibush::geometry::Orient2D(kStart, kEnd,
+                                                           kOther)};
+      EXPECT_GT(kOrientation, 0.0);
+      area += kOrientation * 0.5;
+    }
+
+    const auto kOpposite{kHalfEdges[edge]};
+    if (kOpposite == Delaunay::kInvalid) {
+      ++hull_edge_count;
+      continue;
+    }
+    ASSERT_EQ(edge, kHalfEdges[kOpposite]);
+    EXPECT_EQ(kTriangles[edge],
+              kTriangles[Delaunay::NextHalfEdge(kOpposite)]);
+    EXPECT_EQ(kTriangles[Delaunay::NextHalfEdge(edge)],
+              kTriangles[kOpposite]);
+    const auto kFar{
+        delaunay.GetPoint(kTriangles[Delaunay::PreviousHalfEdge(kOpposite)])};
+    EXPECT_LE(zozibush::geometry::InCircle(kStart, kEnd, kOther, kFar), 0.0);
+  }
+  EXPECT_EQ(delaunay.GetHull().size(), hull_edge_count);
+  EXPECT_NEAR(CalculateHullArea(delaunay), area,
+              std::abs(area) * 1e-12 + 1e-12);
+}
+}  // namespace
+
+namespace zozibush::geometry {
+TEST(GeometryDelaunay, Square) {
+  const Delaunay kDelaunay(
+      PointCloud<2>({{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 1.0}}));
+
+  EXPECT_EQ(2U, kDelaunay.GetTriangleCount());
+  EXPECT_EQ(4U, kDelaunay.GetHull().size());
+  ExpectValid(kDelaunay);
+}
+TEST(GeometryDelaunay, Random) {
+  std::mt19937 engine(47U);
+  std::uniform_real_distribution<double> coordinate(-1000.0, 1000.0);
+  PointCloud<2> cloud;
+  for (uint32_t i = 0; i < 20000U; ++i) {
+    cloud.PushBack(PointN<2>(coordinate(engine), coordinate(engine)));
+  }
+  const Delaunay kDelaunay(cloud);
+
+  EXPECT_EQ(2 * cloud.Size() - 2 - kDelaunay.GetHull().size(),
+            kDelaunay.GetTriangleCount());
+  ExpectValid(kDelaunay);
+}
+TEST(GeometryDelaunay, EmptyCircle) {
+  std::mt19937 engine(53U);
+  std::uniform_real_distribution<double> coordinate(0.0, 1.0);
+  PointCloud<2> cloud;
+  for (uint32_t i = 0; i < 300U; ++i) {
+    cloud.PushBack(PointN<2>(coordinate(engine), coordinate(engine)));
+  }
+  const Delaunay kDelaunay(cloud);
+  const auto& kTriangles = kDelaunay.GetTriangles();
+
+  for (std::size_t edge = 0; edge < kTriangles.size(); edge += 3) {
+    for (uint32_t i = 0; i < cloud.Size(); ++i) {
+      EXPECT_LE(InCircle(kDelaunay.GetPoint(kTriangles[edge]),
+                         kDelaunay.GetPoint(kTriangles[edge + 1]),
+                         kDelaunay.GetPoint(kTriangles[edge + 2]),
+                         kDelaunay.GetPoint(i)),
+                0.0);
+    }
+  }
+}
+TEST(GeometryDelaunay, Degenerate) {
+  // Cocircular and collinear subsets everywhere, plus duplicates.
+  PointCloud<2> grid;
+  for (int32_t x = 0; x < 30; ++x) {
+    for (int32_t y = 0; y < 30; ++y) {
+      grid.PushBack(PointN<2>(x * 0.1, y * 0.1));
+    }
+  }
+  grid.PushBack(PointN<2>(1.0, 1.0));
+  grid.PushBack(PointN<2>(0.0, 0.0));
+  const Delaunay kGrid(grid);
+  EXPECT_EQ(2U * 29U * 29U, kGrid.GetTriangleCount());
+  ExpectValid(kGrid);
+
+  const Delaunay kLine(
+      PointCloud<2>({{2.0, 2.0}, {0.0, 0.0}, {1.0, 1.0}, {1.0, 1.0}}));
+  EXPECT_EQ(0U, kLine.GetTriangleCount());
+  EXPECT_EQ(std::vector<uint32_t>({1, 2, 0}), kLine.GetHull());
+
+  const Delaunay kSingle(PointCloud<2>({{1.0, 1.0}, {1.0, 1.0}}));
+  EXPECT_EQ(0U, kSingle.GetTriangleCount());
+  EXPECT_EQ(1U, kSingle.GetHull().size());
+
+  EXPECT_EQ(0U, Delaunay(PointCloud<2>()).GetTriangleCount());
+}
+TEST(GeometryDelaunay, Exception) {
+  EXPECT_THROW(Delaunay(PointCloud<2>(
+                   {{0.0, 0.0}, {std::numeric_limits<double>::quiet_NaN(),
+                                 1.0}})),
+               std::out_of_range);
+}
+}  // namespace zozibush::geometry
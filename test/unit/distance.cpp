@@ -3,6 +3,7 @@
 #include "geometry/distance.hpp"
 
 #include <cmath>
+#include <functional>
 
 #include "gtest/gtest.h"
 
@@ -328,4 +329,13 @@ TEST(GeometryDistance, OperatorDivideAccumulate) {
   EXPECT_THROW(distance /= 0.0, std::invalid_argument);
   EXPECT_NO_THROW(distance /= kScaleValue);
 }
+TEST(GeometryDistance, Hash) {
+  const std::hash<Distance> kHash;
+
+  EXPECT_EQ(kHash(Distance(1.0)), kHash(Distance(1000.0,
+                                                 Distance::Type::kMillimeter)));
+  EXPECT_NE(kHash(Distance(1.0)), kHash(Distance(2.0)));
+  EXPECT_NE(kHash(Distance::FromNanometer(1)),
+            kHash(Distance::FromNanometer(-1)));
+}
 }  // namespace zozibush::geometry
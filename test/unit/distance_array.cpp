@@ -0,0 +1,143 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/distance_array.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+}
+
+namespace zozibush::geometry {
+TEST(GeometryDistanceArray, ConvertToNanometers) {
+  std::vector<double> values(kTestCount);
+  for (auto& value : values) {
+    value = static_cast<double>(std::rand() % 100000);
+  }
+  std::vector<int64_t> nanometers(values.size());
+
+  ConvertToNanometers(values.data(), values.size(), Distance::Type::kMeter,
+                      nanometers.data());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(Distance(values[i], Distance::Type::kMeter).GetNanometer(),
+              nanometers[i]);
+  }
+}
+TEST(GeometryDistanceArray, ConvertToNanometersRounding) {
+  const std::vector<double> values{0.3, -0.3, 1.0e-9, 0.7e-9};
+  std::vector<int64_t> nanometers(values.size());
+
+  ConvertToNanometers(values.data(), values.size(), Distance::Type::kMeter,
+                      nanometers.data());
+  EXPECT_EQ(300000000, nanometers[0]);
+  EXPECT_EQ(-300000000, nanometers[1]);
+  EXPECT_EQ(1, nanometers[2]);
+  EXPECT_EQ(1, nanometers[3]);
+}
+TEST(GeometryDistanceArray, ConvertToNanometersHalfToEven) {
+  // Halves, and values on both sides of the 2^51 nm fast path limit.
+  const std::vector<double> values{0.5,
+                                   1.5,
+                                   2.5,
+                                   -0.5,
+                                   -2.5,
+                                   -0.0,
+                                   2251799813685247.5,
+                                   2251799813685248.0,
+                                   -2251799813685249.0,
+                                   4503599627370497.0};
+  std::vector<int64_t> nanometers(values.size());
+
+  ConvertToNanometers(values.data(), values.size(),
+                      Distance::Type::kNanometer, nanometers.data());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(static_cast<int64_t>(std::nearbyint(values[i])), nanometers[i])
+        << values[i];
+  }
+}
+TEST(GeometryDistanceArray, ConvertToNanometersOverflow) {
+  std::vector<int64_t> nanometers(3, -1);
+
+  const std::vector<double> too_big{1.0, 1.0e+10, 2.0};
+  EXPECT_THROW(ConvertToNanometers(too_big.data(), too_big.size(),
+                                   Distance::Type::kKilometer,
+                                   nanometers.data()),
+               std::out_of_range);
+  EXPECT_EQ(1000000000000, nanometers[0]);
+  EXPECT_EQ(0, nanometers[1]);
+  EXPECT_EQ(2000000000000, nanometers[2]);
+
+  const std::vector<double> not_number{std::nan("")};
+  EXPECT_THROW(ConvertToNanometers(not_number.data(), not_number.size(),
+                                   Distance::Type::kMeter, nanometers.data()),
+               std::out_of_range);
+
+  const std::vector<double> infinity{std::numeric_limits<double>::infinity()};
+  EXPECT_THROW(ConvertToNanometers(infinity.data(), infinity.size(),
+                                   Distance::Type::kMeter, nanometers.data()),
+               std::out_of_range);
+
+  EXPECT_NO_THROW(ConvertToNanometers(nullptr, 0, Distance::Type::kMeter,
+                                      nanometers.data()));
+}
+TEST(GeometryDistanceArray, ConvertFromNanometers) {
+  const std::vector<int64_t> nanometers{2023000000000000, -1000000000000, 0};
+  std::vector<double> values(nanometers.size());
+
+  ConvertFromNanometers(nanometers.data(), nanometers.size(),
+                        Distance::Type::kKilometer, values.data());
+  EXPECT_DOUBLE_EQ(2023.0, values[0]);
+  EXPECT_DOUBLE_EQ(-1.0, values[1]);
+  EXPECT_DOUBLE_EQ(0.0, values[2]);
+
+  ConvertFromNanometers(nanometers.data(), nanometers.size(),
+                        Distance::Type::kMillimeter, values.data());
+  EXPECT_DOUBLE_EQ(2023000000.0, values[0]);
+  EXPECT_DOUBLE_EQ(-1000000.0, values[1]);
+}
+TEST(GeometryDistanceArray, ConvertDistancesRoundTrip) {
+  std::vector<double> values(kTestCount);
+  for (auto& value : values) {
+    value = static_cast<double>(std::rand() % 100000);
+  }
+  std::vector<Distance> distances(values.size());
+  std::vector<double> result(values.size());
+
+  ConvertToDistances(values.data(), values.size(),
+                     Distance::Type::kCentimeter, distances.data());
+  ConvertFromDistances(distances.data(), distances.size(),
+                       Distance::Type::kCentimeter, result.data());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(Distance(values[i], Distance::Type::kCentimeter), distances[i]);
+    EXPECT_DOUBLE_EQ(values[i], result[i]);
+  }
+}
+TEST(GeometryDistanceArray, DumpAndLoad) {
+  std::vector<Distance> distances;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    distances.push_back(
+        Distance::FromNanometer(static_cast<int64_t>(std::rand()) - 1000));
+  }
+  distances.push_back(
+      Distance::FromNanometer(std::numeric_limits<int64_t>::max()));
+  distances.push_back(
+      Distance::FromNanometer(std::numeric_limits<int64_t>::min()));
+
+  const auto kBytes = DumpDistances(distances);
+  ASSERT_EQ(distances.size() * sizeof(int64_t), kBytes.size());
+  EXPECT_EQ(0xFF, kBytes[kTestCount * sizeof(int64_t)]);
+
+  const auto kLoaded = LoadDistances(kBytes.data(), kBytes.size());
+  EXPECT_EQ(distances, kLoaded);
+
+  EXPECT_TRUE(LoadDistances(nullptr, 0).empty());
+  EXPECT_TRUE(DumpDistances({}).empty());
+  EXPECT_THROW(LoadDistances(kBytes.data(), 7), std::invalid_argument);
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,87 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/distance_selection.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+// More than one range of the selection.
+constexpr uint32_t kTestCount = 300000U;
+
+auto SortBySquaredDistance(
+    const zozibush::geometry::PointCloud<2, double>& cloud, double query_x,
+    double query_y) -> std::vector<std::size_t> {
+  std::vector<double> squared(cloud.Size());
+  for (std::size_t i = 0; i < cloud.Size(); ++i) {
+    const auto kDx{cloud.Data(0)[i] - query_x};
+    const auto kDy{cloud.Data(1)[i] - query_y};
+    squared[i] = kDx * kDx + kDy * kDy;
+  }
+  std::vector<std::size_t> indices(cloud.Size());
+  std::iota(indices.begin(), indices.end(), std::size_t{0});
+  std::stable_sort(indices.begin(), indices.end(),
+                   [&](std::size_t lhs, std::size_t rhs) {
+                     return squared[lhs] < squared[rhs];
+                   });
+  return indices;
+}
+}  // namespace
+
+namespace zozibush::geometry {
+TEST(GeometryDistanceSelection, Points) {
+  // Integer coordinates, so many points tie.
+  std::mt19937 engine(3U);
+  std::uniform_int_distribution<int32_t> coordinate(-300, 300);
+  PointCloud<2, double> cloud;
+  cloud.Resize(kTestCount);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    cloud.Data(0)[i] = coordinate(engine);
+    cloud.Data(1)[i] = coordinate(engine);
+  }
+  const Point2D kQuery(0.5, -7.25);
+  const auto kExpected{
+      SortBySquaredDistance(cloud, kQuery.GetX(), kQuery.GetY())};
+
+  EXPECT_EQ(kExpected, SortByDistance(cloud, kQuery, 1));
+  EXPECT_EQ(kExpected, SortByDistance(cloud, kQuery, 4));
+  for (const std::size_t kK : {0U, 1U, 50U, 1000U, kTestCount / 2}) {
+    const std::vector<std::size_t> kTop(kExpected.begin(),
+                                        kExpected.begin() + kK);
+    EXPECT_EQ(kTop, SelectNearest(cloud, kQuery, kK, 1)) << kK;
+    EXPECT_EQ(kTop, SelectNearest(cloud, kQuery, kK, 4)) << kK;
+  }
+  EXPECT_EQ(kExpected, SelectNearest(cloud, kQuery, kTestCount + 1, 4));
+
+  PointCloud<2, double> empty;
+  EXPECT_TRUE(SortByDistance(empty, kQuery).empty());
+  EXPECT_TRUE(SelectNearest(empty, kQuery, 5).empty());
+}
+TEST(GeometryDistanceSelection, Distances) {
+  std::mt19937_64 engine(5U);
+  std::uniform_int_distribution<int64_t> nanometer(-(int64_t{1} << 40),
+                                                   int64_t{1} << 40);
+  std::vector<Distance> distances;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    distances.push_back(Distance::FromNanometer(nanometer(engine) / 1024));
+  }
+  distances[7] = distances[3];
+
+  std::vector<std::size_t> expected(kTestCount);
+  std::iota(expected.begin(), expected.end(), std::size_t{0});
+  std::stable_sort(expected.begin(), expected.end(),
+                   [&](std::size_t lhs, std::size_t rhs) {
+                     return distances[lhs].GetNanometer() <
+                            distances[rhs].GetNanometer();
+                   });
+  EXPECT_EQ(expected, SortByDistance(distances.data(), kTestCount, 4));
+  const std::vector<std::size_t> kTop(expected.begin(), expected.begin() + 50);
+  EXPECT_EQ(kTop, SelectSmallest(distances.data(), kTestCount, 50, 4));
+  EXPECT_EQ(kTop, SelectSmallest(distances.data(), kTestCount, 50, 1));
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,169 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/geodesic.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+constexpr double kPi = 3.14159265358979323846;
+
+auto ToMeter(const zozibush::geometry::Distance& distance) -> double {
+  return distance.GetValue(zozibush::geometry::Distance::Type::kMeter);
+}
+
+auto MakeRandomCloud(std::mt19937& engine)
+    -> zozibush::geometry::PointCloud<2, double> {
+  std::uniform_real_distribution<double> longitude(-180.0, 180.0);
+  std::uniform_real_distribution<double> latitude(-89.0, 89.0);
+  zozibush::geometry::PointCloud<2, double> result;
+  result.Resize(kTestCount);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    result.Data(0)[i] = longitude(engine);
+    result.Data(1)[i] = latitude(engine);
+  }
+  return result;
+}
+}  // namespace
+
+namespace zozibush::geometry {
+TEST(GeometryGeodesic, EquatorDegree) {
+  const Point2D kLhs(0.0, 0.0);
+  const Point2D kRhs(1.0, 0.0);
+  const auto kExpected{Geodesic::kEarthRadius * kPi / 180.0};
+
+  EXPECT_NEAR(kExpected,
+              ToMeter(Geodesic::CalculateHaversineDistance(kLhs, kRhs)), 1e-6);
+  EXPECT_NEAR(kExpected,
+              ToMeter(Geodesic::CalculateDistance(
+                  kLhs, kRhs, Geodesic::Method::kFastHaversine)),
+              1e-6);
+  EXPECT_NEAR(kExpected,
+              ToMeter(Geodesic::CalculateEquirectangularDistance(kLhs, kRhs)),
+              1e-6);
+  EXPECT_EQ(Distance(0.0),
+            Geodesic::CalculateVincentyDistance(kLhs, kLhs));
+}
+TEST(GeometryGeodesic, Vincenty) {
+  // Flinders Peak to Buninyong, the reference case of Vincenty's paper.
+  const Point2D kFlindersPeak(144.0 + 25.0 / 60.0 + 29.52440 / 3600.0,
+                              -(37.0 + 57.0 / 60.0 + 3.72030 / 3600.0));
+  const Point2D kBuninyong(143.0 + 55.0 / 60.0 + 35.38390 / 3600.0,
+                           -(37.0 + 39.0 / 60.0 + 10.15610 / 3600.0));
+
+  EXPECT_NEAR(54972.271,
+              ToMeter(Geodesic::CalculateVincentyDistance(kFlindersPeak,
+                                                          kBuninyong)),
+              1e-3);
+  EXPECT_THROW(static_cast<void>(Geodesic::CalculateVincentyDistance(
+                   Point2D(0.0, 0.0), Point2D(179.7, 0.5))),
+               std::domain_error);
+
+  // A batch throws only after writing every distance, 0 for the failures.
+  PointCloud<2> cloud;
+  cloud.PushBack(PointN<2, double>(kBuninyong.GetX(), kBuninyong.GetY()));
+  cloud.PushBack(PointN<2, double>(179.7, 0.5));
+  cloud.PushBack(PointN<2, double>(kBuninyong.GetX(), kBuninyong.GetY()));
+  std::vector<Distance> distances(cloud.Size(), Distance(1.0));
+  EXPECT_THROW(Geodesic::CalculateDistances(cloud, Point2D(0.0, 0.0),
+                                            distances.data(),
+                                            Geodesic::Method::kVincenty),
+               std::domain_error);
+  EXPECT_EQ(Distance(), distances[1]);
+  EXPECT_EQ(distances[0], distances[2]);
+  EXPECT_EQ(Geodesic::CalculateVincentyDistance(Point2D(0.0, 0.0), kBuninyong),
+            distances[2]);
+
+  cloud.Data(1)[0] = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_THROW(Geodesic::CalculateDistances(cloud, Point2D(0.0, 0.0),
+                                            distances.data(),
+                                            Geodesic::Method::kVincenty),
+               std::out_of_range);
+  EXPECT_EQ(Distance(), distances[0]);
+  EXPECT_THROW(static_cast<void>(Geodesic::CalculateVincentyDistance(
+                   cloud.Get(0).ToPoint2(), kBuninyong)),
+               std::out_of_range);
+}
+TEST(GeometryGeodesic, FastHaversine) {
+  std::mt19937 engine(7U);
+  const auto kLhs = MakeRandomCloud(engine);
+  const auto kRhs = MakeRandomCloud(engine);
+
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kLhsPoint = kLhs.Get(i).ToPoint2();
+    const auto kRhsPoint = kRhs.Get(i).ToPoint2();
+    EXPECT_NEAR(
+        ToMeter(Geodesic::CalculateHaversineDistance(kLhsPoint, kRhsPoint)),
+        ToMeter(Geodesic::CalculateDistance(kLhsPoint, kRhsPoint,
+                                            Geodesic::Method::kFastHaversine)),
+        1e-3);
+  }
+}
+TEST(GeometryGeodesic, Equirectangular) {
+  std::mt19937 engine(11U);
+  std::uniform_real_distribution<double> offset(-0.5, 0.5);
+  const Point2D kOrigin(126.97, 37.56);
+
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const Point2D kTarget(kOrigin.GetX() + offset(engine),
+                          kOrigin.GetY() + offset(engine));
+    const auto kExpected{
+        ToMeter(Geodesic::CalculateHaversineDistance(kOrigin, kTarget))};
+    EXPECT_NEAR(kExpected,
+                ToMeter(Geodesic::CalculateEquirectangularDistance(kOrigin,
+                                                                   kTarget)),
+                kExpected * 1e-3);
+  }
+  // Longitude difference wraps around the antimeridian.
+  EXPECT_NEAR(ToMeter(Geodesic::CalculateEquirectangularDistance(
+                  Point2D(179.5, 0.0), Point2D(-179.5, 0.0))),
+              Geodesic::kEarthRadius * kPi / 180.0, 1e-6);
+}
+TEST(GeometryGeodesic, CalculateDistances) {
+  std::mt19937 engine(13U);
+  const auto kCloud = MakeRandomCloud(engine);
+  const Point2D kOrigin(10.0, 20.0);
+  std::vector<Distance> distances(kCloud.Size());
+
+  for (const auto kMethod :
+       {Geodesic::Method::kEquirectangular, Geodesic::Method::kFastHaversine,
+        Geodesic::Method::kHaversine}) {
+    Geodesic::CalculateDistances(kCloud, kOrigin, distances.data(), kMethod);
+    for (uint32_t i = 0; i < kTestCount; ++i) {
+      EXPECT_EQ(Geodesic::CalculateDistance(kOrigin, kCloud.Get(i).ToPoint2(),
+                                            kMethod),
+                distances[i]);
+    }
+  }
+
+  auto cloud{kCloud};
+  cloud.Data(0)[3] = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_THROW(Geodesic::CalculateDistances(cloud, kOrigin, distances.data()),
+               std::out_of_range);
+}
+TEST(GeometryGeodesic, CalculatePairwiseDistances) {
+  std::mt19937 engine(17U);
+  const auto kLhs = MakeRandomCloud(engine);
+  const auto kRhs = MakeRandomCloud(engine);
+  std::vector<Distance> distances(kLhs.Size());
+
+  Geodesic::CalculatePairwiseDistances(kLhs, kRhs, distances.data(),
+                                       Geodesic::Method::kHaversine);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    EXPECT_EQ(Geodesic::CalculateHaversineDistance(kLhs.Get(i).ToPoint2(),
+                                                   kRhs.Get(i).ToPoint2()),
+              distances[i]);
+  }
+
+  EXPECT_THROW(Geodesic::CalculatePairwiseDistances(
+                   kLhs, PointCloud<2>(), distances.data()),
+               std::invalid_argument);
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,314 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+//
+// Option parsing, point files and result output of the geometry tool.
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "jobs.hpp"
+#include "options.hpp"
+#include "point_io.hpp"
+#include "stage_report.hpp"
+
+namespace {
+auto GetTempPath(const std::string& name) -> std::string {
+  return ::testing::TempDir() + "geometry_cli_" + name;
+}
+
+auto WriteFile(const std::string& path, const std::string& content) -> void {
+  auto* file{std::fopen(path.c_str(), "wb")};
+  ASSERT_NE(nullptr, file) << path;
+  ASSERT_EQ(content.size(),
+            std::fwrite(content.data(), 1, content.size(), file));
+  std::fclose(file);
+}
+
+auto ReadFile(const std::string& path) -> std::string {
+  auto* file{std::fopen(path.c_str(), "rb")};
+  if (file == nullptr) {
+    return {};
+  }
+  std::string content;
+  char buffer[4096];
+  std::size_t size{0};
+  while ((size = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    content.append(buffer, size);
+  }
+  std::fclose(file);
+  return content;
+}
+
+auto Parse(std::vector<const char*> arguments)
+    -> zozibush::geometry::application::Options {
+  arguments.insert(arguments.begin(), "geometry");
+  return zozibush::geometry::application::ParseOptions(
+      static_cast<int>(arguments.size()), arguments.data());
+}
+
+// The message of the runtime_error thrown by ReadPoints, empty if none.
+auto GetReadError(const std::string& path,
+                  zozibush::geometry::application::PointFormat format)
+    -> std::string {
+  zozibush::geometry::PointCloud<2, double> points;
+  try {
+    static_cast<void>(
+        zozibush::geometry::application::ReadPoints(path, format, points));
+  } catch (const std::runtime_error& error) {
+    return error.what();
+  }
+  return {};
+}
+}  // namespace
+
+namespace zozibush::geometry::application {
+TEST(GeometryCli, ParseOptions) {
+  const auto kRadius{Parse({"radius", "--input", "points.bin",
+                            "--queries=queries.txt", "--radius", "250mm",
+                            "--threads", "4", "--quiet"})};
+  EXPECT_EQ("radius", kRadius.job);
+  EXPECT_EQ("points.bin", kRadius.input_path);
+  EXPECT_EQ("queries.txt", kRadius.query_path);
+  EXPECT_EQ("-", kRadius.output_path);
+  EXPECT_EQ(PointFormat::kAuto, kRadius.input_format);
+  EXPECT_DOUBLE_EQ(0.25, kRadius.radius);
+  EXPECT_EQ(4U, kRadius.thread_count);
+  EXPECT_TRUE(kRadius.quiet);
+
+  // Lengths are converted to the coordinate unit wherever --unit appears.
+  const auto kSimplify{Parse({"simplify", "--tolerance", "1km", "--unit",
+                              "mm", "--input", "-", "--format", "text",
+                              "--method", "vw", "--output", "out.txt"})};
+  EXPECT_DOUBLE_EQ(1.0e+6, kSimplify.tolerance);
+  EXPECT_EQ(Distance::Type::kMillimeter, kSimplify.unit);
+  EXPECT_EQ(PointFormat::kText, kSimplify.input_format);
+  EXPECT_EQ(PolylineSimplifier::Method::kVisvalingamWhyatt,
+            kSimplify.method);
+  EXPECT_EQ("out.txt", kSimplify.output_path);
+  EXPECT_DOUBLE_EQ(2.5, Parse({"dedup", "--input", "p", "--tolerance",
+                               "2.5"}).tolerance);
+
+  const auto kDistance{
+      Parse({"distance", "--input", "p", "--query", "1.5,-2e3"})};
+  EXPECT_TRUE(kDistance.has_query_point);
+  EXPECT_DOUBLE_EQ(1.5, kDistance.query_x);
+  EXPECT_DOUBLE_EQ(-2.0e+3, kDistance.query_y);
+
+  // Help wins over everything after it, even a malformed command line.
+  EXPECT_TRUE(Parse({"--help", "--bogus"}).help);
+  EXPECT_TRUE(Parse({"nearest", "-h"}).help);
+}
+
+TEST(GeometryCli, ParseOptionsErrors) {
+  const std::vector<std::vector<const char*>> kInvalid{
+      // Unknown flags and stray arguments.
+      {"hull", "--input", "p", "--bogus", "1"},
+      {"hull", "--input", "p", "-x"},
+      {"hull", "extra", "--input", "p"},
+      // Missing values.
+      {"hull", "--input"},
+      {"hull", "--input", "p", "--threads"},
+      // Malformed numbers.
+      {"hull", "--input", "p", "--threads", "x"},
+      {"hull", "--input", "p", "--threads", "4x"},
+      {"hull", "--input", "p", "--threads", "-1"},
+      {"hull", "--input", "p", "--threads="},
+      {"distance", "--input", "p", "--query", "1,a"},
+      {"distance", "--input", "p", "--query", "1"},
+      {"distance", "--input", "p", "--query", "1,2,3"},
+      {"distance", "--input", "p", "--query", "inf,0"},
+      {"dedup", "--input", "p", "--tolerance", "abc"},
+      {"dedup", "--input", "p", "--tolerance", "1..5"},
+      {"dedup", "--input", "p", "--tolerance", "1e999"},
+      // Unknown names.
+      {"dedup", "--input", "p", "--tolerance", "5xx"},
+      {"hull", "--input", "p", "--unit", "ft"},
+      {"hull", "--input", "p", "--format", "csv"},
+      {"simplify", "--input", "p", "--method", "rdp"},
+      {"sort", "--input", "p"},
+      // Missing or contradicting options of a job.
+      {},
+      {"--input", "p"},
+      {"hull"},
+      {"distance", "--input", "p"},
+      {"distance", "--input", "p", "--query", "0,0", "--queries", "q"},
+      {"nearest", "--input", "p"},
+      {"radius", "--input", "p", "--queries", "q"},
+      {"radius", "--input", "p", "--queries", "q", "--radius", "0"},
+      {"dedup", "--input", "p", "--tolerance", "-1"},
+      {"dedup", "--input", "p", "--tolerance", "-1m"},
+  };
+  for (const auto& kArguments : kInvalid) {
+    std::string command_line;
+    for (const auto* argument : kArguments) {
+      command_line += std::string(" ") + argument;
+    }
+    EXPECT_THROW(static_cast<void>(Parse(kArguments)), std::invalid_argument)
+        << command_line;
+  }
+}
+
+TEST(GeometryCli, ReadText) {
+  const auto kPath{GetTempPath("text.txt")};
+  const std::string kContent{
+      "# x y\n1 2\n  3.5,-4  # comment\n\n\t5 ,\t6\r\n-1e-3 7e+2"};
+  WriteFile(kPath, kContent);
+
+  PointCloud<2, double> points;
+  points.Resize(10);
+  EXPECT_EQ(kContent.size(), ReadPoints(kPath, PointFormat::kAuto, points));
+  ASSERT_EQ(4U, points.Size());
+  const std::vector<double> kX(points.Data(0), points.Data(0) + 4);
+  const std::vector<double> kY(points.Data(1), points.Data(1) + 4);
+  EXPECT_EQ((std::vector<double>{1.0, 3.5, 5.0, -1.0e-3}), kX);
+  EXPECT_EQ((std::vector<double>{2.0, -4.0, 6.0, 7.0e+2}), kY);
+
+  WriteFile(kPath, "# only comments\n\n");
+  EXPECT_EQ(17U, ReadPoints(kPath, PointFormat::kText, points));
+  EXPECT_EQ(0U, points.Size());
+  std::remove(kPath.c_str());
+}
+
+TEST(GeometryCli, ReadTextErrors) {
+  const auto kPath{GetTempPath("malformed.txt")};
+  const std::vector<std::pair<std::string, std::string>> kMalformed{
+      {"1 2\n3 x\n", ":2: malformed point"},
+      {"1 2\n3\n", ":2: malformed point"},
+      {"1 2\n3", ":2: malformed point"},
+      {"1,,2\n", ":1: malformed point"},
+      {"x 1\n", ":1: malformed point"},
+      {"1 2\n\n3 4 5\n", ":3: trailing characters"},
+      {"1 2,\n", ":1: trailing characters"},
+      {"1 2 # ok\n3 4 ; 5\n", ":2: trailing characters"},
+  };
+  for (const auto& [kContent, kMessage] : kMalformed) {
+    WriteFile(kPath, kContent);
+    EXPECT_EQ(kPath + kMessage, GetReadError(kPath, PointFormat::kText))
+        << kContent;
+  }
+  std::remove(kPath.c_str());
+
+  EXPECT_EQ("cannot open " + kPath, GetReadError(kPath, PointFormat::kText));
+}
+
+TEST(GeometryCli, ReadBinary) {
+  const std::vector<double> kValues{1.0, 2.0, -3.5, 4.25,
+                                    std::numeric_limits<double>::max(), 0.0};
+  const std::string kContent(reinterpret_cast<const char*>(kValues.data()),
+                             kValues.size() * sizeof(double));
+  const auto kPath{GetTempPath("points.bin")};
+  WriteFile(kPath, kContent);
+
+  PointCloud<2, double> points;
+  EXPECT_EQ(kContent.size(), ReadPoints(kPath, PointFormat::kAuto, points));
+  ASSERT_EQ(3U, points.Size());
+  for (std::size_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(kValues[2 * i], points.Data(0)[i]);
+    EXPECT_EQ(kValues[2 * i + 1], points.Data(1)[i]);
+  }
+
+  // The format overrides the extension.
+  const auto kOtherPath{GetTempPath("points.dat")};
+  WriteFile(kOtherPath, kContent);
+  EXPECT_EQ(kContent.size(),
+            ReadPoints(kOtherPath, PointFormat::kBinary, points));
+  EXPECT_EQ(3U, points.Size());
+  EXPECT_FALSE(GetReadError(kOtherPath, PointFormat::kAuto).empty());
+
+  WriteFile(kPath, "");
+  EXPECT_EQ(0U, ReadPoints(kPath, PointFormat::kAuto, points));
+  EXPECT_EQ(0U, points.Size());
+
+  // Truncated files, down to a lone x, are rejected as a whole.
+  for (const std::size_t kSize : {47U, 40U, 8U, 1U}) {
+    WriteFile(kPath, kContent.substr(0, kSize));
+    EXPECT_EQ(kPath + ": size is not a multiple of 16 bytes",
+              GetReadError(kPath, PointFormat::kAuto))
+        << kSize;
+  }
+  std::remove(kPath.c_str());
+  std::remove(kOtherPath.c_str());
+}
+
+TEST(GeometryCli, AppendNumber) {
+  const std::vector<std::pair<double, std::string>> kDoubles{
+      {0.0, "0"},
+      {-0.0, "-0"},
+      {0.1, "0.1"},
+      {-2.5, "-2.5"},
+      {1.0e+300, "1e+300"},
+      {123456789.0, "123456789"},
+      {1.0 / 3.0, "0.3333333333333333"},
+  };
+  for (const auto& [kValue, kText] : kDoubles) {
+    std::string line{"x"};
+    AppendNumber(kValue, line);
+    EXPECT_EQ("x" + kText, line);
+  }
+
+  std::string line;
+  AppendNumber(std::numeric_limits<uint64_t>::max(), line);
+  line.push_back(' ');
+  AppendNumber(uint64_t{0}, line);
+  EXPECT_EQ("18446744073709551615 0", line);
+}
+
+TEST(GeometryCli, ResultWriter) {
+  const auto kPath{GetTempPath("results.txt")};
+  // Enough lines for several formatting blocks, in a file written twice.
+  constexpr std::size_t kLineCount{10000};
+  std::string expected;
+  for (std::size_t i = 0; i < kLineCount; ++i) {
+    expected += std::to_string(i) + " " + std::to_string(i * 2) + "\n";
+  }
+  {
+    ResultWriter writer(kPath);
+    writer.WriteLines(0, [](std::size_t, std::string&) {}, 4);
+    EXPECT_EQ(0U, writer.GetByteCount());
+    const auto kFormat{[](std::size_t i, std::string& line) {
+      AppendNumber(static_cast<uint64_t>(i), line);
+      line.push_back(' ');
+      AppendNumber(static_cast<double>(i * 2), line);
+    }};
+    writer.WriteLines(kLineCount, kFormat, 4);
+    EXPECT_EQ(expected.size(), writer.GetByteCount());
+    writer.WriteLines(2, kFormat, 1);
+    EXPECT_EQ(expected.size() + 8, writer.GetByteCount());
+  }
+  EXPECT_EQ(expected + "0 0\n1 2\n", ReadFile(kPath));
+  std::remove(kPath.c_str());
+
+  EXPECT_THROW(ResultWriter(GetTempPath("missing/results.txt")),
+               std::runtime_error);
+}
+
+TEST(GeometryCli, RunJob) {
+  const auto kInput{GetTempPath("job.txt")};
+  const auto kOutput{GetTempPath("job.out")};
+  WriteFile(kInput, "3 4\n0 0\n0.5,0\n");
+
+  auto options{Parse({"distance", "--input", kInput.c_str(), "--query",
+                      "0,0", "--output", kOutput.c_str(), "--threads", "2"})};
+  StageReport report;
+  RunJob(options, report);
+  EXPECT_EQ("0 5\n1 0\n2 0.5\n", ReadFile(kOutput));
+
+  options = Parse({"hull", "--input", kInput.c_str(), "--output",
+                   kOutput.c_str()});
+  RunJob(options, report);
+  const auto kHull{ReadFile(kOutput)};
+  EXPECT_NE(std::string::npos, kHull.find("0 3 4\n")) << kHull;
+  EXPECT_NE(std::string::npos, kHull.find("1 0 0\n")) << kHull;
+
+  // Malformed input fails the job.
+  WriteFile(kInput, "1 2\n3\n");
+  EXPECT_THROW(RunJob(options, report), std::runtime_error);
+  std::remove(kInput.c_str());
+  std::remove(kOutput.c_str());
+}
+}  // namespace zozibush::geometry::application
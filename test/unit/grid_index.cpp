@@ -0,0 +1,140 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/grid_index.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 2000U;
+
+auto MakeRandomCloud(std::mt19937& engine, double extent)
+    -> zozibush::geometry::PointCloud<2, double> {
+  std::uniform_real_distribution<double> coordinate(-extent, extent);
+  zozibush::geometry::PointCloud<2, double> result;
+  result.Resize(kTestCount);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    result.Data(0)[i] = coordinate(engine);
+    result.Data(1)[i] = coordinate(engine);
+  }
+  return result;
+}
+}  // namespace
+
+namespace zozibush::geometry {
+TEST(GeometryGridIndex, SearchRadius) {
+  std::mt19937 engine(3U);
+  const auto kCloud = MakeRandomCloud(engine, 100.0);
+  const GridIndex kGrid(kCloud, 5.0, 4);
+  std::vector<std::size_t> found;
+  EXPECT_EQ(kTestCount, kGrid.Size());
+
+  for (const auto& kCenter :
+       {Point2D(0.0, 0.0), Point2D(-99.0, 42.0), Point2D(150.0, 0.0)}) {
+    for (const auto kRadius : {0.5, 5.0, 17.0, 80.0}) {
+      std::vector<std::size_t> expected;
+      for (uint32_t i = 0; i < kTestCount; ++i) {
+        if (kCloud.Get(i).ToPoint2().CalculateDistance(kCenter) <= kRadius) {
+          expected.push_back(i);
+        }
+      }
+      EXPECT_EQ(expected.size(), kGrid.SearchRadius(kCenter, kRadius, found));
+      EXPECT_EQ(expected, found);
+      EXPECT_EQ(std::min<std::size_t>(expected.size(), 3),
+                kGrid.CountRadius(kCenter, kRadius, 3));
+    }
+  }
+}
+TEST(GeometryGridIndex, FindNearest) {
+  std::mt19937 engine(5U);
+  const auto kCloud = MakeRandomCloud(engine, 100.0);
+  std::uniform_real_distribution<double> coordinate(-300.0, 300.0);
+
+  // A tiny cell size forces the grid to enlarge its cells.
+  for (const auto kCellSize : {0.001, 3.0, 1000.0}) {
+    const GridIndex kGrid(kCloud, kCellSize);
+    EXPECT_GE(kGrid.GetCellSize(), kCellSize);
+    for (uint32_t query = 0; query < 200U; ++query) {
+      const Point2D kQuery(coordinate(engine), coordinate(engine));
+      std::size_t expected{0};
+      for (uint32_t i = 1; i < kTestCount; ++i) {
+        if (kCloud.Get(i).ToPoint2().CalculateDistance(kQuery) <
+            kCloud.Get(expected).ToPoint2().CalculateDistance(kQuery)) {
+          expected = i;
+        }
+      }
+      EXPECT_EQ(expected, kGrid.FindNearest(kQuery));
+    }
+  }
+}
+TEST(GeometryGridIndex, FloatCloud) {
+  std::mt19937 engine(7U);
+  const auto kCloud = MakeRandomCloud(engine, 100.0);
+  PointCloud<2, float> float_cloud;
+  PointCloud<2, double> widened;
+  float_cloud.Resize(kCloud.Size());
+  widened.Resize(kCloud.Size());
+  for (std::size_t i = 0; i < kCloud.Size(); ++i) {
+    for (std::size_t axis = 0; axis < 2; ++axis) {
+      float_cloud.Data(axis)[i] = static_cast<float>(kCloud.Data(axis)[i]);
+      widened.Data(axis)[i] = float_cloud.Data(axis)[i];
+    }
+  }
+
+  const GridIndex kFloatGrid(float_cloud, 5.0, 4);
+  const GridIndex kGrid(widened, 5.0, 4);
+  std::vector<std::size_t> expected;
+  std::vector<std::size_t> found;
+  for (const auto& kCenter : {Point2D(0.0, 0.0), Point2D(-99.0, 42.0)}) {
+    kGrid.SearchRadius(kCenter, 17.0, expected);
+    kFloatGrid.SearchRadius(kCenter, 17.0, found);
+    EXPECT_EQ(expected, found);
+    EXPECT_EQ(kGrid.FindNearest(kCenter), kFloatGrid.FindNearest(kCenter));
+  }
+
+  float_cloud.Data(1)[3] = std::numeric_limits<float>::quiet_NaN();
+  EXPECT_THROW(GridIndex(float_cloud, 1.0), std::out_of_range);
+}
+TEST(GeometryGridIndex, EstimateCellSize) {
+  // 2000 points over a 200 x 200 box: one point per 20 square units.
+  std::mt19937 engine(11U);
+  const auto kCloud{MakeRandomCloud(engine, 100.0)};
+  const auto kCellSize{GridIndex::EstimateCellSize(kCloud)};
+  EXPECT_NEAR(std::sqrt(200.0 * 200.0 / kTestCount), kCellSize, 0.1);
+
+  // A flat box spreads the points along its longer side.
+  PointCloud<2> line;
+  for (uint32_t i = 0; i <= 10; ++i) {
+    line.PushBack(PointN<2>(static_cast<double>(i), 5.0));
+  }
+  EXPECT_DOUBLE_EQ(10.0 / 11.0, GridIndex::EstimateCellSize(line));
+
+  // No extent at all falls back to a unit cell.
+  PointCloud<2> empty;
+  EXPECT_EQ(1.0, GridIndex::EstimateCellSize(empty));
+  PointCloud<2> single;
+  single.PushBack(PointN<2>(3.0, 4.0));
+  EXPECT_EQ(1.0, GridIndex::EstimateCellSize(single));
+}
+TEST(GeometryGridIndex, Exception) {
+  PointCloud<2> cloud;
+  EXPECT_THROW(GridIndex(cloud, 0.0), std::invalid_argument);
+  EXPECT_THROW(GridIndex(cloud, std::numeric_limits<double>::quiet_NaN()),
+               std::invalid_argument);
+
+  const GridIndex kEmpty(cloud, 1.0);
+  std::vector<std::size_t> found;
+  EXPECT_EQ(0U, kEmpty.SearchRadius(Point2D(0.0, 0.0), 1.0, found));
+  EXPECT_THROW(static_cast<void>(kEmpty.FindNearest(Point2D(0.0, 0.0))),
+               std::out_of_range);
+
+  cloud.PushBack(PointN<2>(std::numeric_limits<double>::infinity(), 0.0));
+  EXPECT_THROW(GridIndex(cloud, 1.0), std::out_of_range);
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,134 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/kmeans.hpp"
+
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+const std::vector<zozibush::geometry::Point2D> kCenters{
+    {0.0, 0.0}, {100.0, 0.0}, {0.0, 100.0}, {100.0, 100.0}};
+
+auto MakeBlobs(std::mt19937& engine, uint32_t count_per_blob)
+    -> zozibush::geometry::PointCloud<2, double> {
+  std::normal_distribution<double> spread(0.0, 5.0);
+  zozibush::geometry::PointCloud<2, double> result;
+  for (uint32_t i = 0; i < count_per_blob; ++i) {
+    for (const auto& kCenter : kCenters) {
+      result.PushBack(zozibush::geometry::PointN<2>(
+          kCenter.GetX() + spread(engine), kCenter.GetY() + spread(engine)));
+    }
+  }
+  return result;
+}
+
+auto FindCenter(const zozibush::geometry::Point2D& centroid) -> std::size_t {
+  std::size_t result{0};
+  for (std::size_t i = 1; i < kCenters.size(); ++i) {
+    if (kCenters[i].CalculateDistance(centroid) <
+        kCenters[result].CalculateDistance(centroid)) {
+      result = i;
+    }
+  }
+  return result;
+}
+}  // namespace
+
+namespace zozibush::geometry {
+TEST(GeometryKMeans, Fit) {
+  std::mt19937 engine(23U);
+  const auto kCloud = MakeBlobs(engine, 2500U);
+  std::vector<uint32_t> labels(kCloud.Size());
+  KMeans kmeans(4, 1U);
+
+  EXPECT_LT(kmeans.Fit(kCloud, labels.data()), 100U);
+  const auto kCentroids = kmeans.GetCentroids();
+  ASSERT_EQ(4U, kCentroids.size());
+  std::vector<bool> found(kCenters.size(), false);
+  for (const auto& kCentroid : kCentroids) {
+    const auto kCenter{FindCenter(kCentroid)};
+    EXPECT_LT(kCenters[kCenter].CalculateDistance(kCentroid), 0.5);
+    found[kCenter] = true;
+  }
+  EXPECT_EQ(std::vector<bool>(kCenters.size(), true), found);
+  // Points are pushed blob by blob, so point i belongs to blob i % 4.
+  for (std::size_t i = 0; i < kCloud.Size(); ++i) {
+    EXPECT_EQ(labels[i % kCenters.size()], labels[i]);
+  }
+}
+TEST(GeometryKMeans, Method) {
+  std::mt19937 engine(29U);
+  std::uniform_real_distribution<double> coordinate(0.0, 1000.0);
+  PointCloud<2> cloud;
+  for (uint32_t i = 0; i < 20000U; ++i) {
+    cloud.PushBack(PointN<2>(coordinate(engine), coordinate(engine)));
+  }
+  std::vector<uint32_t> expected(cloud.Size());
+  std::vector<uint32_t> labels(cloud.Size());
+
+  KMeans lloyd(16, 7U);
+  lloyd.Fit(cloud, expected.data(), 50, KMeans::Method::kLloyd, 1);
+  for (const std::size_t kThreadCount : {1U, 4U}) {
+    KMeans hamerly(16, 7U);
+    hamerly.Fit(cloud, labels.data(), 50, KMeans::Method::kHamerly,
+                kThreadCount);
+    EXPECT_EQ(expected, labels);
+    const auto kExpected = lloyd.GetCentroids();
+    const auto kCentroids = hamerly.GetCentroids();
+    for (std::size_t i = 0; i < kExpected.size(); ++i) {
+      EXPECT_NEAR(kExpected[i].GetX(), kCentroids[i].GetX(), 1e-9);
+      EXPECT_NEAR(kExpected[i].GetY(), kCentroids[i].GetY(), 1e-9);
+    }
+    EXPECT_NEAR(lloyd.CalculateInertia(cloud, expected.data()),
+                hamerly.CalculateInertia(cloud, labels.data()), 1e-3);
+  }
+}
+TEST(GeometryKMeans, Assign) {
+  std::mt19937 engine(31U);
+  const auto kCloud = MakeBlobs(engine, 500U);
+  KMeans kmeans(3);
+  kmeans.SetCentroids({{10.0, 10.0}, {90.0, 20.0}, {50.0, 80.0}});
+  const auto kCentroids = kmeans.GetCentroids();
+  std::vector<uint32_t> labels(kCloud.Size());
+
+  kmeans.Assign(kCloud, labels.data(), 4);
+  for (std::size_t i = 0; i < kCloud.Size(); ++i) {
+    const auto kPoint = kCloud.Get(i).ToPoint2();
+    uint32_t expected{0};
+    for (uint32_t cluster = 1; cluster < kCentroids.size(); ++cluster) {
+      if (kPoint.CalculateDistance(kCentroids[cluster]) <
+          kPoint.CalculateDistance(kCentroids[expected])) {
+        expected = cluster;
+      }
+    }
+    EXPECT_EQ(expected, labels[i]);
+  }
+}
+TEST(GeometryKMeans, PartialFit) {
+  std::mt19937 engine(37U);
+  KMeans kmeans(4, 3U);
+
+  for (uint32_t batch = 0; batch < 20U; ++batch) {
+    kmeans.PartialFit(MakeBlobs(engine, 100U));
+  }
+  for (const auto& kCentroid : kmeans.GetCentroids()) {
+    EXPECT_LT(kCenters[FindCenter(kCentroid)].CalculateDistance(kCentroid),
+              1.0);
+  }
+}
+TEST(GeometryKMeans, Exception) {
+  std::vector<uint32_t> labels(2);
+  const PointCloud<2> kCloud({{0.0, 0.0}, {1.0, 1.0}});
+
+  EXPECT_THROW(KMeans(0), std::invalid_argument);
+  EXPECT_THROW(KMeans(3).Seed(kCloud), std::invalid_argument);
+  EXPECT_THROW(KMeans(2).Fit(kCloud, labels.data(), 0),
+               std::invalid_argument);
+  EXPECT_THROW(KMeans(2).SetCentroids({{0.0, 0.0}}), std::invalid_argument);
+  EXPECT_THROW(KMeans(2).Assign(kCloud, labels.data()), std::logic_error);
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,53 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/parallel.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+}
+
+namespace zozibush::geometry {
+TEST(GeometryParallel, DefaultThreadCount) {
+  EXPECT_LE(1U, GetDefaultThreadCount());
+}
+TEST(GeometryParallel, CoversEveryElementOnce) {
+  for (std::size_t thread_count = 1; thread_count <= 8; ++thread_count) {
+    std::vector<std::atomic<uint32_t>> visits(kTestCount);
+    ParallelFor(
+        kTestCount, 64,
+        [&](std::size_t begin, std::size_t end) {
+          EXPECT_EQ(0U, begin % 64);
+          for (auto i = begin; i < end; ++i) {
+            ++visits[i];
+          }
+        },
+        thread_count);
+    for (const auto& visit : visits) {
+      EXPECT_EQ(1U, visit.load());
+    }
+  }
+}
+TEST(GeometryParallel, Empty) {
+  bool called{false};
+  ParallelFor(0, 1, [&](std::size_t, std::size_t) { called = true; });
+  EXPECT_FALSE(called);
+}
+TEST(GeometryParallel, RethrowsException) {
+  EXPECT_THROW(ParallelFor(
+                   kTestCount, 1,
+                   [](std::size_t begin, std::size_t) {
+                     if (begin != 0U) {
+                       throw std::runtime_error("worker failed");
+                     }
+                   },
+                   4),
+               std::runtime_error);
+}
+}  // namespace zozibush::geometry
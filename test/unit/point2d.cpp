@@ -4,7 +4,11 @@
 
 #include <cmath>
 #include <cstdint>
+#include <functional>
+#include <limits>
 #include <stdexcept>
+#include <type_traits>
+#include <unordered_set>
 
 #include "gtest/gtest.h"
 
@@ -232,4 +236,114 @@ TEST(GeometryPoint2D, OperatorDiffer) {
     EXPECT_TRUE(source != target);
   }
 }
+TEST(GeometryPoint2D, TriviallyCopyable) {
+  EXPECT_TRUE(std::is_trivially_copyable_v<Point2D>);
+  EXPECT_TRUE(std::is_trivially_copyable_v<Point2F>);
+  EXPECT_TRUE(std::is_trivially_copyable_v<Point2I>);
+  EXPECT_EQ(2 * sizeof(float), sizeof(Point2F));
+  EXPECT_EQ(2 * sizeof(int32_t), sizeof(Point2I));
+}
+TEST(GeometryPoint2F, CalculateDistance) {
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kSourceX = static_cast<float>(std::rand() % 10000);
+    const auto kSourceY = static_cast<float>(std::rand() % 10000);
+    const auto kTargetX = static_cast<float>(std::rand() % 10000);
+    const auto kTargetY = static_cast<float>(std::rand() % 10000);
+
+    Point2F source(kSourceX, kSourceY);
+    Point2F target(kTargetX, kTargetY);
+
+    EXPECT_FLOAT_EQ(std::sqrt((kSourceX - kTargetX) * (kSourceX - kTargetX) +
+                              (kSourceY - kTargetY) * (kSourceY - kTargetY)),
+                    source.CalculateDistance(target));
+  }
+}
+TEST(GeometryPoint2F, OperatorDivide) {
+  Point2F source(3.0F, 6.0F);
+
+  EXPECT_EQ(Point2F(1.0F, 2.0F), source / 3.0F);
+  EXPECT_THROW(source / std::nanf(""), std::invalid_argument);
+  EXPECT_THROW(source / std::numeric_limits<float>::infinity(),
+               std::invalid_argument);
+  EXPECT_THROW(source / 0.0F, std::invalid_argument);
+}
+TEST(GeometryPoint2I, Operators) {
+  Point2I source(3, 4);
+  Point2I target(6, 8);
+
+  EXPECT_EQ(Point2I(9, 12), source + target);
+  EXPECT_EQ(Point2I(-3, -4), source - target);
+  EXPECT_EQ(Point2I(6, 8), source * 2);
+  EXPECT_EQ(Point2I(3, 4), target / 2);
+  EXPECT_THROW(source / 0, std::invalid_argument);
+  EXPECT_DOUBLE_EQ(5.0, source.CalculateDistance(target));
+}
+TEST(GeometryPoint2I, Overflow) {
+  constexpr auto kMax{std::numeric_limits<int32_t>::max()};
+  constexpr auto kLowest{std::numeric_limits<int32_t>::lowest()};
+  const Point2I kLargest(kMax, kMax);
+  const Point2I kSmallest(kLowest, 0);
+
+  EXPECT_THROW(kLargest + Point2I(0, 1), std::out_of_range);
+  EXPECT_THROW(kSmallest - Point2I(1, 0), std::out_of_range);
+  EXPECT_THROW(kLargest * 2, std::out_of_range);
+  EXPECT_THROW(kSmallest * -1, std::out_of_range);
+  EXPECT_THROW(kSmallest / -1, std::out_of_range);
+  EXPECT_EQ(Point2I(kLowest, 0), kSmallest / 1);
+  EXPECT_EQ(Point2I(kLowest, kLowest),
+            Point2I(-1, kLowest) + Point2I(kLowest + 1, 0));
+
+  // A failed accumulation leaves the point unchanged.
+  auto point{kLargest};
+  EXPECT_THROW(point += Point2I(1, 0), std::out_of_range);
+  EXPECT_EQ(kLargest, point);
+  EXPECT_THROW(point -= Point2I(0, -1), std::out_of_range);
+  EXPECT_EQ(kLargest, point);
+
+  // Floating point scalars would be truncated, so they do not compile.
+  static_assert(std::is_invocable_v<std::multiplies<>, Point2I, int32_t>);
+  static_assert(!std::is_invocable_v<std::multiplies<>, Point2I, double>);
+  static_assert(!std::is_invocable_v<std::divides<>, Point2I, float>);
+  static_assert(std::is_invocable_v<std::multiplies<>, Point2D, int32_t>);
+}
+TEST(GeometryPoint2D, CheckedConversion) {
+  const Point2D kSource(1.6, -2.4);
+
+  EXPECT_EQ(Point2I(2, -2), Point2I(kSource));
+  EXPECT_EQ(Point2F(1.6F, -2.4F), Point2F(kSource));
+  EXPECT_EQ(Point2D(2.0, -2.0), Point2D(Point2I(kSource)));
+
+  EXPECT_THROW(Point2I(Point2D(3.0e+9, 0.0)), std::out_of_range);
+  EXPECT_THROW(Point2I(Point2D(std::nan(""), 0.0)), std::out_of_range);
+  EXPECT_THROW(Point2I(Point2F(std::numeric_limits<float>::infinity(), 0.0F)),
+               std::out_of_range);
+  EXPECT_THROW(Point2F(Point2D(0.0, 1.0e+300)), std::out_of_range);
+  EXPECT_NO_THROW(
+      Point2F(Point2D(std::numeric_limits<double>::infinity(), 0.0)));
+}
+TEST(GeometryPoint2D, Hash) {
+  const std::hash<Point2D> kHash;
+
+  EXPECT_EQ(kHash(Point2D(1.5, -2.0)), kHash(Point2D(1.5, -2.0)));
+  EXPECT_EQ(kHash(Point2D(0.0, 0.0)), kHash(Point2D(-0.0, -0.0)));
+  EXPECT_NE(kHash(Point2D(1.0, 2.0)), kHash(Point2D(2.0, 1.0)));
+  EXPECT_EQ(std::hash<Point2I>{}(Point2I(3, -4)),
+            std::hash<Point2I>{}(Point2I(3, -4)));
+  EXPECT_EQ(std::hash<Point2F>{}(Point2F(0.0F, 1.0F)),
+            std::hash<Point2F>{}(Point2F(-0.0F, 1.0F)));
+
+  // Integer lattice points differ only in a few mantissa bits, yet neither
+  // the full hash nor its low 16 bits should collide much.
+  std::unordered_set<std::size_t> hashes;
+  std::unordered_set<std::size_t> low_bits;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    for (uint32_t j = 0; j < 64U; ++j) {
+      const auto kValue{kHash(Point2D(i, j))};
+      hashes.insert(kValue);
+      low_bits.insert(kValue & 0xffffU);
+    }
+  }
+  EXPECT_EQ(kTestCount * 64U, hashes.size());
+  EXPECT_LT(40000U, low_bits.size());
+}
 }  // namespace zozibush::geometry
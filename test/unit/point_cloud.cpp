@@ -0,0 +1,58 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/point_cloud.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+}
+
+namespace zozibush::geometry {
+TEST(GeometryPointCloud, Constructor) {
+  PointCloud<3> cloud1;
+  PointCloud<3> cloud2({Point3D(1.0, 2.0, 3.0), Point3D(4.0, 5.0, 6.0)});
+
+  EXPECT_TRUE(cloud1.Empty());
+  EXPECT_EQ(2U, cloud2.Size());
+  EXPECT_EQ(Point3D(4.0, 5.0, 6.0), cloud2.Get(1));
+}
+TEST(GeometryPointCloud, PushBackAndGet) {
+  PointCloud<3, float> cloud;
+  cloud.Reserve(kTestCount);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    cloud.PushBack(Point3F(static_cast<float>(i), 1.0F, 2.0F));
+  }
+
+  ASSERT_EQ(kTestCount, cloud.Size());
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    EXPECT_EQ(Point3F(static_cast<float>(i), 1.0F, 2.0F), cloud.Get(i));
+    EXPECT_FLOAT_EQ(static_cast<float>(i), cloud.Data(0)[i]);
+    EXPECT_FLOAT_EQ(2.0F, cloud.Data(2)[i]);
+  }
+  EXPECT_THROW(static_cast<void>(cloud.Get(kTestCount)), std::out_of_range);
+}
+TEST(GeometryPointCloud, SetAndClear) {
+  PointCloud<2> cloud;
+  cloud.Resize(2);
+  cloud.Set(1, PointN<2>(3.0, 4.0));
+
+  EXPECT_EQ(PointN<2>(0.0, 0.0), cloud.Get(0));
+  EXPECT_EQ(PointN<2>(3.0, 4.0), cloud.Get(1));
+  EXPECT_THROW(cloud.Set(2, PointN<2>()), std::out_of_range);
+
+  cloud.Clear();
+  EXPECT_TRUE(cloud.Empty());
+}
+TEST(GeometryPointCloud, MakePointCloud) {
+  const std::vector<Point2F> kPoints{Point2F(1.0F, 2.0F), Point2F(3.0F, 4.0F)};
+  const auto kCloud = MakePointCloud(kPoints);
+
+  ASSERT_EQ(kPoints.size(), kCloud.Size());
+  EXPECT_EQ(kPoints[1], kCloud.Get(1).ToPoint2());
+}
+}  // namespace zozibush::geometry
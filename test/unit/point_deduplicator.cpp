@@ -0,0 +1,96 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/point_deduplicator.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace zozibush::geometry {
+TEST(GeometryPointDeduplicator, Deduplicate) {
+  const PointCloud<2> kCloud({{0.0, 0.0},
+                              {0.4, 0.9},
+                              {1.0, 0.0},
+                              {-0.1, 0.0},
+                              {0.99, 0.99},
+                              {1.5, 0.5}});
+  const PointDeduplicator kDeduplicator(Distance(1.0));
+  std::vector<std::size_t> indices;
+  std::vector<std::size_t> representatives(kCloud.Size());
+
+  EXPECT_EQ(3U, kDeduplicator.Deduplicate(kCloud, indices,
+                                          representatives.data()));
+  EXPECT_EQ(std::vector<std::size_t>({0, 2, 3}), indices);
+  EXPECT_EQ(std::vector<std::size_t>({0, 0, 2, 3, 0, 2}), representatives);
+  EXPECT_EQ(Point2D(-1.0, 0.0), kDeduplicator.Snap(Point2D(-0.1, 0.0)));
+}
+TEST(GeometryPointDeduplicator, Random) {
+  std::mt19937 engine(37U);
+  std::uniform_real_distribution<double> coordinate(-50.0, 50.0);
+  PointCloud<2> cloud;
+  for (uint32_t i = 0; i < 200000U; ++i) {
+    cloud.PushBack(PointN<2>(coordinate(engine), coordinate(engine)));
+  }
+
+  for (const double kTolerance : {0.0, 0.25, 3.0}) {
+    const PointDeduplicator kDeduplicator{Distance(kTolerance)};
+    std::map<std::pair<double, double>, std::size_t> first;
+    std::vector<std::size_t> expected;
+    std::vector<std::size_t> expected_representatives;
+    for (std::size_t i = 0; i < cloud.Size(); ++i) {
+      const auto kCell{kDeduplicator.Snap(cloud.Get(i).ToPoint2())};
+      const auto [kFound, kInserted] =
+          first.emplace(std::make_pair(kCell.GetX(), kCell.GetY()), i);
+      if (kInserted) {
+        expected.push_back(i);
+      }
+      expected_representatives.push_back(kFound->second);
+    }
+
+    for (const std::size_t kThreadCount : {1U, 3U}) {
+      std::vector<std::size_t> indices{7U};
+      std::vector<std::size_t> representatives(cloud.Size());
+      EXPECT_EQ(expected.size(),
+                kDeduplicator.Deduplicate(cloud, indices,
+                                          representatives.data(),
+                                          kThreadCount));
+      EXPECT_EQ(expected, indices);
+      EXPECT_EQ(expected_representatives, representatives);
+    }
+  }
+}
+TEST(GeometryPointDeduplicator, Exact) {
+  const PointCloud<2> kCloud(
+      {{0.0, 0.0}, {-0.0, 0.0}, {1.0e-12, 0.0}, {0.0, 0.0}});
+  std::vector<std::size_t> indices;
+
+  EXPECT_EQ(2U, PointDeduplicator(Distance(0.0)).Deduplicate(kCloud, indices));
+  EXPECT_EQ(std::vector<std::size_t>({0, 2}), indices);
+  EXPECT_EQ(1U, PointDeduplicator(Distance(1.0, Distance::Type::kNanometer))
+                    .Deduplicate(kCloud, indices));
+}
+TEST(GeometryPointDeduplicator, Exception) {
+  std::vector<std::size_t> indices{1U};
+
+  EXPECT_THROW(PointDeduplicator(Distance(-1.0)), std::invalid_argument);
+  EXPECT_EQ(0U, PointDeduplicator(Distance(1.0))
+                    .Deduplicate(PointCloud<2>(), indices));
+  EXPECT_TRUE(indices.empty());
+  EXPECT_THROW(PointDeduplicator(Distance(1.0))
+                   .Deduplicate(PointCloud<2>({{0.0, std::nan("")}}), indices),
+               std::out_of_range);
+  EXPECT_THROW(
+      PointDeduplicator(Distance(1.0))
+          .Deduplicate(
+              PointCloud<2>({{std::numeric_limits<double>::infinity(), 0.0}}),
+              indices),
+      std::out_of_range);
+}
+}  // namespace zozibush::geometry
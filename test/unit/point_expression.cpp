@@ -0,0 +1,129 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/point_expression.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+auto MakeRandomPoints(std::mt19937& engine)
+    -> std::vector<zozibush::geometry::Point2D> {
+  std::uniform_real_distribution<double> coordinate(-1e3, 1e3);
+  std::vector<zozibush::geometry::Point2D> result;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kX{coordinate(engine)};
+    result.emplace_back(kX, coordinate(engine));
+  }
+  return result;
+}
+}  // namespace
+
+namespace zozibush::geometry {
+TEST(GeometryPointExpression, Point) {
+  const Point2D kA(1.5, -2.0);
+  const Point2D kB(0.25, 8.0);
+  const Point2D kC(-3.0, 1.0);
+
+  const Point2D kLazy = (Lazy(kA) + kB - kC) * 3.0 / 7.0;
+  const auto kEager{(kA + kB - kC) * 3.0 / 7.0};
+  EXPECT_EQ(kEager.GetX(), kLazy.GetX());
+  EXPECT_EQ(kEager.GetY(), kLazy.GetY());
+
+  const Point2D kMixed = kA - (Lazy(kB) * 2.0 + kC);
+  EXPECT_TRUE(kMixed == kA - (kB * 2.0 + kC));
+  const Point2D kScaled = 2.0 * (Lazy(kA) + Lazy(kB));
+  EXPECT_TRUE(kScaled == (kA + kB) * 2.0);
+
+  // An expression holds copies of its points.
+  auto expression{Lazy(kA) + Point2D(1.0, 1.0)};
+  EXPECT_TRUE(expression.Evaluate() == Point2D(2.5, -1.0));
+
+  const Point2I kI(7, -9);
+  const Point2I kQuotient = (Lazy(kI) + Point2I(1, 1)) / 2;
+  EXPECT_TRUE(kQuotient == (kI + Point2I(1, 1)) / 2);
+}
+TEST(GeometryPointExpression, Arrays) {
+  std::mt19937 engine(3U);
+  const auto kA{MakeRandomPoints(engine)};
+  const auto kB{MakeRandomPoints(engine)};
+  const auto kCloud{MakePointCloud(MakeRandomPoints(engine))};
+  const Point2D kOffset(10.0, -4.0);
+
+  std::vector<Point2D> result;
+  Assign((Lazy(kA) + Lazy(kB) - kOffset) * 0.5 / 3.0, result);
+  ASSERT_EQ(kTestCount, result.size());
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kExpected{(kA[i] + kB[i] - kOffset) * 0.5 / 3.0};
+    EXPECT_EQ(kExpected.GetX(), result[i].GetX());
+    EXPECT_EQ(kExpected.GetY(), result[i].GetY());
+  }
+
+  PointCloud<2, double> cloud;
+  Assign(Lazy(kCloud) - Lazy(kA) + kOffset, cloud);
+  ASSERT_EQ(kTestCount, cloud.Size());
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kExpected{kCloud.Get(i).ToPoint2() - kA[i] + kOffset};
+    EXPECT_EQ(kExpected.GetX(), cloud.Data(0)[i]);
+    EXPECT_EQ(kExpected.GetY(), cloud.Data(1)[i]);
+  }
+
+  // The output may also be an operand.
+  auto in_place{kA};
+  Assign(Lazy(in_place) * 2.0 + Lazy(kB), in_place);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    EXPECT_TRUE(in_place[i] == kA[i] * 2.0 + kB[i]);
+  }
+}
+TEST(GeometryPointExpression, Errors) {
+  const std::vector<Point2D> kThree(3);
+  const std::vector<Point2D> kFour(4);
+  EXPECT_THROW(static_cast<void>(Lazy(kThree) + Lazy(kFour)),
+               std::invalid_argument);
+  EXPECT_THROW(
+      static_cast<void>((Lazy(kThree) + Point2D(1.0, 1.0)) - Lazy(kFour)),
+      std::invalid_argument);
+  // An empty array is an array of size 0, not a point.
+  const std::vector<Point2D> kEmpty;
+  const std::vector<Point2D> kFive(5);
+  EXPECT_THROW(static_cast<void>(Lazy(kEmpty) + Lazy(kFive)),
+               std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(Lazy(kFive) - Lazy(kEmpty) * 2.0),
+               std::invalid_argument);
+  std::vector<Point2D> empty_result(2);
+  Assign(Lazy(kEmpty) + Lazy(kEmpty) + Point2D(1.0, 1.0), empty_result);
+  EXPECT_TRUE(empty_result.empty());
+
+  const Point2D kPoint(1.0, 2.0);
+  EXPECT_THROW(static_cast<void>(Lazy(kPoint) / 0.0), std::invalid_argument);
+  EXPECT_THROW(
+      static_cast<void>(Lazy(kThree) /
+                        std::numeric_limits<double>::quiet_NaN()),
+      std::invalid_argument);
+  EXPECT_THROW(
+      static_cast<void>(Lazy(kPoint) / std::numeric_limits<double>::infinity()),
+      std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(Lazy(Point2I(1, 1)) / 0),
+               std::invalid_argument);
+
+  // Integer overflow throws on evaluation, as with the Point2 operators.
+  const Point2I kLargest(std::numeric_limits<int32_t>::max(), 0);
+  EXPECT_THROW(static_cast<void>(Point2I(Lazy(kLargest) + Point2I(1, 0))),
+               std::out_of_range);
+  EXPECT_THROW(static_cast<void>(Point2I(Lazy(kLargest) * 2)),
+               std::out_of_range);
+
+  // The divisor is checked when the expression is built, not per element.
+  std::vector<Point2D> result;
+  const auto kHalf{Lazy(kThree) / 2.0};
+  Assign(kHalf, result);
+  EXPECT_EQ(3U, result.size());
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,97 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/point_hash_map.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "gtest/gtest.h"
+
+namespace zozibush::geometry {
+TEST(GeometryPointHashMap, InsertFind) {
+  PointHashMap<int32_t> map;
+
+  EXPECT_TRUE(map.Empty());
+  EXPECT_EQ(nullptr, map.Find(Point2D(1.0, 2.0)));
+  EXPECT_TRUE(map.Insert(Point2D(1.0, 2.0), 7).second);
+  EXPECT_FALSE(map.Insert(Point2D(1.0, 2.0), 8).second);
+  EXPECT_EQ(7, *map.Find(Point2D(1.0, 2.0)));
+  EXPECT_FALSE(map.Contains(Point2D(2.0, 1.0)));
+
+  map[Point2D(0.0, 0.0)] = 3;
+  EXPECT_EQ(3, map[Point2D(-0.0, 0.0)]);
+  EXPECT_EQ(2U, map.Size());
+
+  EXPECT_TRUE(map.Erase(Point2D(1.0, 2.0)));
+  EXPECT_FALSE(map.Erase(Point2D(1.0, 2.0)));
+  EXPECT_EQ(1U, map.Size());
+  map.Clear();
+  EXPECT_TRUE(map.Empty());
+  EXPECT_FALSE(map.Contains(Point2D(0.0, 0.0)));
+}
+TEST(GeometryPointHashMap, Random) {
+  std::mt19937 engine(37U);
+  std::uniform_int_distribution<int32_t> coordinate(0, 63);
+  std::uniform_int_distribution<int32_t> action(0, 2);
+  PointHashMap<uint32_t> map;
+  std::unordered_map<Point2D, uint32_t> expected;
+
+  // A small key range forces long probe runs and many backward shifts.
+  for (uint32_t i = 0; i < 100000U; ++i) {
+    const Point2D kKey(coordinate(engine), coordinate(engine) * 0.5);
+    if (action(engine) == 0) {
+      EXPECT_EQ(expected.erase(kKey) == 1, map.Erase(kKey));
+    } else {
+      EXPECT_EQ(expected.emplace(kKey, i).second, map.Insert(kKey, i).second);
+    }
+    const auto* value{map.Find(kKey)};
+    const auto kFound{expected.find(kKey)};
+    ASSERT_EQ(kFound != expected.end(), value != nullptr);
+    if (value != nullptr) {
+      EXPECT_EQ(kFound->second, *value);
+    }
+  }
+  EXPECT_EQ(expected.size(), map.Size());
+  std::size_t count{0};
+  map.ForEach([&](const Point2D& key, uint32_t value) {
+    EXPECT_EQ(expected.at(key), value);
+    ++count;
+  });
+  EXPECT_EQ(expected.size(), count);
+}
+TEST(GeometryPointHashMap, Reserve) {
+  PointHashMap<double> map(1000);
+  const auto kCapacity{map.Capacity()};
+
+  EXPECT_LE(1000U * 4U, kCapacity * 3U);
+  for (uint32_t i = 0; i < 1000U; ++i) {
+    map.Insert(Point2D(i, -1.0 * i), i);
+  }
+  EXPECT_EQ(kCapacity, map.Capacity());
+  EXPECT_THROW(map.Insert(Point2D(std::nan(""), 0.0), 0.0),
+               std::out_of_range);
+}
+TEST(GeometryPointHashSet, InsertErase) {
+  PointHashSet set;
+
+  EXPECT_TRUE(set.Insert(Point2D(0.5, 0.5)));
+  EXPECT_FALSE(set.Insert(Point2D(0.5, 0.5)));
+  EXPECT_TRUE(set.Insert(Point2D(0.5, -0.5)));
+  EXPECT_TRUE(set.Contains(Point2D(0.5, -0.5)));
+  EXPECT_EQ(2U, set.Size());
+
+  std::size_t count{0};
+  set.ForEach([&](const Point2D& point) {
+    EXPECT_EQ(0.5, point.GetX());
+    ++count;
+  });
+  EXPECT_EQ(2U, count);
+
+  EXPECT_TRUE(set.Erase(Point2D(0.5, 0.5)));
+  EXPECT_FALSE(set.Contains(Point2D(0.5, 0.5)));
+  EXPECT_THROW(set.Insert(Point2D(0.0, std::nan(""))), std::out_of_range);
+}
+}  // namespace zozibush::geometry
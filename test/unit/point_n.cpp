@@ -0,0 +1,116 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/point_n.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+}
+
+namespace zozibush::geometry {
+TEST(GeometryPointN, Constructor) {
+  Point3D point1;
+  Point3D point2(1.0, 2.0, 3.0);
+  Point3D point3(std::array<double, 3>{1.0, 2.0, 3.0});
+  PointN<2> point4(Point2D(4.0, 5.0));
+
+  EXPECT_EQ(Point3D(0.0, 0.0, 0.0), point1);
+  EXPECT_EQ(point2, point3);
+  EXPECT_EQ(Point2D(4.0, 5.0), point4.ToPoint2());
+  EXPECT_TRUE(std::is_trivially_copyable_v<Point3F>);
+  EXPECT_EQ(3 * sizeof(float), sizeof(Point3F));
+}
+TEST(GeometryPointN, Access) {
+  Point3D point(1.0, 2.0, 3.0);
+
+  EXPECT_DOUBLE_EQ(1.0, point[0]);
+  EXPECT_DOUBLE_EQ(3.0, point.Get<2>());
+
+  point[0] = 4.0;
+  point.Set<1>(5.0);
+  EXPECT_EQ(Point3D(4.0, 5.0, 3.0), point);
+}
+TEST(GeometryPointN, CalculateDistance) {
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kSourceX = static_cast<double>(std::rand());
+    const auto kSourceY = static_cast<double>(std::rand());
+    const auto kSourceZ = static_cast<double>(std::rand());
+    const auto kTargetX = static_cast<double>(std::rand());
+    const auto kTargetY = static_cast<double>(std::rand());
+    const auto kTargetZ = static_cast<double>(std::rand());
+
+    Point3D source(kSourceX, kSourceY, kSourceZ);
+    Point3D target(kTargetX, kTargetY, kTargetZ);
+
+    EXPECT_FLOAT_EQ(std::sqrt((kSourceX - kTargetX) * (kSourceX - kTargetX) +
+                              (kSourceY - kTargetY) * (kSourceY - kTargetY) +
+                              (kSourceZ - kTargetZ) * (kSourceZ - kTargetZ)),
+                    source.CalculateDistance(target));
+    EXPECT_FLOAT_EQ(source.CalculateDistance(target),
+                    Point3D::CalculateDistance(source, target));
+  }
+}
+TEST(GeometryPointN, MatchesPoint2D) {
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const Point2D kSource(static_cast<double>(std::rand()),
+                          static_cast<double>(std::rand()));
+    const Point2D kTarget(static_cast<double>(std::rand()),
+                          static_cast<double>(std::rand()));
+    const auto kScaleValue = static_cast<double>(std::rand() + 1);
+
+    const PointN<2> kSourceN(kSource);
+    const PointN<2> kTargetN(kTarget);
+
+    EXPECT_DOUBLE_EQ(kSource.CalculateDistance(kTarget),
+                     kSourceN.CalculateDistance(kTargetN));
+    EXPECT_EQ(kSource + kTarget, (kSourceN + kTargetN).ToPoint2());
+    EXPECT_EQ(kSource - kTarget, (kSourceN - kTargetN).ToPoint2());
+    EXPECT_EQ(kSource * kScaleValue, (kSourceN * kScaleValue).ToPoint2());
+    EXPECT_EQ(kSource / kScaleValue, (kSourceN / kScaleValue).ToPoint2());
+  }
+}
+TEST(GeometryPointN, OperatorAccumulate) {
+  Point3D point(1.0, 2.0, 3.0);
+
+  point += Point3D(1.0, 1.0, 1.0);
+  EXPECT_EQ(Point3D(2.0, 3.0, 4.0), point);
+  point -= Point3D(2.0, 2.0, 2.0);
+  EXPECT_EQ(Point3D(0.0, 1.0, 2.0), point);
+}
+TEST(GeometryPointN, OperatorDivide) {
+  Point3D point(2.0, 4.0, 6.0);
+
+  EXPECT_EQ(Point3D(1.0, 2.0, 3.0), point / 2.0);
+  EXPECT_THROW(point / std::nan(""), std::invalid_argument);
+  EXPECT_THROW(point / std::numeric_limits<double>::infinity(),
+               std::invalid_argument);
+  EXPECT_THROW(point / 0.0, std::invalid_argument);
+  EXPECT_THROW((PointN<3, int32_t>(1, 2, 3) / 0), std::invalid_argument);
+}
+TEST(GeometryPointN, OperatorEqual) {
+  const Point3D kPoint(1.0, 2.0, 3.0);
+
+  EXPECT_TRUE(kPoint == Point3D(1.0, 2.0, 3.0));
+  EXPECT_FALSE(kPoint != Point3D(1.0, 2.0, 3.0));
+  EXPECT_FALSE(kPoint == Point3D(1.0, 2.0, 4.0));
+  EXPECT_TRUE(kPoint != Point3D(4.0, 5.0, 6.0));
+
+  // As with Point2D, != needs every coordinate to differ, so a point that
+  // differs in one axis is neither == nor !=.
+  EXPECT_FALSE(kPoint != Point3D(1.0, 2.0, 4.0));
+  EXPECT_EQ(Point2D(1.0, 2.0) != Point2D(1.0, 3.0),
+            PointN<2>(1.0, 2.0) != PointN<2>(1.0, 3.0));
+}
+TEST(GeometryPointN, Constexpr) {
+  constexpr Point3D kPoint = Point3D(1.0, 2.0, 3.0) + Point3D(1.0, 1.0, 1.0);
+  static_assert(kPoint.Get<2>() == 4.0);
+  static_assert(Point3D::CalculateSquaredDistance(kPoint, Point3D()) == 29.0);
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,187 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/polygon2d.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+constexpr double kPi = 3.14159265358979323846;
+
+auto MakeCircle(std::size_t vertex_count, double radius)
+    -> std::vector<zozibush::geometry::Point2D> {
+  std::vector<zozibush::geometry::Point2D> result;
+  for (std::size_t i = 0; i < vertex_count; ++i) {
+    const auto kAngle = 2.0 * kPi * static_cast<double>(i) /
+                        static_cast<double>(vertex_count);
+    result.emplace_back(radius * std::cos(kAngle), radius * std::sin(kAngle));
+  }
+  return result;
+}
+
+auto MakeStar(std::size_t tip_count) -> std::vector<zozibush::geometry::Point2D> {
+  std::vector<zozibush::geometry::Point2D> result;
+  for (std::size_t i = 0; i < tip_count * 2; ++i) {
+    const auto kAngle = kPi * static_cast<double>(i) /
+                        static_cast<double>(tip_count);
+    const auto kRadius = (i % 2 == 0) ? 100.0 : 40.0;
+    result.emplace_back(kRadius * std::cos(kAngle), kRadius * std::sin(kAngle));
+  }
+  return result;
+}
+
+// Teeth between y = 0 and y = 1, closed along y = -1; every tooth edge spans
+// the full height of the teeth.
+auto MakeComb(std::size_t tooth_count)
+    -> std::vector<zozibush::geometry::Point2D> {
+  std::vector<zozibush::geometry::Point2D> result;
+  for (std::size_t i = 0; i <= tooth_count * 2; ++i) {
+    result.emplace_back(static_cast<double>(i), (i % 2 == 0) ? 0.0 : 1.0);
+  }
+  result.emplace_back(static_cast<double>(tooth_count * 2), -1.0);
+  result.emplace_back(0.0, -1.0);
+  return result;
+}
+
+auto IsSet(const std::vector<uint64_t>& mask, std::size_t index) -> bool {
+  return ((mask[index / 64] >> (index % 64)) & 1U) != 0U;
+}
+}  // namespace
+
+namespace zozibush::geometry {
+TEST(GeometryPolygon2D, Constructor) {
+  Polygon2D polygon({Point2D(0.0, 0.0), Point2D(1.0, 0.0), Point2D(0.0, 1.0)});
+
+  EXPECT_EQ(3U, polygon.GetVertexCount());
+  EXPECT_FALSE(polygon.HasIndex());
+  EXPECT_THROW(Polygon2D({Point2D(0.0, 0.0), Point2D(1.0, 0.0)}),
+               std::invalid_argument);
+}
+TEST(GeometryPolygon2D, ContainsSquare) {
+  Polygon2D polygon({Point2D(0.0, 0.0), Point2D(10.0, 0.0),
+                     Point2D(10.0, 10.0), Point2D(0.0, 10.0)});
+
+  EXPECT_TRUE(polygon.Contains(Point2D(5.0, 5.0)));
+  EXPECT_FALSE(polygon.Contains(Point2D(15.0, 5.0)));
+  EXPECT_FALSE(polygon.Contains(Point2D(5.0, -1.0)));
+
+  polygon.BuildIndex();
+  EXPECT_TRUE(polygon.HasIndex());
+  EXPECT_TRUE(polygon.Contains(Point2D(5.0, 5.0)));
+  EXPECT_FALSE(polygon.Contains(Point2D(15.0, 5.0)));
+  EXPECT_FALSE(polygon.Contains(Point2D(5.0, 11.0)));
+}
+TEST(GeometryPolygon2D, IndexMatchesBruteForce) {
+  Polygon2D brute_force(MakeStar(7));
+  Polygon2D indexed(MakeStar(7));
+  indexed.BuildIndex(5);
+
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const Point2D kPoint(static_cast<double>(std::rand() % 2400) / 10.0 - 120.0,
+                         static_cast<double>(std::rand() % 2400) / 10.0 -
+                             120.0);
+    EXPECT_EQ(brute_force.Contains(kPoint), indexed.Contains(kPoint));
+  }
+}
+TEST(GeometryPolygon2D, IndexSizeIsCapped) {
+  constexpr std::size_t kToothCount{10000};
+  Polygon2D brute_force(MakeComb(kToothCount));
+  Polygon2D indexed(MakeComb(kToothCount));
+  EXPECT_EQ(0U, indexed.GetIndexSize());
+
+  // One slab per vertex would list every tooth edge in every slab.
+  indexed.BuildIndex();
+  EXPECT_TRUE(indexed.HasIndex());
+  EXPECT_LE(indexed.GetIndexSize(), indexed.GetVertexCount() * 64);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const Point2D kPoint(
+        static_cast<double>(std::rand() % (kToothCount * 20)) / 10.0,
+        static_cast<double>(std::rand() % 300) / 100.0 - 1.5);
+    EXPECT_EQ(brute_force.Contains(kPoint), indexed.Contains(kPoint));
+  }
+}
+TEST(GeometryPolygon2D, BatchContains) {
+  Polygon2D polygon(MakeStar(5));
+  std::vector<Point2D> points;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    points.emplace_back(static_cast<double>(std::rand() % 2400) / 10.0 - 120.0,
+                        static_cast<double>(std::rand() % 2400) / 10.0 - 120.0);
+  }
+  const auto kCloud = MakePointCloud(points);
+  PointCloud<2, float> float_cloud;
+  float_cloud.Resize(points.size());
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    float_cloud.Data(0)[i] = static_cast<float>(points[i].GetX());
+    float_cloud.Data(1)[i] = static_cast<float>(points[i].GetY());
+  }
+
+  for (const auto kIndexed : {false, true}) {
+    if (kIndexed) {
+      polygon.BuildIndex();
+    }
+    for (const std::size_t kThreadCount : {1U, 3U}) {
+      std::vector<uint64_t> mask(Polygon2D::GetMaskWordCount(points.size()),
+                                 ~uint64_t{0});
+      polygon.Contains(kCloud, mask.data(), kThreadCount);
+      for (std::size_t i = 0; i < points.size(); ++i) {
+        EXPECT_EQ(polygon.Contains(points[i]), IsSet(mask, i));
+      }
+      EXPECT_EQ(0U, mask.back() >> (points.size() % 64));
+
+      polygon.Contains(float_cloud, mask.data(), kThreadCount);
+      for (std::size_t i = 0; i < points.size(); ++i) {
+        const Point2D kWidened(float_cloud.Data(0)[i], float_cloud.Data(1)[i]);
+        EXPECT_EQ(polygon.Contains(kWidened), IsSet(mask, i));
+      }
+    }
+  }
+}
+TEST(GeometryPolygon2D, Area) {
+  Polygon2D counter_clockwise({Point2D(0.0, 0.0), Point2D(4.0, 0.0),
+                               Point2D(4.0, 3.0), Point2D(0.0, 3.0)});
+  Polygon2D clockwise({Point2D(0.0, 0.0), Point2D(0.0, 3.0), Point2D(4.0, 3.0),
+                       Point2D(4.0, 0.0)});
+
+  EXPECT_DOUBLE_EQ(12.0, counter_clockwise.CalculateSignedArea());
+  EXPECT_DOUBLE_EQ(-12.0, clockwise.CalculateSignedArea());
+  EXPECT_DOUBLE_EQ(12.0, clockwise.CalculateArea());
+}
+TEST(GeometryPolygon2D, Perimeter) {
+  Polygon2D polygon({Point2D(0.0, 0.0), Point2D(4.0, 0.0), Point2D(4.0, 3.0)});
+
+  EXPECT_EQ(Distance(12.0), polygon.CalculatePerimeter());
+  EXPECT_EQ(Distance(12.0, Distance::Type::kKilometer),
+            polygon.CalculatePerimeter(Distance::Type::kKilometer));
+}
+TEST(GeometryPolygon2D, Centroid) {
+  Polygon2D polygon({Point2D(10.0, 10.0), Point2D(14.0, 10.0),
+                     Point2D(14.0, 12.0), Point2D(10.0, 12.0)});
+  const auto kCentroid = polygon.CalculateCentroid();
+
+  EXPECT_DOUBLE_EQ(12.0, kCentroid.GetX());
+  EXPECT_DOUBLE_EQ(11.0, kCentroid.GetY());
+  EXPECT_THROW(static_cast<void>(Polygon2D({Point2D(0.0, 0.0),
+                                            Point2D(1.0, 1.0),
+                                            Point2D(2.0, 2.0)})
+                                     .CalculateCentroid()),
+               std::invalid_argument);
+}
+TEST(GeometryPolygon2D, LargePolygon) {
+  const double kRadius = 1000.0;
+  Polygon2D polygon(MakeCircle(200000, kRadius));
+  polygon.BuildIndex();
+
+  EXPECT_NEAR(kPi * kRadius * kRadius, polygon.CalculateArea(), 1.0e-3);
+  EXPECT_NEAR(2.0 * kPi * kRadius,
+              polygon.CalculatePerimeter().GetValue(Distance::Type::kMeter),
+              1.0e-3);
+  EXPECT_NEAR(0.0, polygon.CalculateCentroid().GetX(), 1.0e-9);
+  EXPECT_TRUE(polygon.Contains(Point2D(999.0, 0.0)));
+  EXPECT_FALSE(polygon.Contains(Point2D(1001.0, 0.0)));
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,207 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/polyline_simplifier.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+auto MakeNoisyLine(std::size_t count, double noise)
+    -> std::vector<zozibush::geometry::Point2D> {
+  std::vector<zozibush::geometry::Point2D> result;
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto kJitter =
+        noise * (static_cast<double>(std::rand() % 2001) / 1000.0 - 1.0);
+    result.emplace_back(static_cast<double>(i), kJitter);
+  }
+  return result;
+}
+
+auto MaxDeviation(const std::vector<zozibush::geometry::Point2D>& points,
+                  const std::vector<zozibush::geometry::Point2D>& simplified)
+    -> double {
+  double result{0.0};
+  std::size_t segment{0};
+  for (const auto& point : points) {
+    while (segment + 2 < simplified.size() &&
+           simplified[segment + 1].GetX() < point.GetX()) {
+      ++segment;
+    }
+    const auto& kStart = simplified[segment];
+    const auto& kEnd = simplified[segment + 1];
+    const auto kRatio = (point.GetX() - kStart.GetX()) /
+                        (kEnd.GetX() - kStart.GetX());
+    const auto kY = kStart.GetY() + kRatio * (kEnd.GetY() - kStart.GetY());
+    result = std::max(result, std::abs(point.GetY() - kY));
+  }
+  return result;
+}
+}  // namespace
+
+namespace zozibush::geometry {
+TEST(GeometryPolylineSimplifier, DouglasPeuckerStraightLine) {
+  const auto kPoints = MakeNoisyLine(kTestCount, 0.0);
+  std::vector<Point2D> output(kPoints.size());
+  PolylineSimplifier simplifier(Distance(0.1));
+
+  const auto kCount =
+      simplifier.DouglasPeucker(kPoints.data(), kPoints.size(), output.data());
+  ASSERT_EQ(2U, kCount);
+  EXPECT_EQ(kPoints.front(), output[0]);
+  EXPECT_EQ(kPoints.back(), output[1]);
+}
+TEST(GeometryPolylineSimplifier, DouglasPeuckerTolerance) {
+  const auto kPoints = MakeNoisyLine(kTestCount, 5.0);
+  std::vector<Point2D> output(kPoints.size());
+  PolylineSimplifier simplifier(Distance(200.0, Distance::Type::kCentimeter));
+
+  const auto kCount =
+      simplifier.DouglasPeucker(kPoints.data(), kPoints.size(), output.data());
+  output.resize(kCount);
+  EXPECT_LT(kCount, kPoints.size());
+  EXPECT_EQ(kPoints.front(), output.front());
+  EXPECT_EQ(kPoints.back(), output.back());
+  // Every dropped point is within tolerance of the segment replacing it; the
+  // vertical deviation bounds that distance from above only loosely here
+  // because consecutive x differ by 1 and the noise is at most 5.
+  EXPECT_LE(MaxDeviation(kPoints, output), 2.0 * std::sqrt(26.0));
+}
+TEST(GeometryPolylineSimplifier, DouglasPeuckerCorner) {
+  const std::vector<Point2D> kPoints{Point2D(0.0, 0.0), Point2D(1.0, 0.01),
+                                     Point2D(2.0, 0.0), Point2D(2.0, 1.0),
+                                     Point2D(2.01, 2.0)};
+  std::vector<Point2D> output(kPoints.size());
+  PolylineSimplifier simplifier(Distance(0.1));
+
+  const auto kCount =
+      simplifier.DouglasPeucker(kPoints.data(), kPoints.size(), output.data());
+  ASSERT_EQ(3U, kCount);
+  EXPECT_EQ(Point2D(2.0, 0.0), output[1]);
+}
+TEST(GeometryPolylineSimplifier, VisvalingamWhyatt) {
+  const std::vector<Point2D> kPoints{Point2D(0.0, 0.0), Point2D(1.0, 0.01),
+                                     Point2D(2.0, 0.0), Point2D(2.0, 1.0),
+                                     Point2D(2.01, 2.0)};
+  std::vector<Point2D> output(kPoints.size());
+  PolylineSimplifier simplifier(Distance(0.5));
+
+  const auto kCount = simplifier.VisvalingamWhyatt(
+      kPoints.data(), kPoints.size(), output.data());
+  ASSERT_EQ(3U, kCount);
+  EXPECT_EQ(kPoints.front(), output[0]);
+  EXPECT_EQ(Point2D(2.0, 0.0), output[1]);
+  EXPECT_EQ(kPoints.back(), output[2]);
+
+  PolylineSimplifier keep_all(Distance(0.0));
+  EXPECT_EQ(kPoints.size(), keep_all.VisvalingamWhyatt(
+                                kPoints.data(), kPoints.size(), output.data()));
+}
+TEST(GeometryPolylineSimplifier, VisvalingamWhyattNoisyLine) {
+  const auto kPoints = MakeNoisyLine(kTestCount, 1.0);
+  std::vector<Point2D> output(kPoints.size());
+  PolylineSimplifier simplifier(Distance(3.0));
+
+  const auto kCount = simplifier.Simplify(
+      PolylineSimplifier::Method::kVisvalingamWhyatt, kPoints.data(),
+      kPoints.size(), output.data());
+  EXPECT_LT(kCount, kPoints.size() / 2);
+  EXPECT_EQ(kPoints.back(), output[kCount - 1]);
+}
+TEST(GeometryPolylineSimplifier, ShortInput) {
+  const std::vector<Point2D> kPoints{Point2D(0.0, 0.0), Point2D(1.0, 1.0)};
+  std::vector<Point2D> output(kPoints.size());
+  PolylineSimplifier simplifier(Distance(10.0));
+
+  EXPECT_EQ(0U, simplifier.DouglasPeucker(kPoints.data(), 0, output.data()));
+  EXPECT_EQ(2U, simplifier.DouglasPeucker(kPoints.data(), 2, output.data()));
+  EXPECT_EQ(1U, simplifier.VisvalingamWhyatt(kPoints.data(), 1, output.data()));
+}
+TEST(GeometryPolylineSimplifier, SimplifyBatch) {
+  std::vector<Point2D> points;
+  std::vector<std::size_t> offsets{0};
+  for (uint32_t i = 0; i < 10; ++i) {
+    const auto kPolyline = MakeNoisyLine(100 + i * 10, 2.0);
+    points.insert(points.end(), kPolyline.begin(), kPolyline.end());
+    offsets.push_back(points.size());
+  }
+
+  for (const auto kMethod : {PolylineSimplifier::Method::kDouglasPeucker,
+                             PolylineSimplifier::Method::kVisvalingamWhyatt}) {
+    std::vector<Point2D> output(points.size());
+    std::vector<std::size_t> counts(offsets.size() - 1);
+    PolylineSimplifier::SimplifyBatch(
+        Distance(1.5), kMethod, points.data(), offsets.data(), counts.size(),
+        output.data(), counts.data(), Distance::Type::kMeter, 3);
+
+    PolylineSimplifier simplifier(Distance(1.5));
+    std::vector<Point2D> expected(points.size());
+    for (std::size_t i = 0; i < counts.size(); ++i) {
+      const auto kCount = simplifier.Simplify(
+          kMethod, points.data() + offsets[i], offsets[i + 1] - offsets[i],
+          expected.data());
+      ASSERT_EQ(kCount, counts[i]);
+      for (std::size_t j = 0; j < kCount; ++j) {
+        EXPECT_EQ(expected[j], output[offsets[i] + j]);
+      }
+    }
+  }
+}
+TEST(GeometryStreamingSimplifier, Constructor) {
+  EXPECT_THROW(StreamingSimplifier(Distance(1.0), 1), std::invalid_argument);
+  EXPECT_NO_THROW(StreamingSimplifier(Distance(1.0), 2));
+}
+TEST(GeometryStreamingSimplifier, StraightLine) {
+  StreamingSimplifier simplifier(Distance(0.1), 64);
+  std::vector<Point2D> output;
+  Point2D emitted;
+  for (uint32_t i = 0; i < 50; ++i) {
+    if (simplifier.Push(Point2D(static_cast<double>(i), 0.0), &emitted) > 0) {
+      output.push_back(emitted);
+    }
+  }
+  if (simplifier.Finish(&emitted) > 0) {
+    output.push_back(emitted);
+  }
+
+  ASSERT_EQ(2U, output.size());
+  EXPECT_EQ(Point2D(0.0, 0.0), output[0]);
+  EXPECT_EQ(Point2D(49.0, 0.0), output[1]);
+}
+TEST(GeometryStreamingSimplifier, BoundedWindow) {
+  StreamingSimplifier simplifier(Distance(0.1), 8);
+  std::size_t emitted_count{0};
+  Point2D emitted;
+  for (uint32_t i = 0; i < 50; ++i) {
+    emitted_count +=
+        simplifier.Push(Point2D(static_cast<double>(i), 0.0), &emitted);
+  }
+  emitted_count += simplifier.Finish(&emitted);
+
+  // Points 0, 7, ..., 42 close full windows, then the last point.
+  EXPECT_EQ(8U, emitted_count);
+}
+TEST(GeometryStreamingSimplifier, Tolerance) {
+  const auto kPoints = MakeNoisyLine(kTestCount, 3.0);
+  StreamingSimplifier simplifier(Distance(2.0), 32);
+  std::vector<Point2D> output;
+  Point2D emitted;
+  for (const auto& point : kPoints) {
+    if (simplifier.Push(point, &emitted) > 0) {
+      output.push_back(emitted);
+    }
+  }
+  if (simplifier.Finish(&emitted) > 0) {
+    output.push_back(emitted);
+  }
+
+  EXPECT_LT(output.size(), kPoints.size());
+  EXPECT_EQ(kPoints.front(), output.front());
+  EXPECT_EQ(kPoints.back(), output.back());
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,257 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/predicates.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+using Int128 = __int128;
+
+auto Sign(double value) -> int32_t { return (value > 0.0) - (value < 0.0); }
+auto Sign(Int128 value) -> int32_t { return (value > 0) - (value < 0); }
+
+// Points near the line ab, so most orientations need the adaptive stages.
+auto MakeNearLine(std::mt19937_64& engine, double ax, double ay, double bx,
+                  double by, uint32_t count)
+    -> zozibush::geometry::PointCloud<2, double> {
+  std::uniform_real_distribution<double> parameter(-0.5, 1.5);
+  zozibush::geometry::PointCloud<2, double> points;
+  points.Resize(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    const auto kT{parameter(engine)};
+    points.Data(0)[i] = ax + kT * (bx - ax);
+    points.Data(1)[i] = ay + kT * (by - ay);
+  }
+  return points;
+}
+
+auto InCirclePermanent(const double (&values)[8]) -> double {
+  const auto kAdx{values[0] - values[6]};
+  const auto kAdy{values[1] - values[7]};
+  const auto kBdx{values[2] - values[6]};
+  const auto kBdy{values[3] - values[7]};
+  const auto kCdx{values[4] - values[6]};
+  const auto kCdy{values[5] - values[7]};
+  return (std::abs(kBdx * kCdy) + std::abs(kCdx * kBdy)) *
+             (kAdx * kAdx + kAdy * kAdy) +
+         (std::abs(kCdx * kAdy) + std::abs(kAdx * kCdy)) *
+             (kBdx * kBdx + kBdy * kBdy) +
+         (std::abs(kAdx * kBdy) + std::abs(kBdx * kAdy)) *
+             (kCdx * kCdx + kCdy * kCdy);
+}
+
+auto Orient2DInteger(int64_t ax, int64_t ay, int64_t bx, int64_t by,
+                     int64_t cx, int64_t cy) -> Int128 {
+  return static_cast<Int128>(ax - cx) * (by - cy) -
+         static_cast<Int128>(ay - cy) * (bx - cx);
+}
+
+auto InCircleInteger(int64_t ax, int64_t ay, int64_t bx, int64_t by,
+                     int64_t cx, int64_t cy, int64_t dx, int64_t dy)
+    -> Int128 {
+  const Int128 kAdx{ax - dx};
+  const Int128 kAdy{ay - dy};
+  const Int128 kBdx{bx - dx};
+  const Int128 kBdy{by - dy};
+  const Int128 kCdx{cx - dx};
+  const Int128 kCdy{cy - dy};
+  return (kAdx * kAdx + kAdy * kAdy) * (kBdx * kCdy - kCdx * kBdy) +
+         (kBdx * kBdx + kBdy * kBdy) * (kCdx * kAdy - kAdx * kCdy) +
+         (kCdx * kCdx + kCdy * kCdy) * (kAdx * kBdy - kBdx * kAdy);
+}
+}  // namespace
+
+namespace zozibush::geometry {
+TEST(GeometryPredicates, Orient2D) {
+  EXPECT_GT(Orient2D(Point2D(0.0, 0.0), Point2D(1.0, 0.0), Point2D(0.0, 1.0)),
+            0.0);
+  EXPECT_LT(Orient2D(Point2D(0.0, 0.0), Point2D(0.0, 1.0), Point2D(1.0, 0.0)),
+            0.0);
+  EXPECT_EQ(Orient2D(Point2D(0.0, 0.0), Point2D(1.0, 1.0), Point2D(2.0, 2.0)),
+            0.0);
+
+  // Points a few ulps off the line y = x; the exact sign is sign(j - i).
+  const auto kUlp{std::nextafter(0.5, 1.0) - 0.5};
+  for (int32_t i = 0; i < 64; ++i) {
+    for (int32_t j = 0; j < 64; ++j) {
+      const auto kResult{Orient2D(0.5 + i * kUlp, 0.5 + j * kUlp, 12.0, 12.0,
+                                  24.0, 24.0)};
+      EXPECT_EQ((j > i) - (j < i), Sign(kResult)) << i << ", " << j;
+    }
+  }
+}
+TEST(GeometryPredicates, Orient2DExact) {
+  std::mt19937_64 engine(41U);
+  std::uniform_int_distribution<int64_t> coordinate(-(int64_t{1} << 50),
+                                                    int64_t{1} << 50);
+  std::uniform_int_distribution<int64_t> jitter(-2, 2);
+  for (uint32_t i = 0; i < 10000U; ++i) {
+    // c close to the line through a and b.
+    const auto kAx{coordinate(engine)};
+    const auto kAy{coordinate(engine)};
+    const auto kBx{coordinate(engine) / 1024};
+    const auto kBy{coordinate(engine) / 1024};
+    const auto kCx{2 * kBx - kAx / 1024 * 1024 + jitter(engine)};
+    const auto kCy{2 * kBy - kAy / 1024 * 1024 + jitter(engine)};
+    const auto kExpected{
+        Sign(Orient2DInteger(kAx, kAy, kBx, kBy, kCx, kCy))};
+    const auto kAxD{static_cast<double>(kAx)};
+    const auto kAyD{static_cast<double>(kAy)};
+    const auto kBxD{static_cast<double>(kBx)};
+    const auto kByD{static_cast<double>(kBy)};
+    const auto kCxD{static_cast<double>(kCx)};
+    const auto kCyD{static_cast<double>(kCy)};
+    EXPECT_EQ(kExpected,
+              Sign(Orient2D(kAxD, kAyD, kBxD, kByD, kCxD, kCyD)));
+    EXPECT_EQ(kExpected, Sign(internal::Orient2DExact(kAxD, kAyD, kBxD, kByD,
+                                                      kCxD, kCyD)));
+  }
+}
+TEST(GeometryPredicates, InCircle) {
+  const Point2D kA(1.0, 0.0);
+  const Point2D kB(0.0, 1.0);
+  const Point2D kC(-1.0, 0.0);
+  EXPECT_GT(InCircle(kA, kB, kC, Point2D(0.0, 0.0)), 0.0);
+  EXPECT_LT(InCircle(kA, kB, kC, Point2D(2.0, 0.0)), 0.0);
+  EXPECT_EQ(InCircle(kA, kB, kC, Point2D(0.0, -1.0)), 0.0);
+  EXPECT_LT(InCircle(kC, kB, kA, Point2D(0.0, 0.0)), 0.0);
+
+  // Integer points on and next to circles of radius 5 * 2^k.
+  std::mt19937_64 engine(43U);
+  std::uniform_int_distribution<int64_t> offset(-(int64_t{1} << 24),
+                                                int64_t{1} << 24);
+  std::uniform_int_distribution<int64_t> jitter(-1, 1);
+  for (uint32_t i = 0; i < 10000U; ++i) {
+    const auto kScale{int64_t{1} << (i % 18)};
+    const auto kOx{offset(engine)};
+    const auto kOy{offset(engine)};
+    const int64_t kAx{kOx + 3 * kScale};
+    const int64_t kAy{kOy + 4 * kScale};
+    const int64_t kBx{kOx - 4 * kScale};
+    const int64_t kBy{kOy + 3 * kScale};
+    const int64_t kCx{kOx - 5 * kScale};
+    const int64_t kCy{kOy};
+    const int64_t kDx{kOx + 4 * kScale + jitter(engine)};
+    const int64_t kDy{kOy - 3 * kScale + jitter(engine)};
+    const auto kExpected{Sign(
+        InCircleInteger(kAx, kAy, kBx, kBy, kCx, kCy, kDx, kDy))};
+    const double kValues[] = {
+        static_cast<double>(kAx), static_cast<double>(kAy),
+        static_cast<double>(kBx), static_cast<double>(kBy),
+        static_cast<double>(kCx), static_cast<double>(kCy),
+        static_cast<double>(kDx), static_cast<double>(kDy)};
+    EXPECT_EQ(kExpected,
+              Sign(InCircle(kValues[0], kValues[1], kValues[2], kValues[3],
+                            kValues[4], kValues[5], kValues[6], kValues[7])));
+    EXPECT_EQ(kExpected,
+              Sign(internal::InCircleExact(
+                  kValues[0], kValues[1], kValues[2], kValues[3], kValues[4],
+                  kValues[5], kValues[6], kValues[7])));
+  }
+}
+TEST(GeometryPredicates, Adaptive) {
+  std::mt19937_64 engine(47U);
+  std::uniform_real_distribution<double> coordinate(-1.0, 1.0);
+  for (uint32_t i = 0; i < 2000U; ++i) {
+    const auto kAx{coordinate(engine)};
+    const auto kAy{coordinate(engine)};
+    const auto kBx{coordinate(engine)};
+    const auto kBy{coordinate(engine)};
+    const auto kPoints{MakeNearLine(engine, kAx, kAy, kBx, kBy, 8)};
+    for (uint32_t j = 0; j < kPoints.Size(); ++j) {
+      const auto kCx{kPoints.Data(0)[j]};
+      const auto kCy{kPoints.Data(1)[j]};
+      const auto kPermanent{std::abs((kAx - kCx) * (kBy - kCy)) +
+                            std::abs((kAy - kCy) * (kBx - kCx))};
+      const auto kExpected{
+          Sign(internal::Orient2DExact(kAx, kAy, kBx, kBy, kCx, kCy))};
+      EXPECT_EQ(kExpected, Sign(internal::Orient2DAdaptive(
+                               kAx, kAy, kBx, kBy, kCx, kCy, kPermanent)));
+      EXPECT_EQ(kExpected, Sign(Orient2D(kAx, kAy, kBx, kBy, kCx, kCy)));
+    }
+  }
+
+  // Points rounded onto circles; the InCircle filter rarely decides them.
+  std::uniform_real_distribution<double> angle(0.0, 6.283185307179586);
+  for (uint32_t i = 0; i < 2000U; ++i) {
+    const auto kOx{coordinate(engine)};
+    const auto kOy{coordinate(engine)};
+    const auto kRadius{std::abs(coordinate(engine)) + 0.1};
+    double values[8] = {};
+    for (uint32_t j = 0; j < 4; ++j) {
+      const auto kAngle{angle(engine)};
+      values[2 * j] = kOx + kRadius * std::cos(kAngle);
+      values[2 * j + 1] = kOy + kRadius * std::sin(kAngle);
+    }
+    const auto kExpected{Sign(internal::InCircleExact(
+        values[0], values[1], values[2], values[3], values[4], values[5],
+        values[6], values[7]))};
+    EXPECT_EQ(kExpected, Sign(internal::InCircleAdaptive(
+                             values[0], values[1], values[2], values[3],
+                             values[4], values[5], values[6], values[7],
+                             InCirclePermanent(values))));
+    EXPECT_EQ(kExpected,
+              Sign(InCircle(values[0], values[1], values[2], values[3],
+                            values[4], values[5], values[6], values[7])));
+  }
+}
+TEST(GeometryPredicates, SegmentSide) {
+  const Point2D kA(1.0, 1.0);
+  const Point2D kB(3.0, 3.0);
+  EXPECT_EQ(SegmentSide::kLeft, GetSegmentSide(kA, kB, Point2D(1.0, 2.0)));
+  EXPECT_EQ(SegmentSide::kRight, GetSegmentSide(kA, kB, Point2D(2.0, 1.0)));
+  EXPECT_EQ(SegmentSide::kBeforeStart,
+            GetSegmentSide(kA, kB, Point2D(0.0, 0.0)));
+  EXPECT_EQ(SegmentSide::kAfterEnd, GetSegmentSide(kA, kB, Point2D(4.0, 4.0)));
+  EXPECT_EQ(SegmentSide::kOnSegment, GetSegmentSide(kA, kB, kA));
+  EXPECT_EQ(SegmentSide::kOnSegment, GetSegmentSide(kA, kB, kB));
+  EXPECT_EQ(SegmentSide::kOnSegment,
+            GetSegmentSide(kA, kB, Point2D(2.0, 2.0)));
+  EXPECT_EQ(SegmentSide::kBeforeStart,
+            GetSegmentSide(kB, kA, Point2D(4.0, 4.0)));
+
+  // Vertical and degenerate segments.
+  const Point2D kTop(0.0, 5.0);
+  const Point2D kBottom(0.0, -5.0);
+  EXPECT_EQ(SegmentSide::kAfterEnd,
+            GetSegmentSide(kTop, kBottom, Point2D(0.0, -6.0)));
+  EXPECT_EQ(SegmentSide::kOnSegment,
+            GetSegmentSide(kTop, kBottom, Point2D(0.0, 0.0)));
+  EXPECT_EQ(SegmentSide::kOnSegment, GetSegmentSide(kA, kA, kA));
+  EXPECT_EQ(SegmentSide::kAfterEnd, GetSegmentSide(kA, kA, kB));
+}
+TEST(GeometryPredicates, Batch) {
+  std::mt19937_64 engine(53U);
+  const Point2D kA(0.1, 0.3);
+  const Point2D kB(0.7, -0.9);
+  const Point2D kC(-0.4, 0.6);
+  auto points{MakeNearLine(engine, kA.GetX(), kA.GetY(), kB.GetX(),
+                           kB.GetY(), 20000U)};
+  // Some points exactly on the segment and off it.
+  points.Data(0)[0] = kA.GetX();
+  points.Data(1)[0] = kA.GetY();
+  points.Data(0)[1] = 5.0;
+  points.Data(1)[1] = 10.0;
+
+  std::vector<int8_t> orientations(points.Size());
+  Orient2D(kA, kB, points, orientations.data(), 4);
+  std::vector<int8_t> circles(points.Size());
+  InCircle(kA, kB, kC, points, circles.data(), 4);
+  std::vector<SegmentSide> sides(points.Size());
+  GetSegmentSide(kA, kB, points, sides.data(), 4);
+
+  for (uint32_t i = 0; i < points.Size(); ++i) {
+    const auto kPoint{points.Get(i).ToPoint2()};
+    ASSERT_EQ(Sign(Orient2D(kA, kB, kPoint)), orientations[i]);
+    ASSERT_EQ(Sign(InCircle(kA, kB, kC, kPoint)), circles[i]);
+    ASSERT_EQ(GetSegmentSide(kA, kB, kPoint), sides[i]);
+  }
+  EXPECT_EQ(SegmentSide::kOnSegment, sides[0]);
+  EXPECT_EQ(SegmentSide::kLeft, sides[1]);
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,254 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/query_server.hpp"
+
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "geometry/query_client.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 2000U;
+
+auto MakeRandomPoints(std::mt19937& engine, double extent, uint32_t count)
+    -> std::vector<zozibush::geometry::Point2D> {
+  std::uniform_real_distribution<double> coordinate(-extent, extent);
+  std::vector<zozibush::geometry::Point2D> result;
+  for (uint32_t i = 0; i < count; ++i) {
+    const auto kX{coordinate(engine)};
+    result.emplace_back(kX, coordinate(engine));
+  }
+  return result;
+}
+
+auto GetSocketPath(const std::string& name) -> std::string {
+  return "/tmp/geometry_" + name + "_" + std::to_string(::getpid()) + ".sock";
+}
+}  // namespace
+
+namespace zozibush::geometry::query {
+TEST(GeometryQueryServer, AnswersConcurrentClients) {
+  std::mt19937 engine(3U);
+  const auto kPoints{MakeRandomPoints(engine, 100.0, kTestCount)};
+  const auto kPath{GetSocketPath("concurrent")};
+  QueryServer server(kPath, 2, 500);
+  EXPECT_EQ(0U, server.AddPointSet(MakePointCloud(kPoints)));
+  server.Start();
+
+  constexpr uint32_t kClientCount{4};
+  constexpr uint32_t kQueryCount{300};
+  std::vector<std::thread> clients;
+  std::vector<int> failures(kClientCount, 0);
+  for (uint32_t c = 0; c < kClientCount; ++c) {
+    clients.emplace_back([&, c] {
+      std::mt19937 client_engine(10U + c);
+      QueryClient client(kPath);
+      for (int round = 0; round < 5; ++round) {
+        const auto kQueries{
+            MakeRandomPoints(client_engine, 120.0, kQueryCount)};
+        std::vector<uint32_t> nearest(kQueryCount);
+        std::vector<double> distances(kQueryCount);
+        client.Nearest(0, kQueries.data(), kQueryCount, nearest.data(),
+                       distances.data());
+        std::vector<uint32_t> counts;
+        std::vector<uint32_t> found;
+        client.Radius(0, 6.0, kQueries.data(), kQueryCount, counts, found);
+        std::vector<double> pair_distances(kQueryCount);
+        client.Distance(0, kQueries.data(), nearest.data(), kQueryCount,
+                        pair_distances.data());
+
+        std::size_t offset{0};
+        for (uint32_t q = 0; q < kQueryCount; ++q) {
+          auto best{0U};
+          std::vector<uint32_t> expected;
+          for (uint32_t i = 0; i < kTestCount; ++i) {
+            const auto kDistance{kQueries[q].CalculateDistance(kPoints[i])};
+            if (kDistance < kQueries[q].CalculateDistance(kPoints[best])) {
+              best = i;
+            }
+            if (kDistance <= 6.0) {
+              expected.push_back(i);
+            }
+          }
+          const std::vector<uint32_t> kFound(
+              found.begin() + static_cast<std::ptrdiff_t>(offset),
+              found.begin() + static_cast<std::ptrdiff_t>(offset + counts[q]));
+          offset += counts[q];
+          failures[c] += static_cast<int>(nearest[q] != best) +
+                         static_cast<int>(distances[q] != pair_distances[q]) +
+                         static_cast<int>(kFound != expected);
+        }
+        failures[c] += static_cast<int>(offset != found.size());
+      }
+    });
+  }
+  for (auto& client : clients) {
+    client.join();
+  }
+  for (const auto kFailures : failures) {
+    EXPECT_EQ(0, kFailures);
+  }
+
+  const auto kStatistics{server.GetStatistics()};
+  EXPECT_EQ(kClientCount * 5 * 3, kStatistics.request_count);
+  EXPECT_EQ(kClientCount * 5 * 3 * kQueryCount, kStatistics.query_count);
+  EXPECT_LE(kStatistics.batch_count, kStatistics.request_count);
+  EXPECT_GE(kStatistics.batch_count, 1U);
+  EXPECT_EQ(0U, kStatistics.queue_depth);
+  EXPECT_LE(kStatistics.p50_latency_ns, kStatistics.p99_latency_ns);
+  EXPECT_GT(kStatistics.p99_latency_ns, 0U);
+  server.Stop();
+}
+TEST(GeometryQueryServer, LoadAndStatistics) {
+  const auto kPath{GetSocketPath("load")};
+  QueryServer server(kPath, 1);
+  server.Start();
+  QueryClient client(kPath);
+
+  const std::vector<Point2D> kSet{{0.0, 0.0}, {3.0, 4.0}, {10.0, 0.0}};
+  EXPECT_EQ(0U, client.Load(kSet.data(), kSet.size()));
+  EXPECT_EQ(1U, client.Load(kSet.data(), 2));
+
+  const std::vector<Point2D> kQueries{{9.0, 1.0}, {2.0, 3.0}};
+  std::vector<uint32_t> nearest(2);
+  std::vector<double> distances(2);
+  client.Nearest(0, kQueries.data(), 2, nearest.data(), distances.data());
+  EXPECT_EQ(2U, nearest[0]);
+  EXPECT_EQ(1U, nearest[1]);
+  client.Nearest(1, kQueries.data(), 2, nearest.data(), distances.data());
+  EXPECT_EQ(1U, nearest[0]);
+  EXPECT_DOUBLE_EQ(std::sqrt(2.0), distances[1]);
+
+  const std::vector<uint32_t> kIndices{0, 2};
+  client.Distance(0, kQueries.data(), kIndices.data(), 2, distances.data());
+  EXPECT_DOUBLE_EQ(std::sqrt(82.0), distances[0]);
+  EXPECT_DOUBLE_EQ(std::sqrt(73.0), distances[1]);
+
+  const auto kStatistics{client.GetStatistics()};
+  EXPECT_EQ(5U, kStatistics.request_count);
+  EXPECT_EQ(6U, kStatistics.query_count);
+  EXPECT_EQ(3U, kStatistics.batch_count);
+}
+TEST(GeometryQueryServer, SlowClientIsDropped) {
+  std::mt19937 engine(5U);
+  const auto kPoints{MakeRandomPoints(engine, 100.0, kTestCount)};
+  const auto kPath{GetSocketPath("slow")};
+  QueryServer server(kPath, 1, 65536, std::size_t{1} << 20U);
+  server.AddPointSet(MakePointCloud(kPoints));
+  server.Start();
+
+  // A raw client queues radius requests whose answers hold every point,
+  // about 800 kB each, and never reads them.
+  const auto kSocket{::socket(AF_UNIX, SOCK_STREAM, 0)};
+  ASSERT_GE(kSocket, 0);
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  std::memcpy(address.sun_path, kPath.c_str(), kPath.size());
+  ASSERT_EQ(0, ::connect(kSocket, reinterpret_cast<const sockaddr*>(&address),
+                         sizeof(address)));
+  // Fail rather than hang should the server never drop the client.
+  const timeval kTimeout{10, 0};
+  ASSERT_EQ(0, ::setsockopt(kSocket, SOL_SOCKET, SO_RCVTIMEO, &kTimeout,
+                            sizeof(kTimeout)));
+  constexpr uint32_t kRequestCount{32};
+  constexpr uint32_t kQueryCount{100};
+  const auto kQueries{MakeRandomPoints(engine, 1.0, kQueryCount)};
+  MessageHeader header;
+  header.type = static_cast<uint16_t>(MessageType::kRadius);
+  header.count = kQueryCount;
+  header.size = sizeof(double) + kQueryCount * 2 * sizeof(double);
+  std::vector<char> payload(header.size);
+  const double kRadius{1000.0};
+  std::memcpy(payload.data(), &kRadius, sizeof(kRadius));
+  for (uint32_t i = 0; i < kQueryCount; ++i) {
+    const double kXY[2]{kQueries[i].GetX(), kQueries[i].GetY()};
+    std::memcpy(payload.data() + sizeof(double) + i * sizeof(kXY), kXY,
+                sizeof(kXY));
+  }
+  for (uint32_t r = 0; r < kRequestCount; ++r) {
+    header.id = r;
+    ASSERT_TRUE(internal::WriteFull(kSocket, &header, sizeof(header)));
+    ASSERT_TRUE(internal::WriteFull(kSocket, payload.data(), payload.size()));
+  }
+
+  // Other clients are still answered.
+  QueryClient client(kPath);
+  const Point2D kQuery(0.0, 0.0);
+  uint32_t index{0};
+  double distance{0.0};
+  client.Nearest(0, &kQuery, 1, &index, &distance);
+  EXPECT_DOUBLE_EQ(kQuery.CalculateDistance(kPoints[index]), distance);
+
+  // The slow client is cut off once its backlog passes the limit, which
+  // happens before all of its requests are answered.
+  while (server.GetStatistics().request_count < kRequestCount + 1) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  const std::size_t kResponseSize{sizeof(MessageHeader) +
+                                  (kQueryCount + kQueryCount * kTestCount) *
+                                      sizeof(uint32_t)};
+  std::size_t received{0};
+  std::vector<char> buffer(65536);
+  ssize_t size{0};
+  while ((size = ::read(kSocket, buffer.data(), buffer.size())) > 0) {
+    received += static_cast<std::size_t>(size);
+  }
+  ::close(kSocket);
+  EXPECT_LT(received, kRequestCount * kResponseSize);
+
+  client.Nearest(0, &kQuery, 1, &index, &distance);
+  server.Stop();
+}
+TEST(GeometryQueryServer, Errors) {
+  EXPECT_THROW(QueryServer(""), std::invalid_argument);
+  EXPECT_THROW(QueryServer(std::string(200, 'a')), std::invalid_argument);
+  EXPECT_THROW(QueryClient(GetSocketPath("missing")), std::runtime_error);
+
+  const auto kPath{GetSocketPath("errors")};
+  QueryServer server(kPath, 1);
+  EXPECT_THROW(server.AddPointSet({}), std::invalid_argument);
+  EXPECT_THROW(server.AddPointSet(MakePointCloud(std::vector<Point2D>{
+                   {0.0, std::numeric_limits<double>::quiet_NaN()}})),
+               std::out_of_range);
+  server.AddPointSet(MakePointCloud(std::vector<Point2D>{{1.0, 1.0}}));
+  server.Start();
+  QueryClient client(kPath);
+
+  const Point2D kQuery(0.0, 0.0);
+  uint32_t index{0};
+  double distance{0.0};
+  std::vector<uint32_t> counts;
+  std::vector<uint32_t> found;
+  EXPECT_THROW(client.Nearest(1, &kQuery, 1, &index, &distance),
+               std::runtime_error);
+  index = 1;
+  EXPECT_THROW(client.Distance(0, &kQuery, &index, 1, &distance),
+               std::runtime_error);
+  EXPECT_THROW(client.Radius(0, -1.0, &kQuery, 1, counts, found),
+               std::runtime_error);
+  EXPECT_THROW(client.Load(&kQuery, 0), std::runtime_error);
+
+  // The connection survives rejected requests.
+  client.Nearest(0, &kQuery, 1, &index, &distance);
+  EXPECT_EQ(0U, index);
+  EXPECT_DOUBLE_EQ(std::sqrt(2.0), distance);
+
+  server.Stop();
+  EXPECT_THROW(client.Nearest(0, &kQuery, 1, &index, &distance),
+               std::runtime_error);
+}
+}  // namespace zozibush::geometry::query
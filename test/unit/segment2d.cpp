@@ -0,0 +1,58 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/segment2d.hpp"
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+namespace zozibush::geometry {
+TEST(GeometrySegment2D, Construction) {
+  const Segment2D kSegment(Point2D(1.0, 2.0), Point2D(4.0, 6.0));
+
+  EXPECT_EQ(Point2D(1.0, 2.0), kSegment.GetStart());
+  EXPECT_EQ(Point2D(4.0, 6.0), kSegment.GetEnd());
+  EXPECT_DOUBLE_EQ(5.0, kSegment.CalculateLength());
+  EXPECT_TRUE(kSegment == Segment2D(Point2D(1.0, 2.0), Point2D(4.0, 6.0)));
+  EXPECT_TRUE(kSegment != Segment2D(Point2D(4.0, 6.0), Point2D(1.0, 2.0)));
+}
+TEST(GeometrySegment2D, Intersect) {
+  const Segment2D kSegment(Point2D(0.0, 0.0), Point2D(4.0, 4.0));
+  Point2D point;
+
+  // Proper crossing.
+  EXPECT_TRUE(
+      kSegment.Intersect(Segment2D(Point2D(0.0, 4.0), Point2D(4.0, 0.0)),
+                         point));
+  EXPECT_EQ(Point2D(2.0, 2.0), point);
+  // Touching at an endpoint and at an interior point.
+  EXPECT_TRUE(
+      kSegment.Intersect(Segment2D(Point2D(4.0, 4.0), Point2D(5.0, 0.0)),
+                         point));
+  EXPECT_EQ(Point2D(4.0, 4.0), point);
+  EXPECT_TRUE(
+      kSegment.Intersect(Segment2D(Point2D(3.0, 0.0), Point2D(1.0, 1.0)),
+                         point));
+  EXPECT_EQ(Point2D(1.0, 1.0), point);
+  // Overlap reports its smallest point.
+  EXPECT_TRUE(
+      kSegment.Intersect(Segment2D(Point2D(6.0, 6.0), Point2D(3.0, 3.0)),
+                         point));
+  EXPECT_EQ(Point2D(3.0, 3.0), point);
+  // Zero-length segment on the segment.
+  EXPECT_TRUE(
+      kSegment.Intersect(Segment2D(Point2D(0.5, 0.5), Point2D(0.5, 0.5)),
+                         point));
+  EXPECT_EQ(Point2D(0.5, 0.5), point);
+
+  EXPECT_FALSE(
+      kSegment.Intersects(Segment2D(Point2D(5.0, 5.0), Point2D(6.0, 6.0))));
+  EXPECT_FALSE(
+      kSegment.Intersects(Segment2D(Point2D(0.0, 1.0), Point2D(3.0, 4.0))));
+  EXPECT_FALSE(
+      kSegment.Intersects(Segment2D(Point2D(3.0, 0.0), Point2D(2.0, 1.0))));
+  // One ulp off the line through the endpoint.
+  EXPECT_FALSE(kSegment.Intersects(
+      Segment2D(Point2D(2.0, std::nextafter(2.0, 0.0)), Point2D(9.0, 0.0))));
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,158 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/segment_intersector.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+using zozibush::geometry::Point2D;
+using zozibush::geometry::Segment2D;
+using zozibush::geometry::SegmentIntersector;
+using Pairs = std::vector<std::pair<uint32_t, uint32_t>>;
+
+auto FindBruteForce(const std::vector<Segment2D>& segments) -> Pairs {
+  Pairs result;
+  for (uint32_t i = 0; i < segments.size(); ++i) {
+    for (uint32_t j = i + 1; j < segments.size(); ++j) {
+      if (segments[i].Intersects(segments[j])) {
+        result.emplace_back(i, j);
+      }
+    }
+  }
+  return result;
+}
+
+auto ToSortedPairs(const std::vector<uint32_t>& buffer, std::size_t count)
+    -> Pairs {
+  Pairs result;
+  for (std::size_t i = 0; i < count; ++i) {
+    result.emplace_back(buffer[2 * i], buffer[2 * i + 1]);
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+auto ExpectMatches(const std::vector<Segment2D>& segments) -> void {
+  const SegmentIntersector kIntersector(segments);
+  const auto kExpected{FindBruteForce(segments)};
+  std::vector<uint32_t> pairs(2 * kExpected.size() + 2);
+  std::vector<Point2D> points(kExpected.size() + 1);
+
+  const auto kCount{
+      kIntersector.FindIntersections(pairs.data(), points.data(),
+                                     points.size())};
+  ASSERT_EQ(kExpected.size(), kCount);
+  EXPECT_EQ(kExpected, ToSortedPairs(pairs, kCount));
+  for (std::size_t i = 0; i < kCount; ++i) {
+    EXPECT_LT(pairs[2 * i], pairs[2 * i + 1]);
+  }
+  EXPECT_EQ(!kExpected.empty(), kIntersector.HasIntersection());
+
+  const auto kParallelCount{kIntersector.FindIntersectionsParallel(
+      pairs.data(), nullptr, points.size(), 3)};
+  ASSERT_EQ(kExpected.size(), kParallelCount);
+  EXPECT_EQ(kExpected, ToSortedPairs(pairs, kParallelCount));
+}
+}  // namespace
+
+namespace zozibush::geometry {
+TEST(GeometrySegmentIntersector, Random) {
+  std::mt19937 engine(61U);
+  std::uniform_real_distribution<double> coordinate(0.0, 1000.0);
+  std::uniform_real_distribution<double> offset(-15.0, 15.0);
+  std::vector<Segment2D> segments;
+  for (uint32_t i = 0; i < 5000U; ++i) {
+    const Point2D kStart(coordinate(engine), coordinate(engine));
+    segments.emplace_back(
+        kStart, kStart + Point2D(offset(engine), offset(engine)));
+  }
+  ExpectMatches(segments);
+
+  // Points are on both segments.
+  const SegmentIntersector kIntersector(segments);
+  std::vector<uint32_t> pairs(2 * 10000);
+  std::vector<Point2D> points(10000);
+  const auto kCount{
+      kIntersector.FindIntersections(pairs.data(), points.data(), 10000)};
+  for (std::size_t i = 0; i < kCount; ++i) {
+    for (const auto kSegment : {pairs[2 * i], pairs[2 * i + 1]}) {
+      const auto& kStart{segments[kSegment].GetStart()};
+      const auto& kEnd{segments[kSegment].GetEnd()};
+      EXPECT_NEAR(kStart.CalculateDistance(kEnd),
+                  kStart.CalculateDistance(points[i]) +
+                      points[i].CalculateDistance(kEnd),
+                  1e-9);
+    }
+  }
+}
+TEST(GeometrySegmentIntersector, Degenerate) {
+  // Small integer coordinates: shared endpoints, collinear overlaps,
+  // vertical, duplicate and zero-length segments, concurrent crossings.
+  std::mt19937 engine(67U);
+  std::uniform_int_distribution<int32_t> coordinate(0, 8);
+  for (uint32_t round = 0; round < 20U; ++round) {
+    std::vector<Segment2D> segments;
+    for (uint32_t i = 0; i < 40U; ++i) {
+      segments.emplace_back(Point2D(coordinate(engine), coordinate(engine)),
+                            Point2D(coordinate(engine), coordinate(engine)));
+    }
+    segments.push_back(segments.front());
+    ExpectMatches(segments);
+  }
+
+  // Decimal coordinates: crossings within an ulp of other events.
+  std::vector<Segment2D> decimal;
+  std::uniform_int_distribution<int32_t> step(-6, 6);
+  for (uint32_t i = 0; i < 600U; ++i) {
+    const auto kX{coordinate(engine) * 0.1};
+    const auto kY{coordinate(engine) * 0.1};
+    decimal.emplace_back(Point2D(kX, kY),
+                         Point2D(kX + step(engine) * 0.1,
+                                 kY + step(engine) * 0.1));
+  }
+  ExpectMatches(decimal);
+
+  // A star through one point and a fan from one point.
+  std::vector<Segment2D> star;
+  for (int32_t i = 0; i < 8; ++i) {
+    star.emplace_back(Point2D(-4.0 + i, -4.0), Point2D(4.0 - i, 4.0));
+    star.emplace_back(Point2D(0.0, 0.0), Point2D(5.0, i - 4.0));
+  }
+  ExpectMatches(star);
+}
+TEST(GeometrySegmentIntersector, Disjoint) {
+  std::vector<Segment2D> segments;
+  for (int32_t i = 0; i < 100; ++i) {
+    segments.emplace_back(Point2D(0.0, i), Point2D(10.0, i + 0.5));
+  }
+  const SegmentIntersector kDisjoint(segments);
+  EXPECT_FALSE(kDisjoint.HasIntersection());
+  EXPECT_EQ(0U, kDisjoint.FindIntersections(nullptr, nullptr, 0));
+  EXPECT_EQ(0U, SegmentIntersector({}).FindIntersections(nullptr, nullptr, 0));
+
+  segments.emplace_back(Point2D(5.0, 50.0), Point2D(5.0, 52.0));
+  const SegmentIntersector kCrossed(segments);
+  EXPECT_TRUE(kCrossed.HasIntersection());
+
+  // The count is complete even if the buffers are too small.
+  std::vector<uint32_t> pairs(2);
+  std::vector<Point2D> points(1);
+  EXPECT_EQ(2U, kCrossed.FindIntersections(pairs.data(), points.data(), 1));
+  EXPECT_EQ(100U, pairs[1]);
+}
+TEST(GeometrySegmentIntersector, Exception) {
+  EXPECT_THROW(SegmentIntersector({Segment2D(
+                   Point2D(0.0, 0.0),
+                   Point2D(std::numeric_limits<double>::infinity(), 1.0))}),
+               std::out_of_range);
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,110 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/transform2d.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+// More than one range of the batch loops.
+constexpr uint32_t kTestCount = 200000U;
+constexpr double kPi{3.14159265358979323846};
+
+auto MakeRandomPoints(std::mt19937& engine)
+    -> std::vector<zozibush::geometry::Point2D> {
+  std::uniform_real_distribution<double> coordinate(-1e3, 1e3);
+  std::vector<zozibush::geometry::Point2D> result;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kX{coordinate(engine)};
+    result.emplace_back(kX, coordinate(engine));
+  }
+  return result;
+}
+}  // namespace
+
+namespace zozibush::geometry {
+TEST(GeometryTransform2D, Compose) {
+  constexpr auto kMove{Transform2D::Translation(3.0, -2.0)};
+  constexpr auto kScale{Transform2D::Scale(2.0, 4.0)};
+  constexpr auto kComposed{kMove.Then(kScale)};
+  static_assert(kComposed == kScale * kMove);
+  static_assert(kComposed == Transform2D(2.0, 0.0, 6.0, 0.0, 4.0, -8.0));
+  static_assert(kComposed.Invert() * kComposed == Transform2D());
+  static_assert(kMove.IsTranslation() && kScale.IsAxisAligned());
+  static_assert(!kScale.IsTranslation());
+  static_assert(kComposed.Get(2, 2) == 1.0 && kComposed.Get(2, 0) == 0.0);
+
+  const auto kRotation{Transform2D::Rotation(kPi / 2.0)};
+  const auto kRotated{kRotation.Apply({1.0, 0.0})};
+  EXPECT_NEAR(0.0, kRotated.GetX(), 1e-15);
+  EXPECT_NEAR(1.0, kRotated.GetY(), 1e-15);
+  EXPECT_FALSE(kRotation.IsAxisAligned());
+
+  const Point2D kPoint(1.5, -7.25);
+  const auto kGeneral{kMove.Then(kRotation).Then(kScale)};
+  const auto kOnce{kGeneral.Apply(kPoint)};
+  const auto kStepwise{kScale.Apply(kRotation.Apply(kMove.Apply(kPoint)))};
+  EXPECT_NEAR(kStepwise.GetX(), kOnce.GetX(), 1e-12);
+  EXPECT_NEAR(kStepwise.GetY(), kOnce.GetY(), 1e-12);
+  const auto kBack{kGeneral.Invert().Apply(kOnce)};
+  EXPECT_NEAR(kPoint.GetX(), kBack.GetX(), 1e-12);
+  EXPECT_NEAR(kPoint.GetY(), kBack.GetY(), 1e-12);
+
+  EXPECT_THROW(static_cast<void>(Transform2D::Scale(0.0, 1.0).Invert()),
+               std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(
+                   Transform2D(1.0, 2.0, 0.0, 2.0, 4.0, 0.0).Invert()),
+               std::invalid_argument);
+  EXPECT_THROW(
+      static_cast<void>(
+          Transform2D::Scale(std::numeric_limits<double>::infinity(), 1.0)
+              .Invert()),
+      std::invalid_argument);
+}
+TEST(GeometryTransform2D, Batch) {
+  std::mt19937 engine(3U);
+  const auto kPoints{MakeRandomPoints(engine)};
+  const auto kCloud{MakePointCloud(kPoints)};
+
+  // Translation, axis-aligned and general loops.
+  for (const auto& kTransform :
+       {Transform2D::Translation(10.0, -4.0),
+        Transform2D::Scale(0.5, -3.0).Then(Transform2D::Translation(1.0, 2.0)),
+        Transform2D::Rotation(0.3).Then(Transform2D::Translation(5.0, 6.0))}) {
+    std::vector<Point2D> expected;
+    for (const auto& kPoint : kPoints) {
+      expected.push_back(kTransform.Apply(kPoint));
+    }
+
+    std::vector<Point2D> output(kTestCount);
+    kTransform.Apply(kPoints.data(), kTestCount, output.data(), 4);
+    auto in_place{kPoints};
+    kTransform.ApplyInPlace(in_place.data(), kTestCount, 4);
+
+    PointCloud<2, double> cloud_output;
+    kTransform.Apply(kCloud, cloud_output, 4);
+    ASSERT_EQ(kTestCount, cloud_output.Size());
+    auto cloud_in_place{kCloud};
+    kTransform.ApplyInPlace(cloud_in_place, 1);
+
+    for (uint32_t i = 0; i < kTestCount; ++i) {
+      ASSERT_TRUE(output[i] == expected[i]);
+      ASSERT_TRUE(in_place[i] == expected[i]);
+      ASSERT_EQ(expected[i].GetX(), cloud_output.Data(0)[i]);
+      ASSERT_EQ(expected[i].GetY(), cloud_output.Data(1)[i]);
+      ASSERT_EQ(expected[i].GetX(), cloud_in_place.Data(0)[i]);
+      ASSERT_EQ(expected[i].GetY(), cloud_in_place.Data(1)[i]);
+    }
+  }
+
+  PointCloud<2, double> empty;
+  Transform2D::Scale(2.0, 2.0).Apply(empty, empty, 4);
+  EXPECT_EQ(0U, empty.Size());
+}
+}  // namespace zozibush::geometry
@@ -0,0 +1,199 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/tuning.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "geometry/dbscan.hpp"
+#include "geometry/distance_selection.hpp"
+#include "geometry/polygon2d.hpp"
+#include "geometry/predicates.hpp"
+#include "geometry/transform2d.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 20000U;
+
+auto GetCachePath(const std::string& name) -> std::string {
+  std::random_device device;
+  return (std::filesystem::temp_directory_path() /
+          ("geometry_tuning_" + name + "_" + std::to_string(device())) /
+          "tuning.txt")
+      .string();
+}
+
+// setenv is POSIX only. _putenv_s removes the variable for an empty value,
+// so on Windows GetTuningCachePath() falls back to XDG_CACHE_HOME and HOME,
+// which are normally unset there.
+auto SetEnvironment(const char* name, const std::string& value) -> void {
+#if defined(_WIN32)
+  ::_putenv_s(name, value.c_str());
+#else
+  ::setenv(name, value.c_str(), 1);
+#endif
+}
+
+auto IsGrain(std::size_t grain) -> bool {
+  return grain >= 64 && grain <= (std::size_t{1} << 20U) &&
+         (grain & (grain - 1)) == 0;
+}
+}  // namespace
+
+namespace zozibush::geometry {
+TEST(GeometryTuning, CacheFile) {
+  const auto kPath{GetCachePath("cache")};
+  EXPECT_FALSE(internal::ReadTuningCache(kPath, "a").has_value());
+
+  TuningParameters parameters;
+  parameters.query_grain = 128;
+  parameters.cell_grain = 2048;
+  parameters.contains_grain = 256;
+  parameters.selection_grain = 4096;
+  parameters.predicate_grain = 8192;
+  parameters.transform_grain = 16384;
+  parameters.thread_start_ns = 30000;
+  ASSERT_TRUE(internal::WriteTuningCache(kPath, "a", parameters));
+  parameters.query_grain = 512;
+  ASSERT_TRUE(internal::WriteTuningCache(kPath, "b", parameters));
+  parameters.query_grain = 64;
+  ASSERT_TRUE(internal::WriteTuningCache(kPath, "a", parameters));
+
+  const auto kA{internal::ReadTuningCache(kPath, "a")};
+  ASSERT_TRUE(kA.has_value());
+  EXPECT_EQ(64U, kA->query_grain);
+  EXPECT_EQ(2048U, kA->cell_grain);
+  EXPECT_EQ(256U, kA->contains_grain);
+  EXPECT_EQ(4096U, kA->selection_grain);
+  EXPECT_EQ(8192U, kA->predicate_grain);
+  EXPECT_EQ(16384U, kA->transform_grain);
+  EXPECT_EQ(30000U, kA->thread_start_ns);
+  EXPECT_EQ(TuningParameters::Source::kCache, kA->source);
+  const auto kB{internal::ReadTuningCache(kPath, "b")};
+  ASSERT_TRUE(kB.has_value());
+  EXPECT_EQ(512U, kB->query_grain);
+
+  // Broken or unknown entries are skipped.
+  {
+    std::ofstream file(kPath, std::ios::app);
+    file << "v2\tc\t64\t64\t100\t64\t64\t64\t0\n"
+         << "v2\td\t64\tx\t64\t64\t64\t64\t0\n"
+         << "v1\te\t64\t64\t64\t0\n"
+         << "garbage\n";
+  }
+  EXPECT_FALSE(internal::ReadTuningCache(kPath, "c").has_value());
+  EXPECT_FALSE(internal::ReadTuningCache(kPath, "d").has_value());
+  EXPECT_FALSE(internal::ReadTuningCache(kPath, "e").has_value());
+  EXPECT_TRUE(internal::ReadTuningCache(kPath, "a").has_value());
+  std::filesystem::remove_all(std::filesystem::path(kPath).parent_path());
+}
+TEST(GeometryTuning, Calibrate) {
+  const auto kPath{GetCachePath("calibrate")};
+  SetEnvironment("GEOMETRY_TUNING_CACHE", kPath);
+  EXPECT_EQ(kPath, GetTuningCachePath());
+  EXPECT_FALSE(GetCpuModel().empty());
+
+  const auto kCalibrated{CalibrateTuningParameters()};
+  EXPECT_EQ(TuningParameters::Source::kCalibration, kCalibrated.source);
+  EXPECT_TRUE(IsGrain(kCalibrated.query_grain));
+  EXPECT_TRUE(IsGrain(kCalibrated.cell_grain));
+  EXPECT_TRUE(IsGrain(kCalibrated.contains_grain));
+  EXPECT_TRUE(IsGrain(kCalibrated.selection_grain));
+  EXPECT_TRUE(IsGrain(kCalibrated.predicate_grain));
+  EXPECT_TRUE(IsGrain(kCalibrated.transform_grain));
+  EXPECT_GT(kCalibrated.thread_start_ns, 0U);
+  EXPECT_EQ(kCalibrated.query_grain, GetTuningParameters().query_grain);
+
+  const auto kCached{
+      internal::ReadTuningCache(kPath, internal::GetTuningKey())};
+  ASSERT_TRUE(kCached.has_value());
+  EXPECT_EQ(kCalibrated.cell_grain, kCached->cell_grain);
+  EXPECT_EQ(kCalibrated.thread_start_ns, kCached->thread_start_ns);
+
+  TuningParameters parameters;
+  parameters.contains_grain = 100;
+  EXPECT_THROW(SetTuningParameters(parameters), std::invalid_argument);
+  parameters.contains_grain = 64;
+  parameters.query_grain = 0;
+  EXPECT_THROW(SetTuningParameters(parameters), std::invalid_argument);
+  parameters.query_grain = 7;
+  parameters.selection_grain = 0;
+  EXPECT_THROW(SetTuningParameters(parameters), std::invalid_argument);
+  parameters.selection_grain = 1;
+  parameters.predicate_grain = 0;
+  EXPECT_THROW(SetTuningParameters(parameters), std::invalid_argument);
+  parameters.predicate_grain = 1;
+  parameters.transform_grain = 0;
+  EXPECT_THROW(SetTuningParameters(parameters), std::invalid_argument);
+  parameters.transform_grain = 1;
+  SetTuningParameters(parameters);
+  EXPECT_EQ(7U, GetTuningParameters().query_grain);
+  EXPECT_EQ(TuningParameters::Source::kUser, GetTuningParameters().source);
+
+  // Left empty, so nothing later in this run writes a cache below HOME.
+  SetEnvironment("GEOMETRY_TUNING_CACHE", "");
+  EXPECT_TRUE(GetTuningCachePath().empty());
+  std::filesystem::remove_all(std::filesystem::path(kPath).parent_path());
+}
+TEST(GeometryTuning, GrainsDoNotChangeResults) {
+  std::mt19937 engine(3U);
+  std::uniform_real_distribution<double> coordinate(0.0, 100.0);
+  PointCloud<2, double> points;
+  points.Resize(kTestCount);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    points.Data(0)[i] = coordinate(engine);
+    points.Data(1)[i] = coordinate(engine);
+  }
+  const Dbscan kDbscan(Distance(1.0), 4);
+  const Polygon2D kPolygon(
+      {{10.0, 10.0}, {90.0, 20.0}, {50.0, 50.0}, {80.0, 90.0}, {5.0, 70.0}});
+
+  std::vector<std::vector<int64_t>> labels;
+  std::vector<std::vector<uint64_t>> masks;
+  std::vector<std::vector<std::size_t>> nearest;
+  std::vector<std::vector<int8_t>> signs;
+  std::vector<PointCloud<2, double>> rotated;
+  for (const std::size_t kGrain : {64U, 1024U, 1U << 20U}) {
+    TuningParameters parameters;
+    parameters.query_grain = kGrain;
+    parameters.cell_grain = kGrain;
+    parameters.contains_grain = kGrain;
+    parameters.selection_grain = kGrain;
+    parameters.predicate_grain = kGrain;
+    parameters.transform_grain = kGrain;
+    SetTuningParameters(parameters);
+    labels.emplace_back(kTestCount);
+    kDbscan.Cluster(points, labels.back().data(), 4);
+    masks.emplace_back(Polygon2D::GetMaskWordCount(kTestCount));
+    kPolygon.Contains(points, masks.back().data(), 4);
+    nearest.push_back(SelectNearest(points, {50.0, 50.0}, 100, 4));
+    signs.emplace_back(kTestCount);
+    InCircle({10.0, 10.0}, {90.0, 20.0}, {50.0, 90.0}, points,
+             signs.back().data(), 4);
+    rotated.emplace_back();
+    Transform2D::Rotation(0.5).Apply(points, rotated.back(), 4);
+  }
+  EXPECT_EQ(labels[0], labels[1]);
+  EXPECT_EQ(labels[0], labels[2]);
+  EXPECT_EQ(masks[0], masks[1]);
+  EXPECT_EQ(masks[0], masks[2]);
+  EXPECT_EQ(nearest[0], nearest[1]);
+  EXPECT_EQ(nearest[0], nearest[2]);
+  EXPECT_EQ(signs[0], signs[1]);
+  EXPECT_EQ(signs[0], signs[2]);
+  for (std::size_t grain = 1; grain < rotated.size(); ++grain) {
+    for (std::size_t axis = 0; axis < 2; ++axis) {
+      EXPECT_TRUE(std::equal(rotated[grain].Data(axis),
+                             rotated[grain].Data(axis) + kTestCount,
+                             rotated[0].Data(axis)));
+    }
+  }
+}
+}  // namespace zozibush::geometry
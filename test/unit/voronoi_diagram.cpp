@@ -0,0 +1,84 @@
+// Copyright (c) 2023 zozibush, All Rights Reserved.
+// Authors: zozibush
+#include "geometry/voronoi_diagram.hpp"
+
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "geometry/predicates.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+auto CalculateArea(const std::vector<zozibush::geometry::Point2D>& polygon)
+    -> double {
+  auto result{0.0};
+  for (std::size_t i = 0; i < polygon.size(); ++i) {
+    const auto& kA{polygon[i]};
+    const auto& kB{polygon[(i + 1) % polygon.size()]};
+    result += kA.GetX() * kB.GetY() - kB.GetX() * kA.GetY();
+  }
+  return result * 0.5;
+}
+}  // namespace
+
+namespace zozibush::geometry {
+TEST(GeometryVoronoiDiagram, Grid) {
+  // 3x3 grid with a tiny shear so the square cells are not degenerate.
+  PointCloud<2> cloud;
+  for (int32_t y = 0; y < 3; ++y) {
+    for (int32_t x = 0; x < 3; ++x) {
+      cloud.PushBack(PointN<2>(x + y * 1e-9, y));
+    }
+  }
+  const Delaunay kDelaunay(cloud);
+  const VoronoiDiagram kVoronoi(kDelaunay);
+  std::vector<Point2D> cell;
+
+  EXPECT_EQ(9U, kVoronoi.GetCellCount());
+  EXPECT_EQ(kDelaunay.GetTriangleCount(), kVoronoi.GetVertices().size());
+  for (uint32_t point = 0; point < 9U; ++point) {
+    EXPECT_EQ(point == 4U, kVoronoi.IsBounded(point));
+  }
+  kVoronoi.GetCell(4, cell);
+  EXPECT_NEAR(1.0, CalculateArea(cell), 1e-6);
+}
+TEST(GeometryVoronoiDiagram, Random) {
+  std::mt19937 engine(59U);
+  std::uniform_real_distribution<double> coordinate(0.0, 100.0);
+  PointCloud<2> cloud;
+  for (uint32_t i = 0; i < 2000U; ++i) {
+    cloud.PushBack(PointN<2>(coordinate(engine), coordinate(engine)));
+  }
+  const Delaunay kDelaunay(cloud);
+  const VoronoiDiagram kVoronoi(kDelaunay);
+  std::vector<Point2D> cell;
+
+  std::size_t unbounded{0};
+  for (uint32_t point = 0; point < cloud.Size(); ++point) {
+    const auto kSite{cloud.Get(point).ToPoint2()};
+    ASSERT_GE(kVoronoi.GetCell(point, cell), 2U);
+    if (!kVoronoi.IsBounded(point)) {
+      ++unbounded;
+      continue;
+    }
+    // Convex, counter-clockwise and around its site.
+    for (std::size_t i = 0; i < cell.size(); ++i) {
+      EXPECT_GE(Orient2D(cell[i], cell[(i + 1) % cell.size()], kSite), 0.0);
+    }
+    // Every vertex is at least as close to the site as to any neighbour.
+    for (const auto& kVertex : cell) {
+      const auto kNearest{kVertex.CalculateDistance(kSite)};
+      for (uint32_t other = 0; other < cloud.Size(); other += 97U) {
+        EXPECT_LE(kNearest,
+                  kVertex.CalculateDistance(cloud.Get(other).ToPoint2()) +
+                      1e-9);
+      }
+    }
+  }
+  EXPECT_EQ(kDelaunay.GetHull().size(), unbounded);
+  EXPECT_THROW(kVoronoi.GetCell(static_cast<uint32_t>(cloud.Size()), cell),
+               std::out_of_range);
+}
+}  // namespace zozibush::geometry